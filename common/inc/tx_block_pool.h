@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    tx_block_pool.h                                     PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -44,6 +44,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added lock-free block pool    */
+/*                                            definitions, resulting in   */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 
@@ -56,6 +59,35 @@
 #define TX_BLOCK_POOL_ID                        ((ULONG) 0x424C4F43)
 
 
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+/* Define the fields of the head of the lock-free list of available blocks. The
+   low bits hold the index of the first block plus one, or zero for an empty
+   list. The next bit is set while threads wait for a block. The remaining
+   bits are a tag that is advanced by every update, so that a stale head is
+   never mistaken for the current one.  */
+
+#define TX_BLOCK_POOL_LOCK_FREE_INDEX_MASK      ((ULONG) 0xFFFF)
+#define TX_BLOCK_POOL_LOCK_FREE_WAITING         ((ULONG) 0x10000)
+#define TX_BLOCK_POOL_LOCK_FREE_TAG_INCREMENT   ((ULONG) 0x20000)
+
+
+/* Define the tag of the next head, derived from the current head.  */
+
+#define TX_BLOCK_POOL_LOCK_FREE_NEXT_TAG(a)     (((a) & ~(TX_BLOCK_POOL_LOCK_FREE_INDEX_MASK | TX_BLOCK_POOL_LOCK_FREE_WAITING)) + TX_BLOCK_POOL_LOCK_FREE_TAG_INCREMENT)
+
+
+/* Define the atomic compare and swap of a ULONG used by the lock-free list,
+   which evaluates to TX_TRUE if the ULONG held the expected value and was
+   replaced. Ports with an atomic instruction should define this in tx_port.h,
+   otherwise the swap is performed with interrupts disabled.  */
+
+#ifndef TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP
+#define TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP(a, e, n)   _tx_block_pool_lock_free_compare_swap((a), (e), (n))
+#endif
+#endif
+
+
 /* Determine if in-line component initialization is supported by the
    caller.  */
 
@@ -87,7 +119,14 @@ VOID        _tx_block_pool_initialize(VOID);
 
 /* Define internal block memory pool management function prototypes.  */
 
+UINT        _tx_block_pool_bulk_give(TX_THREAD *thread_ptr, VOID *block_ptr);
 VOID        _tx_block_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+UINT        _tx_block_pool_lock_free_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option);
+UINT        _tx_block_pool_lock_free_compare_swap(ULONG *destination, ULONG expected, ULONG new_value);
+UCHAR       *_tx_block_pool_lock_free_pop(TX_BLOCK_POOL *pool_ptr, UINT set_waiting);
+UINT        _tx_block_pool_lock_free_release(VOID *block_ptr);
+#endif
 
 
 /* Block pool management component data declarations follow.  */
@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    tx_byte_pool.h                                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -44,6 +44,16 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added TLSF allocation policy  */
+/*                                            definitions, added          */
+/*                                            coalescing first-fit policy */
+/*                                            definitions, added byte     */
+/*                                            pool cache prototypes,      */
+/*                                            added size-indexed waiter   */
+/*                                            wakeup, added aligned       */
+/*                                            allocation, added           */
+/*                                            fragmentation information,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -68,6 +78,158 @@
 #endif
 
 
+/* Define the two-level segregated fit (TLSF) policy constants. Each power-of-two range of
+   block sizes (first level) is divided into 2^TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2 linear
+   size classes (second level). Blocks smaller than TX_BYTE_POOL_TLSF_SMALL_BLOCK_SIZE are
+   all placed in the first first-level range.  */
+
+#ifndef TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2
+#define TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2   ((UINT) 3)
+#endif
+
+#define TX_BYTE_POOL_TLSF_SL_INDEX_COUNT        (((UINT) 1) << TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2)
+#define TX_BYTE_POOL_TLSF_FL_INDEX_SHIFT        (TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2 + ((UINT) 3))
+#define TX_BYTE_POOL_TLSF_SMALL_BLOCK_SIZE      (((ULONG) 1) << TX_BYTE_POOL_TLSF_FL_INDEX_SHIFT)
+
+#ifndef TX_BYTE_POOL_TLSF_MIN
+#define TX_BYTE_POOL_TLSF_MIN                   ((ULONG) 1024)
+#endif
+
+
+/* Define the size of the header in front of each block of a pool that uses boundary tags,
+   i.e. the TLSF and coalescing first-fit policies. In addition to the "next" pointer and the
+   owner field of the first-fit format, each block is preceded by a pointer to the physically
+   previous block so that neighbors can be merged on release.  */
+
+#define TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD      (((sizeof(UCHAR *)) + (sizeof(UCHAR *))) + (sizeof(ALIGN_TYPE)))
+
+
+/* Define the macro to calculate the highest set bit of a non-zero value. This can be
+   overridden in tx_port.h with a count-leading-zeros instruction.  */
+
+#ifndef TX_HIGHEST_SET_BIT_CALCULATE
+#define TX_HIGHEST_SET_BIT_CALCULATE(m, b)      \
+    (b) =  ((UINT) 0);                          \
+    if ((m) >= ((ULONG) 0x10000))               \
+    {                                           \
+        (m) = (m) >> ((ULONG) 16);              \
+        (b) = (b) + ((UINT) 16);                \
+    }                                           \
+    if ((m) >= ((ULONG) 0x100))                 \
+    {                                           \
+        (m) = (m) >> ((ULONG) 8);               \
+        (b) = (b) + ((UINT) 8);                 \
+    }                                           \
+    if ((m) >= ((ULONG) 0x10))                  \
+    {                                           \
+        (m) = (m) >> ((ULONG) 4);               \
+        (b) = (b) + ((UINT) 4);                 \
+    }                                           \
+    if ((m) >= ((ULONG) 4))                     \
+    {                                           \
+        (m) = (m) >> ((ULONG) 2);               \
+        (b) = (b) + ((UINT) 2);                 \
+    }                                           \
+    (b) = (b) + ((UINT) ((m) >> ((ULONG) 1)));
+#endif
+
+
+/* Define the macro to calculate the bit of the suspended size map that corresponds to a
+   requested size. Bit N covers the sizes from 2^N up to 2^(N+1)-1, and all sizes of 2^31
+   and above share bit 31.  */
+
+#define TX_BYTE_POOL_SIZE_BIT_CALCULATE(s, m, b)    \
+    (m) =  (s);                                     \
+    if (((m) >> ((ULONG) 31)) != ((ULONG) 0))       \
+    {                                               \
+        (m) =  ((ULONG) 0x80000000UL);              \
+    }                                               \
+    TX_HIGHEST_SET_BIT_CALCULATE(m, b)              \
+    (m) =  ((ULONG) 1) << (b);
+
+
+/* Define the limit used to compare the suspension stamps of two threads suspended on the
+   same pool. The difference of the first stamp minus the second is above this limit when
+   the first stamp was given out earlier, even after the stamp counter wraps around.  */
+
+#define TX_BYTE_POOL_STAMP_HALF                 ((ULONG) 0x7FFFFFFFUL)
+
+
+/* Define the macro to calculate the offset (o) into the block (p) at which a block must
+   start so that the memory returned to the application is a multiple of the power-of-two
+   alignment (a). A non-zero offset is at least the minimum (m), so that the leading space
+   can be left in the pool as a free block of its own.  */
+
+#define TX_BYTE_POOL_ALIGNED_OFFSET_CALCULATE(p, a, m, o)                                          \
+    (o) =  TX_POINTER_TO_ULONG_CONVERT(TX_UCHAR_POINTER_ADD((p), ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))))); \
+    (o) =  ((a) - ((o) & ((a) - ((ULONG) 1)))) & ((a) - ((ULONG) 1));                              \
+    if (((o) != ((ULONG) 0)) && ((o) < (m)))                                                      \
+    {                                                                                              \
+        (o) =  (o) + ((((m) - (o)) + ((a) - ((ULONG) 1))) & (~((a) - ((ULONG) 1))));               \
+    }
+
+
+/* Define the macros that keep the optional free block size histogram up to date. A free
+   block must be removed before its size changes or it is allocated, and inserted once it
+   is freed or its new size is set.  */
+
+#ifdef TX_BYTE_POOL_ENABLE_FRAGMENTATION_INFO
+#define TX_BYTE_POOL_FRAGMENTATION_CLASS_SHIFT      ((UINT) 4)
+#define TX_BYTE_POOL_FRAGMENTATION_INSERT(p, b)     _tx_byte_pool_fragmentation_insert((p), (b));
+#define TX_BYTE_POOL_FRAGMENTATION_REMOVE(p, b)     _tx_byte_pool_fragmentation_remove((p), (b));
+
+#define TX_BYTE_POOL_FRAGMENTATION_CLASS_CALCULATE(s, m, c)                 \
+    (m) =  (s) >> TX_BYTE_POOL_FRAGMENTATION_CLASS_SHIFT;                   \
+    (c) =  ((UINT) 0);                                                      \
+    if ((m) != ((ULONG) 0))                                                 \
+    {                                                                       \
+        TX_HIGHEST_SET_BIT_CALCULATE(m, c)                                  \
+        if ((c) >= TX_BYTE_POOL_FRAGMENTATION_CLASSES)                      \
+        {                                                                   \
+            (c) =  TX_BYTE_POOL_FRAGMENTATION_CLASSES - ((UINT) 1);         \
+        }                                                                   \
+    }
+#else
+#define TX_BYTE_POOL_FRAGMENTATION_INSERT(p, b)
+#define TX_BYTE_POOL_FRAGMENTATION_REMOVE(p, b)
+#endif
+
+
+/* Define the TLSF index that is placed at the start of a TLSF pool's memory area. The
+   second-level bitmaps and the free list heads follow the index structure directly and
+   are sized according to the size of the pool.  */
+
+typedef struct TX_BYTE_POOL_TLSF_STRUCT
+{
+
+    /* Define the first-level bitmap. A set bit indicates that at least one
+       second-level list of the corresponding range is non-empty.  */
+    ULONG               tx_byte_pool_tlsf_fl_bitmap;
+
+    /* Define the number of first-level ranges covered by this pool.  */
+    UINT                tx_byte_pool_tlsf_fl_count;
+
+    /* Define the second-level bitmaps, one for each first-level range.  */
+    ULONG               *tx_byte_pool_tlsf_sl_bitmap;
+
+    /* Define the free list heads, TX_BYTE_POOL_TLSF_SL_INDEX_COUNT for
+       each first-level range.  */
+    UCHAR               **tx_byte_pool_tlsf_free_list;
+
+} TX_BYTE_POOL_TLSF_INDEX;
+
+
+/* Define the pointer conversions used to access the TLSF index.  */
+
+#ifndef TX_UCHAR_TO_BYTE_POOL_TLSF_POINTER_CONVERT
+#define TX_UCHAR_TO_BYTE_POOL_TLSF_POINTER_CONVERT(a)   ((TX_BYTE_POOL_TLSF_INDEX *) ((VOID *) (a)))
+#endif
+
+#ifndef TX_UCHAR_TO_ULONG_POINTER_CONVERT
+#define TX_UCHAR_TO_ULONG_POINTER_CONVERT(a)            ((ULONG *) ((VOID *) (a)))
+#endif
+
+
 /* Determine if in-line component initialization is supported by the
    caller.  */
 
@@ -102,8 +264,31 @@ VOID        _tx_byte_pool_initialize(VOID);
 
 /* Define internal byte memory pool management function prototypes.  */
 
-UCHAR       *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size);
+UCHAR       *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment, UINT *restart_count_ptr);
 VOID        _tx_byte_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+VOID        _tx_byte_pool_boundary_tag_format(TX_BYTE_POOL *pool_ptr, UCHAR *area_ptr);
+UCHAR       *_tx_byte_pool_boundary_tag_split(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr, ULONG offset);
+UCHAR       *_tx_byte_pool_coalesce_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment);
+UCHAR       *_tx_byte_pool_coalesce_release(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_tlsf_create(TX_BYTE_POOL *pool_ptr);
+VOID        _tx_byte_pool_tlsf_mapping(ULONG memory_size, UINT *fl_ptr, UINT *sl_ptr);
+VOID        _tx_byte_pool_tlsf_block_insert(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_tlsf_block_remove(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+UCHAR       *_tx_byte_pool_tlsf_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment);
+UCHAR       *_tx_byte_pool_tlsf_release(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+ULONG       _tx_byte_pool_free_extent(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+TX_THREAD   *_tx_byte_pool_waiter_find(TX_BYTE_POOL *pool_ptr, ULONG extent);
+VOID        _tx_byte_pool_waiter_insert(TX_BYTE_POOL *pool_ptr, TX_THREAD *thread_ptr);
+VOID        _tx_byte_pool_waiter_remove(TX_BYTE_POOL *pool_ptr, TX_THREAD *thread_ptr);
+#ifdef TX_BYTE_POOL_ENABLE_FRAGMENTATION_INFO
+VOID        _tx_byte_pool_fragmentation_insert(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_fragmentation_remove(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+#endif
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+UCHAR       *_tx_byte_pool_cache_get(TX_BYTE_POOL *pool_ptr, ULONG *memory_size_ptr);
+UINT        _tx_byte_pool_cache_put(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+UINT        _tx_byte_pool_cache_flush(TX_BYTE_POOL *pool_ptr);
+#endif
 
 
 /* Byte pool management component data declarations follow.  */
@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    tx_queue.h                                          PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -44,6 +44,13 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added zero-copy reserve,      */
+/*                                            commit, acquire and release */
+/*                                            services, added queue send  */
+/*                                            and receive multiple        */
+/*                                            services, added priority    */
+/*                                            queues, resulting in        */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 
@@ -101,9 +108,64 @@ VOID        _tx_queue_initialize(VOID);
 #endif
 
 
+/* Define the copy of a message between the queue and a buffer of the caller.  A message
+   of whole ULONGs is copied with the message copy macro.  The last ULONG of a message
+   size given in bytes is only partly used, so the message is copied by a function that
+   copies the bytes of that ULONG one at a time and reads or writes no byte past the end
+   of the message.  In both cases the source and destination pointers are moved past the
+   message slot.  */
+
+#define TX_QUEUE_MESSAGE_EXACT_COPY(q, s, d, z)                                                 \
+                    if ((((q) -> tx_queue_message_bytes) & (((UINT) (sizeof(ULONG))) - ((UINT) 1))) == ((UINT) 0)) \
+                    {                                                                           \
+                        TX_QUEUE_MESSAGE_COPY(s, d, z)                                          \
+                    }                                                                           \
+                    else                                                                        \
+                    {                                                                           \
+                        _tx_queue_message_bytes_copy(&(s), &(d), ((q) -> tx_queue_message_bytes)); \
+                    }
+
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+/* Define the kinds of queue suspension, which are kept in the suspend information
+   of the suspended thread. Receive and acquire suspensions are ahead of the send,
+   front send and reserve suspensions.  */
+
+#define TX_QUEUE_RECEIVE_SUSPEND                ((ULONG) 0)
+#define TX_QUEUE_ACQUIRE_SUSPEND                ((ULONG) 1)
+#define TX_QUEUE_SEND_SUSPEND                   ((ULONG) 2)
+#define TX_QUEUE_FRONT_SEND_SUSPEND             ((ULONG) 3)
+#define TX_QUEUE_RESERVE_SUSPEND                ((ULONG) 4)
+
+
+/* Define the pointer conversion used to return a message slot to a suspended
+   acquire or reserve request.  */
+
+#ifndef TX_VOID_TO_INDIRECT_VOID_POINTER_CONVERT
+#define TX_VOID_TO_INDIRECT_VOID_POINTER_CONVERT(a)     ((VOID **) ((VOID *) (a)))
+#endif
+#endif
+
+
+/* Priority queues keep their messages on one list per priority, which does not work
+   with the zero-copy services that hand out slots in the order of the queue area.  */
+
+#if defined(TX_QUEUE_ENABLE_MESSAGE_PRIORITY) && defined(TX_QUEUE_ENABLE_ZERO_COPY)
+#error "TX_QUEUE_ENABLE_MESSAGE_PRIORITY and TX_QUEUE_ENABLE_ZERO_COPY must not both be defined."
+#endif
+
+
 /* Define internal queue management function prototypes.  */
 
 VOID        _tx_queue_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+VOID        _tx_queue_message_bytes_copy(ULONG **source, ULONG **destination, UINT message_bytes);
+VOID        _tx_queue_threads_resume(TX_THREAD *resume_list);
+TX_THREAD   *_tx_queue_zero_copy_settle(TX_QUEUE *queue_ptr);
+VOID        _tx_queue_priority_insert(TX_QUEUE *queue_ptr, ULONG *source, UINT priority);
+VOID        _tx_queue_priority_front_insert(TX_QUEUE *queue_ptr, ULONG *source);
+VOID        _tx_queue_priority_remove(TX_QUEUE *queue_ptr, ULONG *destination);
+VOID        _tx_queue_priority_reset(TX_QUEUE *queue_ptr);
 
 
 /* Queue management component data declarations follow.  */
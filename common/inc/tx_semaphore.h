@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    tx_semaphore.h                                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -44,6 +44,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added semaphore put and get   */
+/*                                            count services, resulting   */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 
@@ -85,6 +88,7 @@ VOID        _tx_semaphore_initialize(VOID);
 /* Define internal semaphore management function prototypes.  */
 
 VOID        _tx_semaphore_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+VOID        _tx_semaphore_instances_put(TX_SEMAPHORE *semaphore_ptr, ULONG count);
 
 
 /* Semaphore management component data declarations follow.  */
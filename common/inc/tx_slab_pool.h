@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_slab_pool.h                                      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX slab memory management component,     */
+/*    including all data types and external references.  It is assumed    */
+/*    that tx_api.h and tx_port.h have already been included.             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_SLAB_POOL_H
+#define TX_SLAB_POOL_H
+
+
+/* Define slab memory control specific data definitions.  */
+
+#define TX_SLAB_POOL_ID                         ((ULONG) 0x534C4142)
+
+
+/* Define the header at the start of each page of a slab pool. A free page is on the free
+   page list of the pool. A page given to a size class is carved into blocks of the class
+   on demand, and is on the page list of the class while it has free blocks. Each block is
+   preceded by a pointer, which links the free blocks of the page and points back at the
+   page while the block is allocated.  */
+
+typedef struct TX_SLAB_POOL_PAGE_STRUCT
+{
+
+    /* Define the size class the page is given to, NULL for a free page.  */
+    TX_SLAB_POOL_CLASS  *tx_slab_pool_page_class;
+
+    /* Define the page list next and previous pointers.  */
+    struct TX_SLAB_POOL_PAGE_STRUCT
+                        *tx_slab_pool_page_next,
+                        *tx_slab_pool_page_previous;
+
+    /* Define the head pointer of the released blocks of the page.  */
+    UCHAR               *tx_slab_pool_page_free_list;
+
+    /* Define the first block of the page that has not been allocated yet.  */
+    UCHAR               *tx_slab_pool_page_carve;
+
+    /* Define the number of blocks of the page that have not been allocated yet.  */
+    UINT                tx_slab_pool_page_uncarved;
+
+    /* Define the number of allocated blocks of the page.  */
+    UINT                tx_slab_pool_page_used;
+
+} TX_SLAB_POOL_PAGE;
+
+
+/* Define the size of the page header - rounded for alignment.  */
+
+#define TX_SLAB_POOL_PAGE_HEADER_SIZE           ((((sizeof(TX_SLAB_POOL_PAGE)) + (sizeof(ALIGN_TYPE))) - ((ALIGN_TYPE) 1))/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE))
+
+
+/* Define the pointer conversions used to access the pages and the slab pool.  */
+
+#ifndef TX_UCHAR_TO_SLAB_POOL_PAGE_POINTER_CONVERT
+#define TX_UCHAR_TO_SLAB_POOL_PAGE_POINTER_CONVERT(a)   ((TX_SLAB_POOL_PAGE *) ((VOID *) (a)))
+#endif
+#ifndef TX_SLAB_POOL_PAGE_TO_UCHAR_POINTER_CONVERT
+#define TX_SLAB_POOL_PAGE_TO_UCHAR_POINTER_CONVERT(a)   ((UCHAR *) ((VOID *) (a)))
+#endif
+#ifndef TX_VOID_TO_SLAB_POOL_POINTER_CONVERT
+#define TX_VOID_TO_SLAB_POOL_POINTER_CONVERT(a)         ((TX_SLAB_POOL *) ((VOID *) (a)))
+#endif
+
+
+/* Determine if in-line component initialization is supported by the
+   caller.  */
+
+#ifdef TX_INVOKE_INLINE_INITIALIZATION
+
+/* Yes, in-line initialization is supported, remap the slab memory pool
+   initialization function.  */
+
+#define _tx_slab_pool_initialize() \
+                    _tx_slab_pool_created_ptr =                    TX_NULL;     \
+                    _tx_slab_pool_created_count =                  TX_EMPTY
+#define TX_SLAB_POOL_INIT
+#else
+
+/* No in-line initialization is supported, use standard function call.  */
+VOID        _tx_slab_pool_initialize(VOID);
+#endif
+
+
+/* Define internal slab memory pool management function prototypes.  */
+
+UCHAR       *_tx_slab_pool_class_allocate(TX_SLAB_POOL *pool_ptr, ULONG memory_size);
+VOID        _tx_slab_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+
+
+/* Slab pool management component data declarations follow.  */
+
+/* Determine if the initialization function of this component is including
+   this file.  If so, make the data definitions really happen.  Otherwise,
+   make them extern so other functions in the component can access them.  */
+
+#ifdef TX_SLAB_POOL_INIT
+#define SLAB_POOL_DECLARE
+#else
+#define SLAB_POOL_DECLARE extern
+#endif
+
+
+/* Define the head pointer of the created slab pool list.  */
+
+SLAB_POOL_DECLARE  TX_SLAB_POOL *           _tx_slab_pool_created_ptr;
+
+
+/* Define the variable that holds the number of created slab pools. */
+
+SLAB_POOL_DECLARE  ULONG                    _tx_slab_pool_created_count;
+
+
+/* Define default post slab pool delete macro to whitespace, if it hasn't been defined previously (typically in tx_port.h).  */
+
+#ifndef TX_SLAB_POOL_DELETE_PORT_COMPLETION
+#define TX_SLAB_POOL_DELETE_PORT_COMPLETION(p)
+#endif
+
+
+#endif
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_spsc_ring.h                                      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX single-producer single-consumer ring  */
+/*    management component, including all data types and external         */
+/*    references. It is assumed that tx_api.h and tx_port.h have already  */
+/*    been included.                                                      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_SPSC_RING_H
+#define TX_SPSC_RING_H
+
+
+/* Define ring control specific data definitions.  */
+
+#define TX_SPSC_RING_ID                         ((ULONG) 0x53505343)
+
+
+/* Define the accesses to the ring indices and to the waiting flags.  These must be
+   sequentially consistent: a store must not be reordered with the message copy before
+   it, a load must not be reordered with the message copy after it, and a store must
+   not be reordered with a following load, otherwise a suspending producer or consumer
+   could be missed.  Ports should define these in tx_port.h with atomic loads and
+   stores.  The defaults are function calls, which the compiler does not move memory
+   accesses across.  This is sufficient on a single core, but not on multiple cores.  */
+
+#ifndef TX_SPSC_RING_LOAD
+#define TX_SPSC_RING_LOAD(a)                    _tx_spsc_ring_load((a))
+#endif
+
+#ifndef TX_SPSC_RING_STORE
+#define TX_SPSC_RING_STORE(a, v)                _tx_spsc_ring_store((a), (v))
+#endif
+
+
+/* Define the ring pointer conversion.  */
+
+#ifndef TX_VOID_TO_SPSC_RING_POINTER_CONVERT
+#define TX_VOID_TO_SPSC_RING_POINTER_CONVERT(a) ((TX_SPSC_RING *) ((VOID *) (a)))
+#endif
+
+
+/* Determine if in-line component initialization is supported by the
+   caller.  */
+
+#ifdef TX_INVOKE_INLINE_INITIALIZATION
+
+/* Yes, in-line initialization is supported, remap the ring
+   initialization function.  */
+
+#define _tx_spsc_ring_initialize() \
+                    _tx_spsc_ring_created_ptr =                   TX_NULL;     \
+                    _tx_spsc_ring_created_count =                 TX_EMPTY
+#define TX_SPSC_RING_INIT
+#else
+
+/* No in-line initialization is supported, use standard function call.  */
+VOID        _tx_spsc_ring_initialize(VOID);
+#endif
+
+
+/* Define internal ring management function prototypes.  */
+
+VOID        _tx_spsc_ring_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+ULONG       _tx_spsc_ring_load(ULONG *source_ptr);
+VOID        _tx_spsc_ring_resume(TX_SPSC_RING *ring_ptr, UINT producer);
+VOID        _tx_spsc_ring_store(ULONG *destination_ptr, ULONG value);
+UINT        _tx_spsc_ring_suspend(TX_SPSC_RING *ring_ptr, UINT producer, ULONG index, ULONG wait_option);
+
+
+/* Ring management component data declarations follow.  */
+
+/* Determine if the initialization function of this component is including
+   this file.  If so, make the data definitions really happen.  Otherwise,
+   make them extern so other functions in the component can access them.  */
+
+#ifdef TX_SPSC_RING_INIT
+#define SPSC_RING_DECLARE
+#else
+#define SPSC_RING_DECLARE extern
+#endif
+
+
+/* Define the head pointer of the created ring list.  */
+
+SPSC_RING_DECLARE  TX_SPSC_RING *    _tx_spsc_ring_created_ptr;
+
+
+/* Define the variable that holds the number of created rings. */
+
+SPSC_RING_DECLARE  ULONG             _tx_spsc_ring_created_count;
+
+
+/* Define default post ring delete macro to whitespace, if it hasn't been defined previously (typically in tx_port.h).  */
+
+#ifndef TX_SPSC_RING_DELETE_PORT_COMPLETION
+#define TX_SPSC_RING_DELETE_PORT_COMPLETION(r)
+#endif
+
+
+#endif
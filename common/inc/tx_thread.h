@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    tx_thread.h                                         PORTABLE C      */
-/*                                                           6.1.9        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -51,6 +51,11 @@
 /*  10-15-2021     Scott Larson             Modified comment(s), improved */
 /*                                            stack check error handling, */
 /*                                            resulting in version 6.1.9  */
+/*  xx-xx-xxxx     Microsoft Corporation    Added thread notification     */
+/*                                            cleanup, added              */
+/*                                            priority-ordered suspension */
+/*                                            list functions, resulting   */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 
@@ -276,6 +281,11 @@
 /* Define internal thread control function prototypes.  */
 
 VOID        _tx_thread_initialize(VOID);
+VOID        _tx_thread_notify_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+VOID        _tx_thread_priority_suspension_insert(TX_THREAD **suspension_list, TX_PRIORITY_SUSPENSION *priority_suspension, TX_THREAD *thread_ptr);
+VOID        _tx_thread_priority_suspension_remove(TX_THREAD *suspension_list, TX_PRIORITY_SUSPENSION *priority_suspension, TX_THREAD *thread_ptr);
+#endif
 VOID        _tx_thread_schedule(VOID);
 VOID        _tx_thread_shell_entry(VOID);
 VOID        _tx_thread_stack_analyze(TX_THREAD *thread_ptr);
@@ -25,7 +25,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    tx_trace.h                                          PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -43,6 +43,27 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added byte pool cache event   */
+/*                                            IDs, added byte reallocate  */
+/*                                            event ID, added bulk block  */
+/*                                            event IDs, added slab pool  */
+/*                                            event IDs, added lock-free  */
+/*                                            block pool event ID, added  */
+/*                                            message buffer event IDs,   */
+/*                                            added zero-copy reserve,    */
+/*                                            commit, acquire and release */
+/*                                            services, added queue send  */
+/*                                            and receive multiple        */
+/*                                            services, added priority    */
+/*                                            queues, added wait sets,    */
+/*                                            added single-producer       */
+/*                                            single-consumer ring event  */
+/*                                            IDs, added queue overwrite  */
+/*                                            send event ID, added thread */
+/*                                            notification event IDs,     */
+/*                                            added semaphore put and get */
+/*                                            count event IDs, resulting  */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 
@@ -193,6 +214,10 @@ typedef struct TX_TRACE_HEADER_STRUCT
 #define TX_TRACE_OBJECT_TYPE_EVENT_FLAGS                    ((UCHAR) 6)     /* none                                              */
 #define TX_TRACE_OBJECT_TYPE_BLOCK_POOL                     ((UCHAR) 7)     /* P1 = total blocks, P2 = block size                */
 #define TX_TRACE_OBJECT_TYPE_BYTE_POOL                      ((UCHAR) 8)     /* P1 = total bytes                                  */
+#define TX_TRACE_OBJECT_TYPE_SLAB_POOL                      ((UCHAR) 9)     /* P1 = total pages, P2 = page size                  */
+#define TX_TRACE_OBJECT_TYPE_MESSAGE_BUFFER                 ((UCHAR) 10)    /* P1 = buffer size                                  */
+#define TX_TRACE_OBJECT_TYPE_WAIT_SET                       ((UCHAR) 11)    /* none                                              */
+#define TX_TRACE_OBJECT_TYPE_SPSC_RING                      ((UCHAR) 12)    /* P1 = capacity, P2 = message size                  */
 
 
 typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
@@ -275,6 +300,8 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_BLOCK_POOL__PERFORMANCE_SYSTEM_INFO_GET    15          /* None                                                                     */
 #define TX_TRACE_BLOCK_POOL_PRIORITIZE                      16          /* I1 = pool ptr, I2 = suspended count, I3 = stack ptr                      */
 #define TX_TRACE_BLOCK_RELEASE                              17          /* I1 = pool ptr, I2 = memory ptr, I3 = suspended, I4 = stack ptr           */
+#define TX_TRACE_BLOCK_ALLOCATE_BULK                        18          /* I1 = pool ptr, I2 = block ptrs, I3 = count, I4 = wait option             */
+#define TX_TRACE_BLOCK_RELEASE_BULK                         19          /* I1 = pool ptr, I2 = block ptrs, I3 = count, I4 = suspended               */
 #define TX_TRACE_BYTE_ALLOCATE                              20          /* I1 = pool ptr, I2 = memory ptr, I3 = size requested, I4 = wait option    */
 #define TX_TRACE_BYTE_POOL_CREATE                           21          /* I1 = pool ptr, I2 = start ptr, I3 = pool size, I4 = stack ptr            */
 #define TX_TRACE_BYTE_POOL_DELETE                           22          /* I1 = pool ptr, I2 = stack ptr                                            */
@@ -283,6 +310,8 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_BYTE_POOL__PERFORMANCE_SYSTEM_INFO_GET     25          /* None                                                                     */
 #define TX_TRACE_BYTE_POOL_PRIORITIZE                       26          /* I1 = pool ptr, I2 = suspended count, I3 = stack ptr                      */
 #define TX_TRACE_BYTE_RELEASE                               27          /* I1 = pool ptr, I2 = memory ptr, I3 = suspended, I4 = available bytes     */
+#define TX_TRACE_BYTE_POOL_CACHE_ENABLE                     28          /* I1 = pool ptr, I2 = blocks per class, I3 = stack ptr                     */
+#define TX_TRACE_BYTE_POOL_CACHE_PERFORMANCE_INFO_GET       29          /* I1 = pool ptr                                                            */
 #define TX_TRACE_EVENT_FLAGS_CREATE                         30          /* I1 = group ptr, I2 = stack ptr                                           */
 #define TX_TRACE_EVENT_FLAGS_DELETE                         31          /* I1 = group ptr, I2 = stack ptr                                           */
 #define TX_TRACE_EVENT_FLAGS_GET                            32          /* I1 = group ptr, I2 = requested flags, I3 = current flags, I4 = get option*/
@@ -349,6 +378,43 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_TIMER_INFO_GET                             127         /* I1 = timer ptr, I2 = stack ptr                                           */
 #define TX_TRACE_TIMER_PERFORMANCE_INFO_GET                 128         /* I1 = timer ptr                                                           */
 #define TX_TRACE_TIMER_PERFORMANCE_SYSTEM_INFO_GET          129         /* None                                                                     */
+#define TX_TRACE_BYTE_REALLOCATE                            130         /* I1 = pool ptr, I2 = memory ptr, I3 = size requested, I4 = wait option    */
+#define TX_TRACE_SLAB_ALLOCATE                              135         /* I1 = pool ptr, I2 = memory ptr, I3 = size requested, I4 = wait option    */
+#define TX_TRACE_SLAB_POOL_CLASS_INFO_GET                   136         /* I1 = pool ptr, I2 = class index                                          */
+#define TX_TRACE_SLAB_POOL_CREATE                           137         /* I1 = pool ptr, I2 = pool_start, I3 = total pages, I4 = page size         */
+#define TX_TRACE_SLAB_POOL_DELETE                           138         /* I1 = pool ptr, I2 = stack ptr                                            */
+#define TX_TRACE_SLAB_POOL_INFO_GET                         139         /* I1 = pool ptr                                                            */
+#define TX_TRACE_SLAB_RELEASE                               140         /* I1 = pool ptr, I2 = memory ptr, I3 = suspended, I4 = available pages     */
+#define TX_TRACE_BLOCK_POOL_LOCK_FREE_ENABLE                141         /* I1 = pool ptr, I2 = available blocks, I3 = stack ptr                     */
+#define TX_TRACE_MESSAGE_BUFFER_CREATE                      142         /* I1 = buffer ptr, I2 = buffer start, I3 = buffer size                     */
+#define TX_TRACE_MESSAGE_BUFFER_DELETE                      143         /* I1 = buffer ptr, I2 = stack ptr                                          */
+#define TX_TRACE_MESSAGE_BUFFER_FLUSH                       144         /* I1 = buffer ptr, I2 = stack ptr                                          */
+#define TX_TRACE_MESSAGE_BUFFER_INFO_GET                    145         /* I1 = buffer ptr                                                          */
+#define TX_TRACE_MESSAGE_BUFFER_PERFORMANCE_INFO_GET        146         /* I1 = buffer ptr                                                          */
+#define TX_TRACE_MESSAGE_BUFFER_PERFORMANCE_SYSTEM_INFO_GET 147         /* None                                                                     */
+#define TX_TRACE_MESSAGE_BUFFER_RECEIVE                     148         /* I1 = buffer ptr, I2 = destination ptr, I3 = wait option, I4 = enqueued   */
+#define TX_TRACE_MESSAGE_BUFFER_SEND                        149         /* I1 = buffer ptr, I2 = source ptr, I3 = size, I4 = wait option            */
+#define TX_TRACE_MESSAGE_BUFFER_SEND_NOTIFY                 150         /* I1 = buffer ptr                                                          */
+#define TX_TRACE_QUEUE_RECEIVE_ACQUIRE                      151         /* I1 = queue ptr, I2 = message ptr ptr, I3 = wait option, I4 = enqueued    */
+#define TX_TRACE_QUEUE_RECEIVE_RELEASE                      152         /* I1 = queue ptr, I2 = message ptr, I3 = acquired, I4 = available          */
+#define TX_TRACE_QUEUE_SEND_COMMIT                          153         /* I1 = queue ptr, I2 = message ptr, I3 = reserved, I4 = enqueued           */
+#define TX_TRACE_QUEUE_SEND_RESERVE                         154         /* I1 = queue ptr, I2 = message ptr ptr, I3 = wait option, I4 = available   */
+#define TX_TRACE_QUEUE_RECEIVE_MULTIPLE                     155         /* I1 = queue ptr, I2 = destination ptr, I3 = count, I4 = enqueued          */
+#define TX_TRACE_QUEUE_SEND_MULTIPLE                        156         /* I1 = queue ptr, I2 = source ptr, I3 = count, I4 = enqueued               */
+#define TX_TRACE_QUEUE_PRIORITY_CREATE                      157         /* I1 = queue ptr, I2 = message size, I3 = queue start, I4 = priorities     */
+#define TX_TRACE_QUEUE_PRIORITY_SEND                        158         /* I1 = queue ptr, I2 = source ptr, I3 = wait option, I4 = priority         */
+#define TX_TRACE_WAIT_SET_CREATE                            159         /* I1 = wait set ptr, I2 = stack ptr                                        */
+#define TX_TRACE_WAIT_SET_DELETE                            160         /* I1 = wait set ptr, I2 = stack ptr                                        */
+#define TX_TRACE_WAIT_SET_ADD                               161         /* I1 = wait set ptr, I2 = object ptr, I3 = object ID, I4 = members         */
+#define TX_TRACE_WAIT_SET_REMOVE                            162         /* I1 = wait set ptr, I2 = object ptr, I3 = members                         */
+#define TX_TRACE_WAIT_SET_WAIT                              163         /* I1 = wait set ptr, I2 = ready object ptr ptr, I3 = wait option           */
+#define TX_TRACE_SPSC_RING_CREATE                           164         /* I1 = ring ptr, I2 = message size, I3 = ring start, I4 = capacity         */
+#define TX_TRACE_SPSC_RING_DELETE                           165         /* I1 = ring ptr, I2 = stack ptr                                            */
+#define TX_TRACE_QUEUE_OVERWRITE_SEND                       166         /* I1 = queue ptr, I2 = source ptr, I3 = enqueued, I4 = available           */
+#define TX_TRACE_THREAD_NOTIFY                              167         /* I1 = thread ptr, I2 = value, I3 = action, I4 = notify value              */
+#define TX_TRACE_THREAD_NOTIFY_WAIT                         168         /* I1 = thread ptr, I2 = exit option, I3 = wait option, I4 = notify value   */
+#define TX_TRACE_SEMAPHORE_PUT_COUNT                        169         /* I1 = semaphore ptr, I2 = count, I3 = current count, I4 = suspended count */
+#define TX_TRACE_SEMAPHORE_GET_COUNT                        170         /* I1 = semaphore ptr, I2 = count, I3 = wait option, I4 = current count     */
 
 
 /* Define the an Trace Buffer Entry.  */
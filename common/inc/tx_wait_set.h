@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_wait_set.h                                       PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX wait set management component,        */
+/*    including all data types and external references.  It is assumed    */
+/*    that tx_api.h and tx_port.h have already been included.             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_WAIT_SET_H
+#define TX_WAIT_SET_H
+
+
+/* Define wait set control specific data definitions.  */
+
+#define TX_WAIT_SET_ID                          ((ULONG) 0x57534554)
+
+
+/* Define the pointer conversion used to access the wait set.  */
+
+#ifndef TX_VOID_TO_WAIT_SET_POINTER_CONVERT
+#define TX_VOID_TO_WAIT_SET_POINTER_CONVERT(a)  ((TX_WAIT_SET *) ((VOID *) (a)))
+#endif
+
+
+/* Determine if in-line component initialization is supported by the
+   caller.  */
+
+#ifdef TX_INVOKE_INLINE_INITIALIZATION
+
+/* Yes, in-line initialization is supported, remap the wait set
+   initialization function.  */
+
+#define _tx_wait_set_initialize() \
+                    _tx_wait_set_created_ptr =                   TX_NULL;     \
+                    _tx_wait_set_created_count =                 TX_EMPTY
+#define TX_WAIT_SET_INIT
+#else
+
+/* No in-line initialization is supported, use standard function call.  */
+VOID        _tx_wait_set_initialize(VOID);
+#endif
+
+
+/* Define internal wait set management function prototypes.  */
+
+VOID        _tx_wait_set_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+UINT        _tx_wait_set_member_add(TX_WAIT_SET *wait_set_ptr, TX_WAIT_SET_MEMBER *member_ptr, VOID *object_ptr, ULONG object_type);
+UINT        _tx_wait_set_member_ready(TX_WAIT_SET_MEMBER *member_ptr);
+VOID        _tx_wait_set_member_remove(TX_WAIT_SET_MEMBER *member_ptr);
+VOID        _tx_wait_set_signal(TX_WAIT_SET_MEMBER *member_ptr);
+
+
+/* Wait set management component data declarations follow.  */
+
+/* Determine if the initialization function of this component is including
+   this file.  If so, make the data definitions really happen.  Otherwise,
+   make them extern so other functions in the component can access them.  */
+
+#ifdef TX_WAIT_SET_INIT
+#define WAIT_SET_DECLARE
+#else
+#define WAIT_SET_DECLARE extern
+#endif
+
+
+/* Define the head pointer of the created wait set list.  */
+
+WAIT_SET_DECLARE  TX_WAIT_SET *     _tx_wait_set_created_ptr;
+
+
+/* Define the variable that holds the number of created wait sets. */
+
+WAIT_SET_DECLARE  ULONG             _tx_wait_set_created_count;
+
+
+/* Define default post wait set delete macro to whitespace, if it hasn't been defined previously (typically in tx_port.h).  */
+
+#ifndef TX_WAIT_SET_DELETE_PORT_COMPLETION
+#define TX_WAIT_SET_DELETE_PORT_COMPLETION(w)
+#endif
+
+
+#endif
@@ -38,7 +38,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_block_allocate                                  PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -61,6 +61,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_block_pool_lock_free_allocate Allocate from lock-free list      */
 /*    _tx_thread_system_suspend         Suspend thread                    */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*                                                                        */
@@ -75,6 +76,10 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added lock-free block pool    */
+/*                                            support, added bulk         */
+/*                                            allocation waiters,         */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_block_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option)
@@ -102,6 +107,19 @@ ULONG                       lower_tbu;
 #endif
 
 
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+    /* Determine if the pool uses the lock-free list.  */
+    if (pool_ptr -> tx_block_pool_lock_free_enabled == TX_TRUE)
+    {
+
+        /* Yes, allocate the block from the lock-free list.  */
+        status =  _tx_block_pool_lock_free_allocate(pool_ptr, block_ptr, wait_option);
+    }
+    else
+    {
+#endif
+
     /* Disable interrupts to get a block from the pool.  */
     TX_DISABLE
 
@@ -252,6 +270,9 @@ ULONG                       lower_tbu;
                 /* Save the return block pointer address as well.  */
                 thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) block_ptr;
 
+                /* Save the number of blocks requested.  */
+                thread_ptr -> tx_thread_suspend_info =  ((ULONG) 1);
+
 #ifndef TX_NOT_INTERRUPTABLE
 
                 /* Increment the suspension sequence number, which is used to identify
@@ -367,6 +388,9 @@ ULONG                       lower_tbu;
             TX_RESTORE
         }
     }
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+    }
+#endif
 
     /* Return completion status.  */
     return(status);
@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_bulk_give                            PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function gives a released block to the thread at the front of  */
+/*    the suspension list of a block pool when that thread is a bulk      */
+/*    allocation that waits for more than one block. The block is stored  */
+/*    in the next return pointer of the thread, which remains suspended.  */
+/*    The last block a thread waits for is not taken here, it is          */
+/*    returned by the caller, which also resumes the thread. This         */
+/*    function is called with interrupts disabled.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Thread at the front of the        */
+/*                                        suspension list, or NULL        */
+/*    block_ptr                         Pointer to the released block     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            TX_TRUE if the block is taken,    */
+/*                                        TX_FALSE otherwise              */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_release  Release to lock-free list         */
+/*    _tx_block_release                 Release a memory block            */
+/*    _tx_block_release_bulk            Release memory blocks             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_pool_bulk_give(TX_THREAD *thread_ptr, VOID *block_ptr)
+{
+
+UINT        status;
+UCHAR       *work_ptr;
+UCHAR       **return_block_ptr;
+
+
+    /* Default to the block not being taken.  */
+    status =  TX_FALSE;
+
+    /* Determine if there is a suspended thread.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Determine if the thread waits for more blocks than this one.  */
+        if (thread_ptr -> tx_thread_suspend_info > ((ULONG) 1))
+        {
+
+            /* Yes, return this block pointer in the next return pointer of the thread.  */
+            return_block_ptr =  TX_VOID_TO_INDIRECT_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            work_ptr =          TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+            *return_block_ptr =  work_ptr;
+
+            /* Move to the following return pointer.  */
+            work_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            work_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(VOID *)));
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) work_ptr;
+
+            /* Decrement the number of blocks the thread still waits for.  */
+            thread_ptr -> tx_thread_suspend_info--;
+
+            /* The block is taken and the thread remains suspended.  */
+            status =  TX_TRUE;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,370 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_release                    PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases a block to its pool if the pool uses the     */
+/*    lock-free list. The block is placed on the list without disabling   */
+/*    interrupts. Only if the pool is marked as having waiting threads    */
+/*    are interrupts disabled, the blocks on the list given to the        */
+/*    suspended threads and the threads resumed.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_ptr                         Pointer to memory block           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Block was released to the lock-   */
+/*                                        free list                       */
+/*    TX_FALSE                          Pool does not use the lock-free   */
+/*                                        list                            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_bulk_give          Give block to bulk allocation     */
+/*    _tx_block_pool_lock_free_compare_swap                               */
+/*                                      Compare and swap, if the port     */
+/*                                        does not provide an atomic      */
+/*                                        operation                       */
+/*    _tx_block_pool_lock_free_pop      Remove block from lock-free list  */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_release                 Release block to pool             */
+/*    _tx_block_allocate_bulk           Bulk block allocate               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+UINT  _tx_block_pool_lock_free_release(VOID *block_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+TX_BLOCK_POOL       *pool_ptr;
+TX_THREAD           *thread_ptr;
+TX_THREAD           *resume_list;
+TX_THREAD           *resume_last;
+UCHAR               *work_ptr;
+UCHAR               *temp_ptr;
+UCHAR               **return_block_ptr;
+UCHAR               **next_block_ptr;
+ULONG               *next_index_ptr;
+ULONG               head;
+ULONG               new_head;
+ULONG               index;
+ULONG               available;
+UINT                suspended_count;
+UINT                done;
+TX_THREAD           *next_thread;
+TX_THREAD           *previous_thread;
+
+
+    /* Pickup the pool pointer which is just previous to the starting
+       address of the block that the caller sees.  */
+    work_ptr =        TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+    work_ptr =        TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+    next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    pool_ptr =        TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT((*next_block_ptr));
+
+    /* Determine if the pool uses the lock-free list.  */
+    if (pool_ptr -> tx_block_pool_lock_free_enabled != TX_TRUE)
+    {
+
+        /* No, the block is released by the caller.  */
+        status =  TX_FALSE;
+    }
+    else
+    {
+
+        /* Increment the number of available blocks.  This is done before the block is
+           placed on the list, so the count never drops below zero.  */
+        do
+        {
+
+            /* Pickup the number of available blocks.  */
+            available =  pool_ptr -> tx_block_pool_lock_free_available;
+
+        } while (TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP(&(pool_ptr -> tx_block_pool_lock_free_available), available, (available + ((ULONG) 1))) != TX_TRUE);
+
+        /* Calculate the index of the block, which starts at one so that zero marks the end of the list.  */
+        index =  (TX_UCHAR_POINTER_DIF(work_ptr, pool_ptr -> tx_block_pool_start) /
+                    ((pool_ptr -> tx_block_pool_block_size) + (sizeof(UCHAR *)))) + ((ULONG) 1);
+
+        /* Place the block at the head of the list.  */
+        next_index_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(work_ptr);
+        do
+        {
+
+            /* Pickup the head of the list.  */
+            head =  pool_ptr -> tx_block_pool_lock_free_head;
+
+            /* Link the block to the current head.  */
+            *next_index_ptr =  head & TX_BLOCK_POOL_LOCK_FREE_INDEX_MASK;
+
+            /* Build the new head, keeping the waiting flag.  */
+            new_head =  index | (head & TX_BLOCK_POOL_LOCK_FREE_WAITING) | TX_BLOCK_POOL_LOCK_FREE_NEXT_TAG(head);
+
+        } while (TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP(&(pool_ptr -> tx_block_pool_lock_free_head), head, new_head) != TX_TRUE);
+
+        /* Determine if threads were waiting for a block.  */
+        if ((head & TX_BLOCK_POOL_LOCK_FREE_WAITING) != ((ULONG) 0))
+        {
+
+            /* Disable interrupts to give blocks to the suspended threads.  */
+            TX_DISABLE
+
+            /* Start with no threads to resume.  */
+            resume_list =  TX_NULL;
+            resume_last =  TX_NULL;
+
+            /* Give blocks from the list to the suspended threads, in the order of the
+               suspension list.  Other contexts may have taken blocks from the list in
+               the meantime, so stop when it is empty.  */
+            done =  TX_FALSE;
+            while (done == TX_FALSE)
+            {
+
+                /* Pickup the thread at the head of the suspension list.  */
+                thread_ptr =  pool_ptr -> tx_block_pool_suspension_list;
+                if (thread_ptr == TX_NULL)
+                {
+
+                    /* No more suspended threads.  */
+                    done =  TX_TRUE;
+                }
+                else
+                {
+
+                    /* Take a block from the list.  */
+                    temp_ptr =  _tx_block_pool_lock_free_pop(pool_ptr, TX_FALSE);
+                    if (temp_ptr == TX_NULL)
+                    {
+
+                        /* No more blocks.  */
+                        done =  TX_TRUE;
+                    }
+
+                    /* Determine if the block is given to a bulk allocation that waits for more blocks.  */
+                    else if (_tx_block_pool_bulk_give(thread_ptr, temp_ptr) == TX_TRUE)
+                    {
+
+                        /* Yes, the thread remains suspended for its remaining blocks.  */
+                    }
+                    else
+                    {
+
+                        /* Remove the suspended thread from the list.  */
+
+                        /* Decrement the number of threads suspended.  */
+                        (pool_ptr -> tx_block_pool_suspended_count)--;
+
+                        /* Pickup the suspended count.  */
+                        suspended_count =  (pool_ptr -> tx_block_pool_suspended_count);
+
+                        /* See if this is the only suspended thread on the list.  */
+                        if (suspended_count == TX_NO_SUSPENSIONS)
+                        {
+
+                            /* Yes, the only suspended thread.  */
+
+                            /* Update the head pointer.  */
+                            pool_ptr -> tx_block_pool_suspension_list =  TX_NULL;
+                        }
+                        else
+                        {
+
+                            /* At least one more thread is on the same expiration list.  */
+
+                            /* Update the list head pointer.  */
+                            next_thread =                                thread_ptr -> tx_thread_suspended_next;
+                            pool_ptr -> tx_block_pool_suspension_list =  next_thread;
+
+                            /* Update the links of the adjacent threads.  */
+                            previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                            next_thread -> tx_thread_suspended_previous =  previous_thread;
+                            previous_thread -> tx_thread_suspended_next =  next_thread;
+                        }
+
+                        /* Prepare for resumption of the thread.  */
+
+                        /* Clear cleanup routine to avoid timeout.  */
+                        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                        /* Return this block pointer to the suspended thread waiting for
+                           a block.  */
+                        return_block_ptr =  TX_VOID_TO_INDIRECT_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                        *return_block_ptr =  temp_ptr;
+
+                        /* Put return status into the thread control block.  */
+                        thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+                        /* Append the thread to the list of threads to resume, which keeps
+                           the order in which the threads were suspended.  */
+                        thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+                        if (resume_list == TX_NULL)
+                        {
+
+                            /* First thread to resume.  */
+                            resume_list =  thread_ptr;
+                        }
+                        else
+                        {
+
+                            /* Link the thread after the last one.  */
+                            resume_last -> tx_thread_suspended_next =  thread_ptr;
+                        }
+                        resume_last =  thread_ptr;
+                    }
+                }
+            }
+
+            /* Determine if all of the suspended threads received a block.  */
+            if (pool_ptr -> tx_block_pool_suspension_list == TX_NULL)
+            {
+
+                /* Yes, clear the waiting flag.  No thread can set it again while
+                   interrupts are disabled here.  */
+                do
+                {
+
+                    /* Pickup the head of the list.  */
+                    head =  pool_ptr -> tx_block_pool_lock_free_head;
+
+                    /* Build the new head without the waiting flag.  */
+                    new_head =  (head & TX_BLOCK_POOL_LOCK_FREE_INDEX_MASK) | TX_BLOCK_POOL_LOCK_FREE_NEXT_TAG(head);
+
+                } while (TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP(&(pool_ptr -> tx_block_pool_lock_free_head), head, new_head) != TX_TRUE);
+            }
+
+            /* Determine if any threads received a block.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Disable preemption until all of the threads are resumed.  */
+                _tx_thread_preempt_disable++;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Walk through the list of threads to resume.  */
+                thread_ptr =  resume_list;
+                while (thread_ptr != TX_NULL)
+                {
+
+                    /* Get next pointer first.  */
+                    next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                    /* Resume the thread!  */
+                    _tx_thread_system_ni_resume(thread_ptr);
+
+                    /* Move next thread to current.  */
+                    thread_ptr =  next_thread;
+                }
+#else
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Walk through the list of threads to resume.  */
+                thread_ptr =  resume_list;
+                while (thread_ptr != TX_NULL)
+                {
+
+                    /* Get next pointer first.  */
+                    next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                    /* Disable interrupts.  */
+                    TX_DISABLE
+
+                    /* Disable preemption again.  */
+                    _tx_thread_preempt_disable++;
+
+                    /* Restore interrupt posture.  */
+                    TX_RESTORE
+
+                    /* Resume the thread.  */
+                    _tx_thread_system_resume(thread_ptr);
+
+                    /* Move next thread to current.  */
+                    thread_ptr =  next_thread;
+                }
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+#endif
+
+                /* Release thread preemption disable.  */
+                _tx_thread_preempt_disable--;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Check for preemption.  */
+                _tx_thread_system_preempt_check();
+            }
+            else
+            {
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
+        }
+
+        /* The block was released to the lock-free list.  */
+        status =  TX_TRUE;
+    }
+
+    /* Return the release status.  */
+    return(status);
+}
+#endif
+
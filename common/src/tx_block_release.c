@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_block_release                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -56,6 +56,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_block_pool_bulk_give          Give block to bulk allocation     */
+/*    _tx_block_pool_lock_free_release  Release to lock-free list         */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*                                                                        */
@@ -70,6 +72,10 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added lock-free block pool    */
+/*                                            support, added bulk         */
+/*                                            allocation waiters,         */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_block_release(VOID *block_ptr)
@@ -87,6 +93,18 @@ TX_THREAD           *next_thread;
 TX_THREAD           *previous_thread;
 
 
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+    /* Determine if the pool of the block uses the lock-free list.  */
+    if (_tx_block_pool_lock_free_release(block_ptr) == TX_TRUE)
+    {
+
+        /* Yes, the block was released without disabling interrupts.  */
+    }
+    else
+    {
+#endif
+
     /* Disable interrupts to put this block back in the pool.  */
     TX_DISABLE
 
@@ -114,7 +132,17 @@ TX_THREAD           *previous_thread;
 
     /* Determine if there are any threads suspended on the block pool.  */
     thread_ptr =  pool_ptr -> tx_block_pool_suspension_list;
-    if (thread_ptr != TX_NULL)
+
+    /* Determine if the block is given to a bulk allocation that waits for more blocks.  */
+    if (_tx_block_pool_bulk_give(thread_ptr, block_ptr) == TX_TRUE)
+    {
+
+        /* Yes, the thread remains suspended for its remaining blocks.  */
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else if (thread_ptr != TX_NULL)
     {
 
         /* Remove the suspended thread from the list.  */
@@ -199,6 +227,9 @@ TX_THREAD           *previous_thread;
         /* Restore interrupts.  */
         TX_RESTORE
     }
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+    }
+#endif
 
     /* Return successful completion status.  */
     return(TX_SUCCESS);
@@ -0,0 +1,351 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_release_bulk                              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the specified blocks to the pools they were   */
+/*    allocated from under a single interrupt lockout. Blocks released    */
+/*    to a pool with suspended threads are given to these threads in the  */
+/*    order in which they suspended, and all resumed threads are made     */
+/*    ready before preemption is checked.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_ptrs                        Array of pointers to the blocks   */
+/*    count                             Number of blocks to release       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_bulk_give          Give block to bulk allocation     */
+/*    _tx_block_release                 Release block to pool             */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_block_release_bulk           Error checking function           */
+/*    _tx_block_allocate_bulk           Bulk block allocate               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_release_bulk(VOID **block_ptrs, UINT count)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                index;
+TX_BLOCK_POOL       *pool_ptr;
+TX_THREAD           *thread_ptr;
+TX_THREAD           *resume_list;
+TX_THREAD           *resume_last;
+UCHAR               *work_ptr;
+UCHAR               **return_block_ptr;
+UCHAR               **next_block_ptr;
+UINT                suspended_count;
+TX_THREAD           *next_thread;
+TX_THREAD           *previous_thread;
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+UINT                lock_free;
+#endif
+
+
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+    /* Determine if any of the blocks belongs to a pool that uses the lock-free list.  */
+    lock_free =  TX_FALSE;
+    for (index =  ((UINT) 0); index < count; index++)
+    {
+
+        /* Pickup the pool pointer which is just previous to the starting
+           address of the block that the caller sees.  */
+        work_ptr =        TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptrs[index]);
+        work_ptr =        TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+        next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        pool_ptr =        TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT((*next_block_ptr));
+
+        /* Check the pool of this block.  */
+        if (pool_ptr -> tx_block_pool_lock_free_enabled == TX_TRUE)
+        {
+
+            /* Yes, the blocks are released one at a time.  */
+            lock_free =  TX_TRUE;
+        }
+    }
+
+    /* Determine if the blocks are released one at a time.  */
+    if (lock_free == TX_TRUE)
+    {
+
+        /* Release each of the blocks to its pool.  */
+        for (index =  ((UINT) 0); index < count; index++)
+        {
+
+            /* Release this block.  */
+            (VOID) _tx_block_release(block_ptrs[index]);
+        }
+    }
+    else
+    {
+#endif
+
+    /* Disable interrupts to put these blocks back in their pools.  */
+    TX_DISABLE
+
+    /* Pickup the pool pointer of the first block, which is just previous to the
+       starting address of the block that the caller sees.  */
+    work_ptr =        TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptrs[0]);
+    work_ptr =        TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+    next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    pool_ptr =        TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT((*next_block_ptr));
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total releases counter.  */
+    _tx_block_pool_performance_release_count =  _tx_block_pool_performance_release_count + ((ULONG) count);
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_RELEASE_BULK, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(block_ptrs), count, pool_ptr -> tx_block_pool_suspended_count, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Start with no threads to resume.  */
+    resume_list =  TX_NULL;
+    resume_last =  TX_NULL;
+
+    /* Release each of the blocks.  */
+    for (index =  ((UINT) 0); index < count; index++)
+    {
+
+        /* Pickup the pool pointer which is just previous to the starting
+           address of the block that the caller sees.  */
+        work_ptr =        TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptrs[index]);
+        work_ptr =        TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+        next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        pool_ptr =        TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT((*next_block_ptr));
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the number of releases on this pool.  */
+        pool_ptr -> tx_block_pool_performance_release_count++;
+#endif
+
+        /* Determine if there are any threads suspended on the block pool.  */
+        thread_ptr =  pool_ptr -> tx_block_pool_suspension_list;
+
+        /* Determine if the block is given to a bulk allocation that waits for more blocks.  */
+        if (_tx_block_pool_bulk_give(thread_ptr, block_ptrs[index]) == TX_TRUE)
+        {
+
+            /* Yes, the thread remains suspended for its remaining blocks.  */
+        }
+        else if (thread_ptr != TX_NULL)
+        {
+
+            /* Remove the suspended thread from the list.  */
+
+            /* Decrement the number of threads suspended.  */
+            (pool_ptr -> tx_block_pool_suspended_count)--;
+
+            /* Pickup the suspended count.  */
+            suspended_count =  (pool_ptr -> tx_block_pool_suspended_count);
+
+            /* See if this is the only suspended thread on the list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                pool_ptr -> tx_block_pool_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same expiration list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                                thread_ptr -> tx_thread_suspended_next;
+                pool_ptr -> tx_block_pool_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+            }
+
+            /* Prepare for resumption of the thread.  */
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Return this block pointer to the suspended thread waiting for
+               a block.  */
+            return_block_ptr =  TX_VOID_TO_INDIRECT_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            work_ptr =          TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptrs[index]);
+            *return_block_ptr =  work_ptr;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Append the thread to the list of threads to resume, which keeps
+               the order in which the threads were suspended.  */
+            thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+            if (resume_list == TX_NULL)
+            {
+
+                /* First thread to resume.  */
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the thread after the last one.  */
+                resume_last -> tx_thread_suspended_next =  thread_ptr;
+            }
+            resume_last =  thread_ptr;
+        }
+        else
+        {
+
+            /* No thread is suspended for a memory block.  */
+
+            /* Put the block back in the available list.  */
+            *next_block_ptr =  pool_ptr -> tx_block_pool_available_list;
+
+            /* Adjust the head pointer.  */
+            pool_ptr -> tx_block_pool_available_list =  work_ptr;
+
+            /* Increment the count of available blocks.  */
+            pool_ptr -> tx_block_pool_available++;
+        }
+    }
+
+    /* Determine if any threads received a block.  */
+    if (resume_list != TX_NULL)
+    {
+
+        /* Disable preemption until all of the threads are resumed.  */
+        _tx_thread_preempt_disable++;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Walk through the list of threads to resume.  */
+        thread_ptr =  resume_list;
+        while (thread_ptr != TX_NULL)
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Move next thread to current.  */
+            thread_ptr =  next_thread;
+        }
+#else
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Walk through the list of threads to resume.  */
+        thread_ptr =  resume_list;
+        while (thread_ptr != TX_NULL)
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupt posture.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr);
+
+            /* Move next thread to current.  */
+            thread_ptr =  next_thread;
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+#endif
+
+        /* Release thread preemption disable.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+    }
+#endif
+
+    /* Return successful completion status.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,547 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#ifdef TX_ENABLE_EVENT_TRACE
+#include "tx_trace.h"
+#endif
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_allocate_aligned                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates bytes from the specified memory byte pool.  */
+/*    The memory returned is aligned to the specified power-of-two        */
+/*    alignment. The leading space needed to align the memory is split    */
+/*    off in the search of the pool and left in the pool as a free        */
+/*    block, so the memory can be released with the regular byte release  */
+/*    service.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    memory_ptr                        Pointer to place allocated bytes  */
+/*                                        pointer                         */
+/*    memory_size                       Number of bytes to allocate       */
+/*    alignment                         Required alignment of the memory, */
+/*                                        a power of two                  */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_suspend         Suspend thread service            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*    _tx_byte_pool_search              Search byte pool for memory       */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
+/*    _tx_byte_pool_coalesce_search     Search coalescing pool for memory */
+/*    _tx_byte_pool_cache_get           Get block from size-class cache   */
+/*    _tx_byte_pool_cache_flush         Return cached blocks to the pool  */
+/*    _tx_byte_pool_waiter_insert       Add thread to size-class list     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_allocate_aligned(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
+                                ULONG alignment, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                        status;
+TX_THREAD                   *thread_ptr;
+UCHAR                       *work_ptr;
+UINT                        suspended_count;
+TX_THREAD                   *next_thread;
+TX_THREAD                   *previous_thread;
+UINT                        finished;
+UINT                        restart_count;
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+UINT                        hold_ownership;
+#endif
+#ifdef TX_ENABLE_EVENT_TRACE
+TX_TRACE_BUFFER_ENTRY       *entry_ptr;
+ULONG                       time_stamp =  ((ULONG) 0);
+#endif
+#ifdef TX_ENABLE_EVENT_LOGGING
+UCHAR                       *log_entry_ptr;
+ULONG                       upper_tbu;
+ULONG                       lower_tbu;
+#endif
+
+
+    /* Round the memory size up to the next size that is evenly divisible by
+       an ALIGN_TYPE (this is typically a 32-bit ULONG).  This guarantees proper alignment.  */
+    memory_size = (((memory_size + (sizeof(ALIGN_TYPE)))-((ALIGN_TYPE) 1))/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+    /* Determine if the alignment is already guaranteed by the format of the pool.  */
+    if (alignment <= ((ULONG) (sizeof(ALIGN_TYPE))))
+    {
+
+        /* Yes, no additional alignment is required.  */
+        alignment =  ((ULONG) 0);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total allocations counter.  */
+    _tx_byte_pool_performance_allocate_count++;
+
+    /* Increment the number of allocations on this pool.  */
+    pool_ptr -> tx_byte_pool_performance_allocate_count++;
+#endif
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+    /* If trace is enabled, save the current event pointer.  */
+    entry_ptr =  _tx_trace_buffer_current_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_ALLOCATE, pool_ptr, 0, memory_size, wait_option, TX_TRACE_BYTE_POOL_EVENTS)
+
+    /* Save the time stamp for later comparison to verify that
+       the event hasn't been overwritten by the time the allocate
+       call succeeds.  */
+    if (entry_ptr != TX_NULL)
+    {
+
+        time_stamp =  entry_ptr -> tx_trace_buffer_entry_time_stamp;
+    }
+#endif
+
+#ifdef TX_ENABLE_EVENT_LOGGING
+    log_entry_ptr =  *(UCHAR **) _tx_el_current_event;
+
+    /* Log this kernel call.  */
+    TX_EL_BYTE_ALLOCATE_INSERT
+
+    /* Store -1 in the fourth event slot.  */
+    *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_4_OFFSET)) =  (ULONG) -1;
+
+    /* Save the time stamp for later comparison to verify that
+       the event hasn't been overwritten by the time the allocate
+       call succeeds.  */
+    lower_tbu =  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_LOWER_OFFSET));
+    upper_tbu =  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_UPPER_OFFSET));
+#endif
+
+    /* Set the search finished flag to false.  */
+    finished =  TX_FALSE;
+
+    /* Clear the number of search restarts of this allocation.  */
+    restart_count =  ((UINT) 0);
+
+    /* Clear the work pointer.  */
+    work_ptr =  TX_NULL;
+
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+
+    /* Determine if the request has the default alignment of cached blocks.  */
+    if (alignment == ((ULONG) 0))
+    {
+
+        /* Attempt to satisfy the request from the size-class cache of the pool.  */
+        work_ptr =  _tx_byte_pool_cache_get(pool_ptr, &memory_size);
+        if (work_ptr != TX_NULL)
+        {
+
+            /* Yes, the cache held a block, the search is finished.  */
+            finished =  TX_TRUE;
+        }
+    }
+#endif
+
+    /* Loop to handle cases where the owner of the pool changed.  */
+    while (finished == TX_FALSE)
+    {
+
+        /* Indicate that this thread is the current owner.  */
+        pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+        /* Determine if the searches of this allocation have been restarted too many times.  */
+        hold_ownership =  TX_FALSE;
+        if (restart_count >= ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+        {
+
+            /* Yes, disable preemption until the outcome of the search is checked below,
+               so that no other thread can take over the pool in between.  */
+            _tx_thread_preempt_disable++;
+            hold_ownership =  TX_TRUE;
+        }
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* At this point, the executing thread owns the pool and can perform a search
+           for free memory.  Determine which allocation policy the pool uses.  */
+        if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_TLSF)
+        {
+
+            /* Search the TLSF index for free memory.  */
+            work_ptr =  _tx_byte_pool_tlsf_search(pool_ptr, memory_size, alignment);
+        }
+        else if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT_COALESCE)
+        {
+
+            /* Search the pool for the first free block that is large enough.  */
+            work_ptr =  _tx_byte_pool_coalesce_search(pool_ptr, memory_size, alignment);
+        }
+        else
+        {
+
+            /* Search the pool for the first block that is large enough.  */
+            work_ptr =  _tx_byte_pool_search(pool_ptr, memory_size, alignment, &restart_count);
+        }
+
+        /* Optional processing extension.  */
+        TX_BYTE_ALLOCATE_EXTENSION
+
+        /* Lockout interrupts.  */
+        TX_DISABLE
+
+        /* Determine if we are finished.  */
+        if (work_ptr != TX_NULL)
+        {
+
+            /* Yes, we have found a block the search is finished.  */
+            finished =  TX_TRUE;
+        }
+        else
+        {
+
+            /* No block was found, does this thread still own the pool?  */
+            if (pool_ptr -> tx_byte_pool_owner == thread_ptr)
+            {
+
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+
+                /* Yes, return any cached blocks to the pool and search again.  If the
+                   cache was empty, we have looked through the entire pool and haven't
+                   found the memory.  */
+                if (_tx_byte_pool_cache_flush(pool_ptr) == ((UINT) 0))
+                {
+
+                    /* The search is finished.  */
+                    finished =  TX_TRUE;
+                }
+#else
+
+                /* Yes, then we have looked through the entire pool and haven't found the memory.  */
+                finished =  TX_TRUE;
+#endif
+            }
+        }
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+        /* Determine if preemption was disabled for this search.  */
+        if (hold_ownership == TX_TRUE)
+        {
+
+            /* Release the temporary preemption disable.  */
+            _tx_thread_preempt_disable--;
+        }
+#endif
+    }
+
+    /* Copy the pointer into the return destination.  */
+    *memory_ptr =  (VOID *) work_ptr;
+
+    /* Determine if memory was found.  */
+    if (work_ptr != TX_NULL)
+    {
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+        /* Check that the event time stamp is unchanged.  A different
+           timestamp means that a later event wrote over the byte
+           allocate event.  In that case, do nothing here.  */
+        if (entry_ptr != TX_NULL)
+        {
+
+            /* Is the timestamp the same?  */
+            if (time_stamp == entry_ptr -> tx_trace_buffer_entry_time_stamp)
+            {
+
+                /* Timestamp is the same, update the entry with the address.  */
+#ifdef TX_MISRA_ENABLE
+                entry_ptr -> tx_trace_buffer_entry_info_2 =  TX_POINTER_TO_ULONG_CONVERT(*memory_ptr);
+#else
+                entry_ptr -> tx_trace_buffer_entry_information_field_2 =  TX_POINTER_TO_ULONG_CONVERT(*memory_ptr);
+#endif
+            }
+        }
+#endif
+
+#ifdef TX_ENABLE_EVENT_LOGGING
+        /* Check that the event time stamp is unchanged.  A different
+           timestamp means that a later event wrote over the byte
+           allocate event.  In that case, do nothing here.  */
+        if (lower_tbu ==  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_LOWER_OFFSET)) &&
+            upper_tbu ==  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_UPPER_OFFSET)))
+        {
+            /* Store the address of the allocated fragment.  */
+            *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_4_OFFSET)) =  (ULONG) *memory_ptr;
+        }
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+        /* Check for preemption deferred while preemption was disabled for a search.  */
+        if (restart_count >= ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+        {
+
+            _tx_thread_system_preempt_check();
+        }
+#endif
+
+        /* Set the status to success.  */
+        status =  TX_SUCCESS;
+    }
+    else
+    {
+
+        /* No memory of sufficient size was found...  */
+
+        /* Determine if the request specifies suspension.  */
+        if (wait_option != TX_NO_WAIT)
+        {
+
+            /* Determine if the preempt disable flag is non-zero.  */
+            if (_tx_thread_preempt_disable != ((UINT) 0))
+            {
+
+                /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+                status =  TX_NO_MEMORY;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+                /* Check for preemption deferred while preemption was disabled for a search.  */
+                if (restart_count >= ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+                {
+
+                    _tx_thread_system_preempt_check();
+                }
+#endif
+            }
+            else
+            {
+
+                /* Prepare for suspension of this thread.  */
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total suspensions counter.  */
+                _tx_byte_pool_performance_suspension_count++;
+
+                /* Increment the number of suspensions on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_suspension_count++;
+#endif
+
+                /* Setup cleanup routine pointer.  */
+                thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_byte_pool_cleanup);
+
+                /* Setup cleanup information, i.e. this pool control
+                   block.  */
+                thread_ptr -> tx_thread_suspend_control_block =  (VOID *) pool_ptr;
+
+                /* Save the return memory pointer address as well.  */
+                thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) memory_ptr;
+
+                /* Save the byte size requested.  */
+                thread_ptr -> tx_thread_suspend_info =  memory_size;
+
+                /* Save the alignment requested.  */
+                thread_ptr -> tx_thread_suspend_option =  (UINT) alignment;
+
+                /* Add the thread to the list of the size class of its request.  */
+                _tx_byte_pool_waiter_insert(pool_ptr, thread_ptr);
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+                /* Increment the suspension sequence number, which is used to identify
+                   this suspension event.  */
+                thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+                /* Pickup the number of suspended threads.  */
+                suspended_count =  pool_ptr -> tx_byte_pool_suspended_count;
+
+                /* Increment the suspension count.  */
+                (pool_ptr -> tx_byte_pool_suspended_count)++;
+
+                /* Setup suspension list.  */
+                if (suspended_count == TX_NO_SUSPENSIONS)
+                {
+
+                    /* No other threads are suspended.  Setup the head pointer and
+                       just setup this threads pointers to itself.  */
+                    pool_ptr -> tx_byte_pool_suspension_list =      thread_ptr;
+                    thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                    thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+                }
+                else
+                {
+
+                    /* This list is not NULL, add current thread to the end. */
+                    next_thread =                                   pool_ptr -> tx_byte_pool_suspension_list;
+                    thread_ptr -> tx_thread_suspended_next =        next_thread;
+                    previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                    thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                    previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                    next_thread -> tx_thread_suspended_previous =   thread_ptr;
+                }
+
+                /* Set the state to suspended.  */
+                thread_ptr -> tx_thread_state =       TX_BYTE_MEMORY;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Call actual non-interruptable thread suspension routine.  */
+                _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#else
+
+                /* Set the suspending flag.  */
+                thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+                /* Setup the timeout period.  */
+                thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+                /* Temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Call actual thread suspension routine.  */
+                _tx_thread_system_suspend(thread_ptr);
+#endif
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+                /* Check that the event time stamp is unchanged.  A different
+                   timestamp means that a later event wrote over the byte
+                   allocate event.  In that case, do nothing here.  */
+                if (entry_ptr != TX_NULL)
+                {
+
+                    /* Is the timestamp the same?  */
+                    if (time_stamp == entry_ptr -> tx_trace_buffer_entry_time_stamp)
+                    {
+
+                        /* Timestamp is the same, update the entry with the address.  */
+#ifdef TX_MISRA_ENABLE
+                        entry_ptr -> tx_trace_buffer_entry_info_2 =  TX_POINTER_TO_ULONG_CONVERT(*memory_ptr);
+#else
+                       entry_ptr -> tx_trace_buffer_entry_information_field_2 =  TX_POINTER_TO_ULONG_CONVERT(*memory_ptr);
+#endif
+                    }
+                }
+#endif
+
+#ifdef TX_ENABLE_EVENT_LOGGING
+                /* Check that the event time stamp is unchanged.  A different
+                   timestamp means that a later event wrote over the byte
+                   allocate event.  In that case, do nothing here.  */
+                if (lower_tbu ==  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_LOWER_OFFSET)) &&
+                    upper_tbu ==  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_UPPER_OFFSET)))
+                {
+
+                    /* Store the address of the allocated fragment.  */
+                    *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_4_OFFSET)) =  (ULONG) *memory_ptr;
+                }
+#endif
+
+                /* Return the completion status.  */
+                status =  thread_ptr -> tx_thread_suspend_status;
+            }
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+            /* Check for preemption deferred while preemption was disabled for a search.  */
+            if (restart_count >= ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+            {
+
+                _tx_thread_system_preempt_check();
+            }
+#endif
+
+            /* Immediate return, return error completion.  */
+            status =  TX_NO_MEMORY;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,175 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_cache_flush                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns every block held in the size-class cache of   */
+/*    the byte pool to the pool, using the release processing of the      */
+/*    pool's allocation policy. The calling thread is made the owner of   */
+/*    the pool so that any search in progress by another thread is        */
+/*    restarted.                                                          */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    flushed                           Number of blocks returned to the  */
+/*                                        pool                            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_release        Release a block of a TLSF pool    */
+/*    _tx_byte_pool_coalesce_release    Release a block of a coalescing   */
+/*                                        first-fit pool                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*    _tx_byte_pool_cache_enable        Enable byte pool cache            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+UINT  _tx_byte_pool_cache_flush(TX_BYTE_POOL *pool_ptr)
+{
+
+UINT            flushed;
+UINT            class_index;
+TX_THREAD       *thread_ptr;
+UCHAR           *block_ptr;
+UCHAR           *work_ptr;
+UCHAR           *next_block_ptr;
+UCHAR           **block_link_ptr;
+UCHAR           **cache_link_ptr;
+ALIGN_TYPE      *free_ptr;
+
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Indicate that this thread is the current owner.  */
+    pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+    /* Clear the number of flushed blocks.  */
+    flushed =  ((UINT) 0);
+
+    /* Loop through all the classes of the cache.  */
+    for (class_index =  ((UINT) 0); class_index < TX_BYTE_POOL_CACHE_CLASSES; class_index++)
+    {
+
+        /* Pickup the first block of this class.  */
+        block_ptr =  pool_ptr -> tx_byte_pool_cache_list[class_index];
+
+        /* Release each block of the class.  */
+        while (block_ptr != TX_NULL)
+        {
+
+            /* Pickup the next cached block before the block is released.  */
+            work_ptr =        TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+            cache_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            next_block_ptr =  *cache_link_ptr;
+
+            /* Determine which allocation policy the pool uses.  */
+            if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_TLSF)
+            {
+
+                /* Release the memory and merge it with its free neighbors.  */
+                (VOID) _tx_byte_pool_tlsf_release(pool_ptr, block_ptr);
+            }
+            else if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT_COALESCE)
+            {
+
+                /* Release the memory and merge it with its free neighbors.  */
+                (VOID) _tx_byte_pool_coalesce_release(pool_ptr, block_ptr);
+            }
+            else
+            {
+
+                /* Release the memory.  */
+                work_ptr =   TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+                free_ptr =   TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+                *free_ptr =  TX_BYTE_BLOCK_FREE;
+
+                /* Update the number of available bytes in the pool.  */
+                block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+                work_ptr =        *block_link_ptr;
+                pool_ptr -> tx_byte_pool_available =
+                    pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(work_ptr, block_ptr);
+
+                /* Add the block to the fragmentation information.  */
+                TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, block_ptr)
+
+                /* Determine if the free block is prior to current search pointer.  */
+                if (block_ptr < (pool_ptr -> tx_byte_pool_search))
+                {
+
+                    /* Yes, update the search pointer to the released block.  */
+                    pool_ptr -> tx_byte_pool_search =  block_ptr;
+                }
+            }
+
+            /* Increment the number of flushed blocks.  */
+            flushed++;
+
+            /* Move to the next cached block.  */
+            block_ptr =  next_block_ptr;
+        }
+
+        /* The class is now empty.  */
+        pool_ptr -> tx_byte_pool_cache_list[class_index] =   TX_NULL;
+        pool_ptr -> tx_byte_pool_cache_count[class_index] =  ((UINT) 0);
+    }
+
+    /* Return the number of blocks flushed.  */
+    return(flushed);
+}
+#endif
+
@@ -0,0 +1,379 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_coalesce_search                       PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function searches a byte pool that uses the coalescing first-  */
+/*    fit policy for a memory block to satisfy the requested number of    */
+/*    bytes. Since free blocks of this pool are merged with their         */
+/*    neighbors when they are released, a free block is always followed   */
+/*    by an allocated block and no merging takes place during the         */
+/*    search. A split of the block that satisfies the request may occur   */
+/*    before this function returns.                                       */
+/*    If an alignment is specified, the leading space needed to align the */
+/*    memory is split off and left in the pool as a free block.           */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts enabled  */
+/*    and with the tx_pool_owner field set to the thread performing the   */
+/*    search. Also note that the search can occur during allocation and   */
+/*    release of a memory block.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    memory_size                       Number of bytes required          */
+/*    alignment                         Required alignment of the memory, */
+/*                                        zero for the default alignment  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    UCHAR *                           Pointer to the allocated memory,  */
+/*                                        if successful.  Otherwise, a    */
+/*                                        NULL is returned                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_boundary_tag_split  Split block of boundary tag pool  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_coalesce_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UCHAR           *current_ptr;
+UCHAR           *next_ptr;
+UCHAR           *split_ptr;
+UCHAR           **this_block_link_ptr;
+UCHAR           **next_block_link_ptr;
+ULONG           available_bytes;
+ULONG           aligned_offset =  ((ULONG) 0);
+UINT            examine_blocks;
+UINT            first_free_block_found =  TX_FALSE;
+TX_THREAD       *thread_ptr;
+ALIGN_TYPE      *free_ptr;
+UCHAR           *work_ptr;
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+UINT            restart_count =  ((UINT) 0);
+#endif
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+ULONG           blocks_examined =  ((ULONG) 0);
+#endif
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* First, determine if there are enough bytes in the pool.  Free blocks are never
+       adjacent, so there are no headers of mergeable blocks to account for.  */
+    if (memory_size >= pool_ptr -> tx_byte_pool_available)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Not enough memory, return a NULL pointer.  */
+        current_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Pickup thread pointer.  */
+        TX_THREAD_GET_CURRENT(thread_ptr)
+
+        /* Setup ownership of the byte pool.  */
+        pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+        /* Walk through the memory pool in search for a large enough block.  */
+        current_ptr =      pool_ptr -> tx_byte_pool_search;
+        examine_blocks =   pool_ptr -> tx_byte_pool_fragments + ((UINT) 1);
+        available_bytes =  ((ULONG) 0);
+        do
+        {
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total fragment search counter.  */
+            _tx_byte_pool_performance_search_count++;
+
+            /* Increment the number of fragments searched on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_search_count++;
+
+            /* Increment the number of blocks examined by this search.  */
+            blocks_examined++;
+#endif
+
+            /* Pickup the next block's pointer.  */
+            this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+            next_ptr =             *this_block_link_ptr;
+
+            /* Check to see if this block is free.  */
+            work_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, (sizeof(UCHAR *)));
+            free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+            if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+            {
+
+                /* Determine if this is the first free block.  */
+                if (first_free_block_found == TX_FALSE)
+                {
+                    /* This is the first free block.  */
+                    pool_ptr -> tx_byte_pool_search =  current_ptr;
+
+                    /* Set the flag to indicate we have found the first free
+                       block.  */
+                    first_free_block_found =  TX_TRUE;
+                }
+
+                /* Block is free, calculate the number of bytes available in this block.  */
+                available_bytes =   TX_UCHAR_POINTER_DIF(next_ptr, current_ptr);
+                available_bytes =   available_bytes - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+
+                /* Determine how far into this block the memory must start to meet the alignment.  */
+                if (alignment != ((ULONG) 0))
+                {
+
+                    TX_BYTE_POOL_ALIGNED_OFFSET_CALCULATE(current_ptr, alignment, (((ULONG) TX_BYTE_BLOCK_MIN) + TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD), aligned_offset)
+                }
+
+                /* If this is large enough, we are done because our first-fit algorithm
+                   has been satisfied!  */
+                if (available_bytes >= (memory_size + aligned_offset))
+                {
+                    /* Get out of the search loop!  */
+                    break;
+                }
+
+                /* Clear the available bytes variable.  */
+                available_bytes =  ((ULONG) 0);
+            }
+
+            /* Move to the next block.  */
+            current_ptr =  next_ptr;
+
+            /* Another block has been searched... decrement counter.  */
+            if (examine_blocks != ((UINT) 0))
+            {
+
+                examine_blocks--;
+            }
+
+            /* Restore interrupts temporarily.  */
+            TX_RESTORE
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Determine if anything has changed in terms of pool ownership.  */
+            if (pool_ptr -> tx_byte_pool_owner != thread_ptr)
+            {
+
+                /* Pool changed ownership in the brief period interrupts were
+                   enabled.  Reset the search.  */
+                current_ptr =      pool_ptr -> tx_byte_pool_search;
+                examine_blocks =   pool_ptr -> tx_byte_pool_fragments + ((UINT) 1);
+
+                /* Setup our ownership again.  */
+                pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of search restarts on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_search_restart_count++;
+#endif
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+                /* Increment the number of restarts of this search.  */
+                restart_count++;
+
+                /* Determine if the search has been restarted too many times.  */
+                if (restart_count == ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+                {
+
+                    /* Yes, disable preemption so that no other thread can take over the pool.
+                       The remainder of the search examines each block at most once.  */
+                    _tx_thread_preempt_disable++;
+                }
+#endif
+            }
+        } while(examine_blocks != ((UINT) 0));
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Update the maximum number of blocks examined by a single search of this pool.  */
+        if (blocks_examined > pool_ptr -> tx_byte_pool_performance_search_max_count)
+        {
+
+            pool_ptr -> tx_byte_pool_performance_search_max_count =  blocks_examined;
+        }
+#endif
+
+        /* Determine if a block was found.  If so, determine if it needs to be
+           split.  */
+        if (available_bytes != ((ULONG) 0))
+        {
+
+            /* Remove the block from the fragmentation information.  */
+            TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, current_ptr)
+
+            /* Determine if the memory must start further into the block to meet the alignment.  */
+            if (aligned_offset != ((ULONG) 0))
+            {
+
+                /* Yes, split the leading space off as a free block and continue with the
+                   aligned block.  */
+                split_ptr =            _tx_byte_pool_boundary_tag_split(pool_ptr, current_ptr, aligned_offset);
+                TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, current_ptr)
+                current_ptr =          split_ptr;
+                this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+                available_bytes =      available_bytes - aligned_offset;
+            }
+
+            /* Determine if we need to split this block.  */
+            if ((available_bytes - memory_size) >= (((ULONG) TX_BYTE_BLOCK_MIN) + TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD))
+            {
+
+                /* Split the block.  */
+                split_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, (memory_size + TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD));
+
+                /* Setup the new free block.  */
+                next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(split_ptr);
+                *next_block_link_ptr =  next_ptr;
+                work_ptr =              TX_UCHAR_POINTER_SUB(split_ptr, (sizeof(UCHAR *)));
+                next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                *next_block_link_ptr =  current_ptr;
+                work_ptr =              TX_UCHAR_POINTER_ADD(split_ptr, (sizeof(UCHAR *)));
+                free_ptr =              TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+                *free_ptr =             TX_BYTE_BLOCK_FREE;
+
+                /* Update the previous block pointer of the following block.  */
+                work_ptr =              TX_UCHAR_POINTER_SUB(next_ptr, (sizeof(UCHAR *)));
+                next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                *next_block_link_ptr =  split_ptr;
+
+                /* Increase the total fragment counter.  */
+                pool_ptr -> tx_byte_pool_fragments++;
+
+                /* Update the current pointer to point at the newly created block.  */
+                *this_block_link_ptr =  split_ptr;
+                TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, split_ptr)
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total split counter.  */
+                _tx_byte_pool_performance_split_count++;
+
+                /* Increment the number of blocks split on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+            }
+
+            /* In any case, mark the current block as allocated.  */
+            work_ptr =              TX_UCHAR_POINTER_ADD(current_ptr, (sizeof(UCHAR *)));
+            this_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *this_block_link_ptr =  TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+
+            /* Reduce the number of available bytes in the pool.  */
+            this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+            pool_ptr -> tx_byte_pool_available =  pool_ptr -> tx_byte_pool_available - TX_UCHAR_POINTER_DIF(*this_block_link_ptr, current_ptr);
+
+            /* Determine if the search pointer needs to be updated. This is only done
+               if the search pointer matches the block to be returned.  */
+            if (current_ptr == pool_ptr -> tx_byte_pool_search)
+            {
+
+                /* Yes, update the search pointer to the next block.  */
+                pool_ptr -> tx_byte_pool_search =  *this_block_link_ptr;
+            }
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Adjust the pointer for the application.  */
+            current_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)))));
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Set current pointer to NULL to indicate nothing was found.  */
+            current_ptr =  TX_NULL;
+        }
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+        /* Determine if preemption was disabled during this search.  */
+        if (restart_count == ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+        {
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Release the temporary preemption disable.  */
+            _tx_thread_preempt_disable--;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Check for preemption.  */
+            _tx_thread_system_preempt_check();
+        }
+#endif
+    }
+
+    /* Return the search pointer.  */
+    return(current_ptr);
+}
+
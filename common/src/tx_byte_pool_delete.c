@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_byte_pool_delete                                PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -76,6 +76,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added size-class waiter       */
+/*                                            lists, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_byte_pool_delete(TX_BYTE_POOL *pool_ptr)
@@ -144,6 +147,7 @@ TX_BYTE_POOL    *previous_pool;
     pool_ptr -> tx_byte_pool_suspension_list =  TX_NULL;
     suspended_count =                           pool_ptr -> tx_byte_pool_suspended_count;
     pool_ptr -> tx_byte_pool_suspended_count =  TX_NO_SUSPENSIONS;
+    pool_ptr -> tx_byte_pool_suspended_size_map =  ((ULONG) 0);
 
     /* Restore interrupts.  */
     TX_RESTORE
@@ -0,0 +1,229 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_fragmentation_info_get                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the fragmentation information of the        */
+/*    specified byte pool, namely the size of the largest free block,     */
+/*    the fragmentation index and the free block size histogram. The      */
+/*    information is maintained as blocks are split, merged, allocated    */
+/*    and released, so no walk of the pool is needed.                     */
+/*                                                                        */
+/*    The fragmentation index is the percentage of the free bytes that    */
+/*    are not in the largest free block, where 0 means all free memory    */
+/*    is in one block. Entry 0 of the histogram counts the free blocks    */
+/*    of less than 32 bytes and entry n counts the free blocks of 16 *    */
+/*    2^n up to 32 * 2^n bytes, with the last entry also counting all     */
+/*    larger blocks.                                                      */
+/*                                                                        */
+/*    When the largest free block is allocated, the size of the next      */
+/*    largest free block is not known until a block of at least that      */
+/*    size is freed. Until then, the lowest size of the largest non-      */
+/*    empty histogram entry is returned, which is always available.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to byte pool control block*/
+/*    largest_free_block                Destination for size of largest   */
+/*                                        free block                      */
+/*    fragmentation_index               Destination for fragmentation     */
+/*                                        index (0-100)                   */
+/*    free_block_histogram              Destination for free block size   */
+/*                                        histogram                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_fragmentation_info_get(TX_BYTE_POOL *pool_ptr, ULONG *largest_free_block,
+                                            UINT *fragmentation_index, ULONG *free_block_histogram)
+{
+
+#ifdef TX_BYTE_POOL_ENABLE_FRAGMENTATION_INFO
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+UINT        size_class;
+ULONG       free_bytes;
+ULONG       largest;
+ULONG       scattered;
+
+
+    /* Determine if this is a legal request.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Byte pool pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the pool ID is invalid.  */
+    else if (pool_ptr -> tx_byte_pool_id != TX_BYTE_POOL_ID)
+    {
+
+        /* Byte pool pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Pickup the free bytes and the largest free block of this byte pool.  */
+        free_bytes =  pool_ptr -> tx_byte_pool_fragmentation_free_bytes;
+        largest =     pool_ptr -> tx_byte_pool_fragmentation_largest;
+
+        /* Retrieve the free block size histogram of this byte pool.  */
+        if (free_block_histogram != TX_NULL)
+        {
+
+            for (size_class = ((UINT) 0); size_class < TX_BYTE_POOL_FRAGMENTATION_CLASSES; size_class++)
+            {
+
+                free_block_histogram[size_class] =  pool_ptr -> tx_byte_pool_fragmentation_histogram[size_class];
+            }
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Retrieve the largest free block of this byte pool.  */
+        if (largest_free_block != TX_NULL)
+        {
+
+            *largest_free_block =  largest;
+        }
+
+        /* Retrieve the fragmentation index of this byte pool.  */
+        if (fragmentation_index != TX_NULL)
+        {
+
+            /* Determine if there is any free memory.  */
+            if (free_bytes == ((ULONG) 0))
+            {
+
+                /* No, a pool without free memory is not fragmented.  */
+                *fragmentation_index =  ((UINT) 0);
+            }
+            else
+            {
+
+                /* Calculate the percentage of the free memory that is not in the largest
+                   free block, avoiding an overflow for large pools.  */
+                scattered =  free_bytes - largest;
+                if (scattered < (((ULONG) 0xFFFFFFFFUL) / ((ULONG) 100)))
+                {
+
+                    *fragmentation_index =  (UINT) ((scattered * ((ULONG) 100)) / free_bytes);
+                }
+                else
+                {
+
+                    *fragmentation_index =  (UINT) (scattered / (free_bytes / ((ULONG) 100)));
+                }
+            }
+        }
+
+        /* Return completion status.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (largest_free_block != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (fragmentation_index != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (free_block_histogram != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_fragmentation_insert                  PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a free block to the free block size histogram,   */
+/*    the number of free bytes and the largest free block of the byte     */
+/*    pool. It is called when a block is freed, and when the size of a    */
+/*    free block is set after a split or merge.                           */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled or with the pool owned by the caller.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to free block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_cache_flush         Return cached blocks to the pool  */
+/*    _tx_byte_pool_coalesce_release    Release block to coalescing pool  */
+/*    _tx_byte_pool_coalesce_search     Search coalescing pool for memory */
+/*    _tx_byte_pool_create_ex           Create byte pool with policy      */
+/*    _tx_byte_pool_search              Search byte pool for memory       */
+/*    _tx_byte_pool_tlsf_block_insert   Insert block into TLSF index      */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_FRAGMENTATION_INFO
+VOID  _tx_byte_pool_fragmentation_insert(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR       **block_link_ptr;
+ULONG       block_size;
+ULONG       size_bits;
+UINT        size_class;
+
+
+    /* Calculate the number of bytes in the free block.  */
+    block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    block_size =      TX_UCHAR_POINTER_DIF(*block_link_ptr, block_ptr);
+    if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT)
+    {
+
+        /* Blocks have a "next" pointer and an owner field.  */
+        block_size =  block_size - ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
+    }
+    else
+    {
+
+        /* Blocks also have a pointer to the previous block.  */
+        block_size =  block_size - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+    }
+
+    /* Count the block in its size class.  */
+    TX_BYTE_POOL_FRAGMENTATION_CLASS_CALCULATE(block_size, size_bits, size_class)
+    pool_ptr -> tx_byte_pool_fragmentation_histogram[size_class]++;
+
+    /* Add the bytes of the block to the free bytes.  */
+    pool_ptr -> tx_byte_pool_fragmentation_free_bytes =  pool_ptr -> tx_byte_pool_fragmentation_free_bytes + block_size;
+
+    /* Determine if this is the largest free block.  */
+    if (block_size > pool_ptr -> tx_byte_pool_fragmentation_largest)
+    {
+
+        /* Yes, it is the only free block of the largest size.  */
+        pool_ptr -> tx_byte_pool_fragmentation_largest =        block_size;
+        pool_ptr -> tx_byte_pool_fragmentation_largest_count =  ((ULONG) 1);
+    }
+    else if (block_size == pool_ptr -> tx_byte_pool_fragmentation_largest)
+    {
+
+        /* Another free block of the largest size.  */
+        pool_ptr -> tx_byte_pool_fragmentation_largest_count++;
+    }
+    else
+    {
+
+        /* A smaller block does not change the largest free block.  */
+    }
+}
+#endif
+
@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_free_extent                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the size of the largest request that might    */
+/*    be satisfied after the specified block was returned to the byte     */
+/*    pool.                                                               */
+/*                                                                        */
+/*    Pools that use boundary tags merge a released block with its free   */
+/*    neighbors immediately, so the extent is the size of the resulting   */
+/*    free block. First-fit pools merge free blocks lazily during the     */
+/*    search, so the extent is the theoretical number of available bytes  */
+/*    in the pool.                                                        */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the free block that was*/
+/*                                        returned to the pool            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    extent                            Largest request that might be     */
+/*                                        satisfied                       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes back to the pool    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_byte_pool_free_extent(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+ULONG           extent;
+UCHAR           **block_link_ptr;
+
+
+    /* Determine which allocation policy the pool uses.  */
+    if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT)
+    {
+
+        /* Theoretical bytes available = free bytes + ((fragments-2) * overhead of each block)  */
+        extent =  pool_ptr -> tx_byte_pool_available + ((pool_ptr -> tx_byte_pool_fragments - 2) * ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+    }
+    else
+    {
+
+        /* The free block has already been merged with its neighbors, calculate
+           the number of bytes available in it.  */
+        block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+        extent =          TX_UCHAR_POINTER_DIF(*block_link_ptr, block_ptr);
+        extent =          extent - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+    }
+
+    /* Return the extent.  */
+    return(extent);
+}
+
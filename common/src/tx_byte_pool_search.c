@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_byte_pool_search                                PORTABLE C      */
-/*                                                           6.1.7        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -46,16 +46,28 @@
 /*    the requested number of bytes.  Merging of adjacent free blocks     */
 /*    takes place during the search and a split of the block that         */
 /*    satisfies the request may occur before this function returns.       */
+/*    If an alignment is specified, the leading space needed to align the */
+/*    memory is split off and left in the pool as a free block.           */
 /*                                                                        */
 /*    It is assumed that this function is called with interrupts enabled  */
 /*    and with the tx_pool_owner field set to the thread performing the   */
 /*    search.  Also note that the search can occur during allocation and  */
 /*    release of a memory block.                                          */
 /*                                                                        */
+/*    If TX_BYTE_POOL_SEARCH_RESTART_LIMIT is defined, the restarts are   */
+/*    counted across all searches of one allocation or release. Once the  */
+/*    count reaches the limit, preemption is disabled for the remainder   */
+/*    of the search.                                                      */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    pool_ptr                          Pointer to pool control block     */
 /*    memory_size                       Number of bytes required          */
+/*    alignment                         Required alignment of the memory, */
+/*                                        zero for the default alignment  */
+/*    restart_count_ptr                 Pointer to the number of restarts */
+/*                                        of the earlier searches of the  */
+/*                                        caller, updated on return       */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -82,9 +94,15 @@
 /*  06-02-2021      Scott Larson            Improve possible free bytes   */
 /*                                            calculation,                */
 /*                                            resulting in version 6.1.7  */
+/*  xx-xx-xxxx      Microsoft Corporation   Added bounded search restart  */
+/*                                            limit and search counters,  */
+/*                                            added aligned allocation,   */
+/*                                            added fragmentation         */
+/*                                            information, resulting in   */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
-UCHAR  *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size)
+UCHAR  *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment, UINT *restart_count_ptr)
 {
 
 TX_INTERRUPT_SAVE_AREA
@@ -94,14 +112,27 @@ UCHAR           *next_ptr;
 UCHAR           **this_block_link_ptr;
 UCHAR           **next_block_link_ptr;
 ULONG           available_bytes;
+ULONG           aligned_offset =  ((ULONG) 0);
 UINT            examine_blocks;
 UINT            first_free_block_found =  TX_FALSE;
 TX_THREAD       *thread_ptr;
 ALIGN_TYPE      *free_ptr;
 UCHAR           *work_ptr;
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+UINT            restart_count =  ((UINT) 0);
+#endif
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+ULONG           blocks_examined =  ((ULONG) 0);
+#endif
 ULONG           total_theoretical_available;
 
 
+#ifndef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+    /* The number of restarts is only kept when the searches are bounded.  */
+    TX_PARAMETER_NOT_USED(restart_count_ptr);
+#endif
+
     /* Disable interrupts.  */
     TX_DISABLE
 
@@ -126,6 +157,21 @@ ULONG           total_theoretical_available;
         /* Setup ownership of the byte pool.  */
         pool_ptr -> tx_byte_pool_owner =  thread_ptr;
 
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+        /* Pickup the number of restarts of the earlier searches of the caller, so that
+           the limit applies to the whole allocation or release.  */
+        restart_count =  *restart_count_ptr;
+
+        /* Determine if the searches have already been restarted too many times.  */
+        if (restart_count >= ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+        {
+
+            /* Yes, disable preemption for the entire search.  */
+            _tx_thread_preempt_disable++;
+        }
+#endif
+
         /* Walk through the memory pool in search for a large enough block.  */
         current_ptr =      pool_ptr -> tx_byte_pool_search;
         examine_blocks =   pool_ptr -> tx_byte_pool_fragments + ((UINT) 1);
@@ -141,6 +187,9 @@ ULONG           total_theoretical_available;
 
             /* Increment the number of fragments searched on this pool.  */
             pool_ptr -> tx_byte_pool_performance_search_count++;
+
+            /* Increment the number of blocks examined by this search.  */
+            blocks_examined++;
 #endif
 
             /* Check to see if this block is free.  */
@@ -170,9 +219,16 @@ ULONG           total_theoretical_available;
                 available_bytes =   TX_UCHAR_POINTER_DIF(next_ptr, current_ptr);
                 available_bytes =   available_bytes - ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
 
+                /* Determine how far into this block the memory must start to meet the alignment.  */
+                if (alignment != ((ULONG) 0))
+                {
+
+                    TX_BYTE_POOL_ALIGNED_OFFSET_CALCULATE(current_ptr, alignment, ((ULONG) TX_BYTE_BLOCK_MIN), aligned_offset)
+                }
+
                 /* If this is large enough, we are done because our first-fit algorithm
                    has been satisfied!  */
-                if (available_bytes >= memory_size)
+                if (available_bytes >= (memory_size + aligned_offset))
                 {
                     /* Get out of the search loop!  */
                     break;
@@ -192,8 +248,11 @@ ULONG           total_theoretical_available;
 
                         /* Yes, neighbor block can be merged!  This is quickly accomplished
                            by updating the current block with the next blocks pointer.  */
+                        TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, current_ptr)
+                        TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, next_ptr)
                         next_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
                         *this_block_link_ptr =  *next_block_link_ptr;
+                        TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, current_ptr)
 
                         /* Reduce the fragment total.  We don't need to increase the bytes
                            available because all free headers are also included in the available
@@ -234,6 +293,9 @@ ULONG           total_theoretical_available;
 
                             /* Increment the number of fragments searched on this pool.  */
                             pool_ptr -> tx_byte_pool_performance_search_count++;
+
+                            /* Increment the number of blocks examined by this search.  */
+                            blocks_examined++;
 #endif
                         }
                     }
@@ -271,14 +333,79 @@ ULONG           total_theoretical_available;
 
                 /* Setup our ownership again.  */
                 pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of search restarts on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_search_restart_count++;
+#endif
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+                /* Increment the number of restarts of this search.  */
+                restart_count++;
+
+                /* Determine if the search has been restarted too many times.  */
+                if (restart_count == ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+                {
+
+                    /* Yes, disable preemption so that no other thread can take over the pool.
+                       The remainder of the search examines each block at most once.  */
+                    _tx_thread_preempt_disable++;
+                }
+#endif
             }
         } while(examine_blocks != ((UINT) 0));
 
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Update the maximum number of blocks examined by a single search of this pool.  */
+        if (blocks_examined > pool_ptr -> tx_byte_pool_performance_search_max_count)
+        {
+
+            pool_ptr -> tx_byte_pool_performance_search_max_count =  blocks_examined;
+        }
+#endif
+
         /* Determine if a block was found.  If so, determine if it needs to be
            split.  */
         if (available_bytes != ((ULONG) 0))
         {
 
+            /* Remove the block from the fragmentation information.  */
+            TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, current_ptr)
+
+            /* Determine if the memory must start further into the block to meet the alignment.  */
+            if (aligned_offset != ((ULONG) 0))
+            {
+
+                /* Yes, split the leading space off as a free block.  */
+                next_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, aligned_offset);
+
+                /* Setup the new block, which is the block to allocate.  */
+                next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
+                this_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+                *next_block_link_ptr =  *this_block_link_ptr;
+                *this_block_link_ptr =  next_ptr;
+                TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, current_ptr)
+
+                /* Increase the total fragment counter.  */
+                pool_ptr -> tx_byte_pool_fragments++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total split counter.  */
+                _tx_byte_pool_performance_split_count++;
+
+                /* Increment the number of blocks split on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+
+                /* The leading block remains free, continue with the aligned block.  */
+                current_ptr =      next_ptr;
+                available_bytes =  available_bytes - aligned_offset;
+            }
+
             /* Determine if we need to split this block.  */
             if ((available_bytes - memory_size) >= ((ULONG) TX_BYTE_BLOCK_MIN))
             {
@@ -299,6 +426,7 @@ ULONG           total_theoretical_available;
 
                 /* Update the current pointer to point at the newly created block.  */
                 *this_block_link_ptr =  next_ptr;
+                TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, next_ptr)
 
                 /* Set available equal to memory size for subsequent calculation.  */
                 available_bytes =  memory_size;
@@ -346,6 +474,29 @@ ULONG           total_theoretical_available;
             /* Set current pointer to NULL to indicate nothing was found.  */
             current_ptr =  TX_NULL;
         }
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+        /* Return the number of restarts to the caller.  */
+        *restart_count_ptr =  restart_count;
+
+        /* Determine if preemption was disabled during this search.  */
+        if (restart_count >= ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+        {
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Release the temporary preemption disable.  */
+            _tx_thread_preempt_disable--;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Check for preemption.  */
+            _tx_thread_system_preempt_check();
+        }
+#endif
     }
 
     /* Return the search pointer.  */
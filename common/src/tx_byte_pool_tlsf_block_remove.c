@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_block_remove                     PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a free block from its TLSF free list. If the  */
+/*    list becomes empty, the corresponding bits in the first and         */
+/*    second-level bitmaps are cleared.                                   */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to free block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_mapping        Calculate TLSF size class         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
+/*    _tx_byte_pool_tlsf_release        Release TLSF block                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_block_remove(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+TX_BYTE_POOL_TLSF_INDEX *tlsf_ptr;
+UCHAR                   *work_ptr;
+UCHAR                   *next_free_ptr;
+UCHAR                   *previous_free_ptr;
+UCHAR                   **block_link_ptr;
+ULONG                   block_size;
+UINT                    fl;
+UINT                    sl;
+UINT                    list_index;
+
+
+    /* Remove the block from the fragmentation information.  */
+    TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, block_ptr)
+
+    /* Pickup the TLSF index.  */
+    tlsf_ptr =  pool_ptr -> tx_byte_pool_tlsf;
+
+    /* Calculate the number of bytes available in this block.  */
+    block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    block_size =      TX_UCHAR_POINTER_DIF(*block_link_ptr, block_ptr);
+    block_size =      block_size - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+
+    /* Find the list of this block.  */
+    _tx_byte_pool_tlsf_mapping(block_size, &fl, &sl);
+    list_index =  (fl * TX_BYTE_POOL_TLSF_SL_INDEX_COUNT) + sl;
+
+    /* Pickup the free list links of this block.  */
+    work_ptr =           TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+    block_link_ptr =     TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    next_free_ptr =      *block_link_ptr;
+    work_ptr =           TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+    block_link_ptr =     TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    previous_free_ptr =  *block_link_ptr;
+
+    /* Unlink the block from its neighbors on the list.  */
+    if (next_free_ptr != TX_NULL)
+    {
+
+        work_ptr =         TX_UCHAR_POINTER_ADD(next_free_ptr, (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))) + (sizeof(UCHAR *))));
+        block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *block_link_ptr =  previous_free_ptr;
+    }
+    if (previous_free_ptr != TX_NULL)
+    {
+
+        work_ptr =         TX_UCHAR_POINTER_ADD(previous_free_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+        block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *block_link_ptr =  next_free_ptr;
+    }
+    else
+    {
+
+        /* The block is the head of the list, update the head.  */
+        tlsf_ptr -> tx_byte_pool_tlsf_free_list[list_index] =  next_free_ptr;
+
+        /* Determine if the list is now empty.  */
+        if (next_free_ptr == TX_NULL)
+        {
+
+            /* Clear the second-level bit of this list.  */
+            tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[fl] =  tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[fl] & (~(((ULONG) 1) << sl));
+
+            /* Determine if the whole first-level range is now empty.  */
+            if (tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[fl] == ((ULONG) 0))
+            {
+
+                /* Clear the first-level bit of this range.  */
+                tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap =  tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap & (~(((ULONG) 1) << fl));
+            }
+        }
+    }
+}
+
@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_mapping                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function calculates the first-level and second-level index of  */
+/*    the TLSF size class that contains the specified number of bytes.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    memory_size                       Number of bytes                   */
+/*    fl_ptr                            Destination for first-level index */
+/*    sl_ptr                            Destination for second-level index*/
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_block_insert   Insert block into TLSF index      */
+/*    _tx_byte_pool_tlsf_block_remove   Remove block from TLSF index      */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_mapping(ULONG memory_size, UINT *fl_ptr, UINT *sl_ptr)
+{
+
+ULONG       size_bits;
+UINT        msb;
+
+
+    /* Determine if this is a small block.  */
+    if (memory_size < TX_BYTE_POOL_TLSF_SMALL_BLOCK_SIZE)
+    {
+
+        /* Small blocks are all placed in the first range, which is divided linearly.  */
+        *fl_ptr =  ((UINT) 0);
+        *sl_ptr =  (UINT) (memory_size >> (TX_BYTE_POOL_TLSF_FL_INDEX_SHIFT - TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2));
+    }
+    else
+    {
+
+        /* Calculate the highest set bit, which selects the first-level range.  */
+        size_bits =  memory_size;
+        TX_HIGHEST_SET_BIT_CALCULATE(size_bits, msb)
+
+        /* The bits below the highest set bit select the second-level class.  */
+        *sl_ptr =  (UINT) ((memory_size >> (msb - TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2)) ^ ((ULONG) TX_BYTE_POOL_TLSF_SL_INDEX_COUNT));
+        *fl_ptr =  (msb - TX_BYTE_POOL_TLSF_FL_INDEX_SHIFT) + ((UINT) 1);
+    }
+}
+
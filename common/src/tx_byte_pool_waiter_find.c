@@ -0,0 +1,171 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_waiter_find                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the suspended thread whose request should be    */
+/*    tried next with the specified extent of free memory. Only the       */
+/*    first thread of each size class is examined, so this takes time in  */
+/*    the order of the number of classes rather than the number of        */
+/*    suspended threads.                                                  */
+/*                                                                        */
+/*    Every request of a class smaller than the class of the extent       */
+/*    fits. The first thread of the class of the extent is only taken if  */
+/*    its request fits. Among the candidates, the thread that comes       */
+/*    first in the suspension list of the pool is returned, as given by   */
+/*    the stamps of the threads. This is the first suspended thread,      */
+/*    unless tx_byte_pool_prioritize moved the highest priority thread    */
+/*    to the front of the list.                                           */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    extent                            Largest request that might be     */
+/*                                        satisfied                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    thread_ptr                        Pointer to suspended thread or    */
+/*                                        NULL if no request might be     */
+/*                                        satisfied                       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes back to the pool    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+TX_THREAD  *_tx_byte_pool_waiter_find(TX_BYTE_POOL *pool_ptr, ULONG extent)
+{
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *class_thread_ptr;
+ULONG           size_map;
+ULONG           class_map;
+ULONG           extent_bit;
+UINT            extent_class;
+UINT            size_class;
+
+
+    /* Default to no suspended thread.  */
+    thread_ptr =  TX_NULL;
+
+    /* Pickup the map of the size classes of the suspended requests.  */
+    size_map =  pool_ptr -> tx_byte_pool_suspended_size_map;
+
+    /* Determine if any request might be satisfied.  */
+    if ((size_map != ((ULONG) 0)) && (extent != ((ULONG) 0)))
+    {
+
+        /* Pickup the size class of the extent.  */
+        TX_BYTE_POOL_SIZE_BIT_CALCULATE(extent, extent_bit, extent_class)
+
+        /* Every request of a smaller class fits in the extent.  */
+        class_map =  size_map & (extent_bit - ((ULONG) 1));
+
+        /* Determine if there are requests of the same class as the extent.  */
+        if ((size_map & extent_bit) != ((ULONG) 0))
+        {
+
+            /* Yes, these might be larger than the extent. Only the first
+               thread of the class is examined.  */
+            class_thread_ptr =  pool_ptr -> tx_byte_pool_suspended_class_list[extent_class];
+            if (class_thread_ptr -> tx_thread_suspend_info <= extent)
+            {
+
+                /* The first thread of the class fits as well.  */
+                class_map =  class_map | extent_bit;
+            }
+        }
+
+        /* Pick the thread that comes first in the suspension list among the
+           first threads of the classes that fit.  */
+        while (class_map != ((ULONG) 0))
+        {
+
+            /* Find the largest remaining class.  */
+            size_map =  class_map;
+            TX_HIGHEST_SET_BIT_CALCULATE(size_map, size_class)
+
+            /* Pickup the first thread of this class.  */
+            class_thread_ptr =  pool_ptr -> tx_byte_pool_suspended_class_list[size_class];
+
+            /* Determine if this thread is the best so far.  */
+            if (thread_ptr == TX_NULL)
+            {
+
+                /* Yes, the first thread examined.  */
+                thread_ptr =  class_thread_ptr;
+            }
+            else if ((class_thread_ptr -> tx_thread_suspended_class_stamp - thread_ptr -> tx_thread_suspended_class_stamp) > TX_BYTE_POOL_STAMP_HALF)
+            {
+
+                /* Yes, a thread suspended earlier. The stamps are compared
+                   by their difference, which handles wrap-around.  */
+                thread_ptr =  class_thread_ptr;
+            }
+            else
+            {
+
+                /* No, keep the thread found so far.  */
+            }
+
+            /* Remove the class from the map.  */
+            class_map =  class_map & (~(((ULONG) 1) << size_class));
+        }
+    }
+
+    /* Return the suspended thread pointer.  */
+    return(thread_ptr);
+}
+
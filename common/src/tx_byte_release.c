@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_byte_release                                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -60,6 +60,15 @@
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_byte_pool_search              Search the byte pool for memory   */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
+/*    _tx_byte_pool_tlsf_release        Release TLSF block                */
+/*    _tx_byte_pool_coalesce_search     Search coalescing pool for memory */
+/*    _tx_byte_pool_coalesce_release    Release coalescing pool block     */
+/*    _tx_byte_pool_cache_put           Place block in size-class cache   */
+/*    _tx_byte_pool_free_extent         Largest request that might fit    */
+/*    _tx_byte_pool_waiter_find         Find suspended thread to satisfy  */
+/*    _tx_byte_pool_waiter_remove       Remove thread from size-class     */
+/*                                        list                            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -72,6 +81,16 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added TLSF allocation policy, */
+/*                                            added coalescing first-fit  */
+/*                                            policy, added size-class    */
+/*                                            cache, added size-indexed   */
+/*                                            waiter wakeup, added        */
+/*                                            aligned allocation, added   */
+/*                                            fragmentation information,  */
+/*                                            added bounded search        */
+/*                                            restarts,                   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_byte_release(VOID *memory_ptr)
@@ -90,6 +109,9 @@ UINT                suspended_count;
 TX_THREAD           *next_thread;
 TX_THREAD           *previous_thread;
 ULONG               memory_size;
+ULONG               alignment;
+ULONG               extent;
+UINT                restart_count;
 ALIGN_TYPE          *free_ptr;
 TX_BYTE_POOL        **byte_pool_ptr;
 UCHAR               **block_link_ptr;
@@ -167,6 +189,31 @@ UCHAR               **suspend_info_ptr;
         /* Restore interrupts.  */
         TX_RESTORE
     }
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+
+    /* Determine if the block can be kept in the size-class cache of the pool.  */
+    else if (_tx_byte_pool_cache_put(pool_ptr, work_ptr) == TX_TRUE)
+    {
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total release counter.  */
+        _tx_byte_pool_performance_release_count++;
+
+        /* Increment the number of releases on this pool.  */
+        pool_ptr -> tx_byte_pool_performance_release_count++;
+#endif
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_RELEASE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(memory_ptr), pool_ptr -> tx_byte_pool_suspended_count, pool_ptr -> tx_byte_pool_available, TX_TRACE_BYTE_POOL_EVENTS)
+
+        /* Log this kernel call.  */
+        TX_EL_BYTE_RELEASE_INSERT
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+#endif
     else
     {
 
@@ -193,45 +240,93 @@ UCHAR               **suspend_info_ptr;
         /* Log this kernel call.  */
         TX_EL_BYTE_RELEASE_INSERT
 
-        /* Release the memory.  */
-        temp_ptr =   TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
-        free_ptr =   TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(temp_ptr);
-        *free_ptr =  TX_BYTE_BLOCK_FREE;
+        /* Determine which allocation policy the pool uses.  */
+        if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_TLSF)
+        {
 
-        /* Update the number of available bytes in the pool.  */
-        block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
-        next_block_ptr =  *block_link_ptr;
-        pool_ptr -> tx_byte_pool_available =
-            pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_block_ptr, work_ptr);
+            /* Release the memory and merge it with its free neighbors.  */
+            work_ptr =  _tx_byte_pool_tlsf_release(pool_ptr, work_ptr);
+        }
+        else if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT_COALESCE)
+        {
 
-        /* Determine if the free block is prior to current search pointer.  */
-        if (work_ptr < (pool_ptr -> tx_byte_pool_search))
+            /* Release the memory and merge it with its free neighbors.  */
+            work_ptr =  _tx_byte_pool_coalesce_release(pool_ptr, work_ptr);
+        }
+        else
         {
 
-            /* Yes, update the search pointer to the released block.  */
-            pool_ptr -> tx_byte_pool_search =  work_ptr;
+            /* Release the memory.  */
+            temp_ptr =   TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+            free_ptr =   TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(temp_ptr);
+            *free_ptr =  TX_BYTE_BLOCK_FREE;
+
+            /* Update the number of available bytes in the pool.  */
+            block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            next_block_ptr =  *block_link_ptr;
+            pool_ptr -> tx_byte_pool_available =
+                pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_block_ptr, work_ptr);
+
+            /* Add the block to the fragmentation information.  */
+            TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, work_ptr)
+
+            /* Determine if the free block is prior to current search pointer.  */
+            if (work_ptr < (pool_ptr -> tx_byte_pool_search))
+            {
+
+                /* Yes, update the search pointer to the released block.  */
+                pool_ptr -> tx_byte_pool_search =  work_ptr;
+            }
         }
 
         /* Determine if there are threads suspended on this byte pool.  */
         if (pool_ptr -> tx_byte_pool_suspended_count != TX_NO_SUSPENSIONS)
         {
 
-            /* Now examine the suspension list to find threads waiting for
-               memory.  Maybe it is now available!  */
-            while (pool_ptr -> tx_byte_pool_suspended_count != TX_NO_SUSPENSIONS)
-            {
+            /* Determine the largest request that the released memory might satisfy.  */
+            extent =  _tx_byte_pool_free_extent(pool_ptr, work_ptr);
+
+            /* Find the suspended thread to try next among the first threads of the
+               size classes that fit in the extent.  */
+            susp_thread_ptr =  _tx_byte_pool_waiter_find(pool_ptr, extent);
 
-                /* Pickup the first suspended thread pointer.  */
-                susp_thread_ptr =  pool_ptr -> tx_byte_pool_suspension_list;
+            /* Clear the number of search restarts of this release, which is kept across
+               the searches for all of the suspended threads.  */
+            restart_count =  ((UINT) 0);
+
+            /* Now examine the suspended threads waiting for memory that might
+               be satisfied.  Maybe it is now available!  */
+            while (susp_thread_ptr != TX_NULL)
+            {
 
                 /* Pickup the size of the memory the thread is requesting.  */
                 memory_size =  susp_thread_ptr -> tx_thread_suspend_info;
 
+                /* Pickup the alignment of the memory the thread is requesting.  */
+                alignment =  (ULONG) susp_thread_ptr -> tx_thread_suspend_option;
+
                 /* Restore interrupts.  */
                 TX_RESTORE
 
                 /* See if the request can be satisfied.  */
-                work_ptr =  _tx_byte_pool_search(pool_ptr, memory_size);
+                if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_TLSF)
+                {
+
+                    /* Search the TLSF index for free memory.  */
+                    work_ptr =  _tx_byte_pool_tlsf_search(pool_ptr, memory_size, alignment);
+                }
+                else if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT_COALESCE)
+                {
+
+                    /* Search the pool for the first free block that is large enough.  */
+                    work_ptr =  _tx_byte_pool_coalesce_search(pool_ptr, memory_size, alignment);
+                }
+                else
+                {
+
+                    /* Search the pool for the first block that is large enough.  */
+                    work_ptr =  _tx_byte_pool_search(pool_ptr, memory_size, alignment, &restart_count);
+                }
 
                 /* Optional processing extension.  */
                 TX_BYTE_RELEASE_EXTENSION
@@ -242,20 +337,25 @@ UCHAR               **suspend_info_ptr;
                 /* Indicate that this thread is the current owner.  */
                 pool_ptr -> tx_byte_pool_owner =  thread_ptr;
 
-                /* If there is not enough memory, break this loop!  */
+                /* Determine if there is enough memory.  */
                 if (work_ptr == TX_NULL)
                 {
 
-                  /* Break out of the loop.  */
-                    break;
+                    /* No, there is no free block of this size. Only smaller requests
+                       might still be satisfied.  The same is assumed after an aligned
+                       request fails, which at worst defers a request of the same size
+                       to a later release.  */
+                    extent =  memory_size - ((ULONG) 1);
                 }
 
-                /* Check to make sure the thread is still suspended.  */
-                if (susp_thread_ptr ==  pool_ptr -> tx_byte_pool_suspension_list)
+                /* Check to make sure the thread is still suspended on this pool.  */
+                else if (susp_thread_ptr -> tx_thread_state == TX_BYTE_MEMORY)
                 {
 
-                    /* Also, makes sure the memory size is the same.  */
-                    if (susp_thread_ptr -> tx_thread_suspend_info == memory_size)
+                    /* Also, makes sure the pool, the memory size and the alignment are the same.  */
+                    if ((susp_thread_ptr -> tx_thread_suspend_control_block == ((VOID *) pool_ptr)) &&
+                        (susp_thread_ptr -> tx_thread_suspend_info == memory_size) &&
+                        (susp_thread_ptr -> tx_thread_suspend_option == ((UINT) alignment)))
                     {
 
                         /* Remove the suspended thread from the list.  */
@@ -278,18 +378,26 @@ UCHAR               **suspend_info_ptr;
                         else
                         {
 
-                            /* At least one more thread is on the same expiration list.  */
-
-                            /* Update the list head pointer.  */
-                            next_thread =                                susp_thread_ptr -> tx_thread_suspended_next;
-                            pool_ptr -> tx_byte_pool_suspension_list =   next_thread;
+                            /* At least one more thread is on the same suspension list.  */
 
                             /* Update the links of the adjacent threads.  */
+                            next_thread =                                  susp_thread_ptr -> tx_thread_suspended_next;
                             previous_thread =                              susp_thread_ptr -> tx_thread_suspended_previous;
                             next_thread -> tx_thread_suspended_previous =  previous_thread;
                             previous_thread -> tx_thread_suspended_next =  next_thread;
+
+                            /* Determine if the head pointer needs to be updated.  */
+                            if (pool_ptr -> tx_byte_pool_suspension_list == susp_thread_ptr)
+                            {
+
+                                /* Update the list head pointer.  */
+                                pool_ptr -> tx_byte_pool_suspension_list =  next_thread;
+                            }
                         }
 
+                        /* Remove the thread from the list of the size class of its request.  */
+                        _tx_byte_pool_waiter_remove(pool_ptr, susp_thread_ptr);
+
                         /* Prepare for resumption of the thread.  */
 
                         /* Clear cleanup routine to avoid timeout.  */
@@ -338,24 +446,57 @@ UCHAR               **suspend_info_ptr;
                     /* Put the memory back on the available list since this thread is no longer
                        suspended.  */
                     work_ptr =  TX_UCHAR_POINTER_SUB(work_ptr, (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)))));
-                    temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
-                    free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(temp_ptr);
-                    *free_ptr =  TX_BYTE_BLOCK_FREE;
-
-                    /* Update the number of available bytes in the pool.  */
-                    block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
-                    next_block_ptr =  *block_link_ptr;
-                    pool_ptr -> tx_byte_pool_available =
-                        pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_block_ptr, work_ptr);
-
-                    /* Determine if the current pointer is before the search pointer.  */
-                    if (work_ptr < (pool_ptr -> tx_byte_pool_search))
+
+                    /* Determine which allocation policy the pool uses.  */
+                    if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_TLSF)
                     {
 
-                        /* Yes, update the search pointer.  */
-                        pool_ptr -> tx_byte_pool_search =  work_ptr;
+                        /* Release the memory and merge it with its free neighbors.  */
+                        work_ptr =  _tx_byte_pool_tlsf_release(pool_ptr, work_ptr);
+                    }
+                    else if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT_COALESCE)
+                    {
+
+                        /* Release the memory and merge it with its free neighbors.  */
+                        work_ptr =  _tx_byte_pool_coalesce_release(pool_ptr, work_ptr);
+                    }
+                    else
+                    {
+
+                        temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+                        free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(temp_ptr);
+                        *free_ptr =  TX_BYTE_BLOCK_FREE;
+
+                        /* Update the number of available bytes in the pool.  */
+                        block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                        next_block_ptr =  *block_link_ptr;
+                        pool_ptr -> tx_byte_pool_available =
+                            pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_block_ptr, work_ptr);
+
+                        /* Add the block to the fragmentation information.  */
+                        TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, work_ptr)
+
+                        /* Determine if the current pointer is before the search pointer.  */
+                        if (work_ptr < (pool_ptr -> tx_byte_pool_search))
+                        {
+
+                            /* Yes, update the search pointer.  */
+                            pool_ptr -> tx_byte_pool_search =  work_ptr;
+                        }
+                    }
+
+                    /* Determine if the returned memory enlarges the extent.  */
+                    memory_size =  _tx_byte_pool_free_extent(pool_ptr, work_ptr);
+                    if (memory_size > extent)
+                    {
+
+                        /* Yes, update the extent.  */
+                        extent =  memory_size;
                     }
                 }
+
+                /* Find the next suspended thread whose request might be satisfied.  */
+                susp_thread_ptr =  _tx_byte_pool_waiter_find(pool_ptr, extent);
             }
 
             /* Restore interrupts.  */
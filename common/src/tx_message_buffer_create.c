@@ -0,0 +1,160 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_create                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a message buffer, which holds messages of     */
+/*    any size up to the size of the message buffer area. Each message    */
+/*    is stored in a ring as a ULONG length followed by the message,      */
+/*    padded to a multiple of sizeof(ULONG). The message buffer area      */
+/*    must be aligned for ULONG access.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    name_ptr                          Pointer to message buffer name    */
+/*    message_buffer_start              Starting address of message       */
+/*                                        buffer area                     */
+/*    message_buffer_size               Number of bytes in message buffer */
+/*                                        area                            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_message_buffer_create(TX_MESSAGE_BUFFER *message_buffer_ptr, CHAR *name_ptr,
+                    VOID *message_buffer_start, ULONG message_buffer_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_MESSAGE_BUFFER   *next_message_buffer;
+TX_MESSAGE_BUFFER   *previous_message_buffer;
+
+
+    /* Initialize message buffer control block to all zeros.  */
+    TX_MEMSET(message_buffer_ptr, 0, (sizeof(TX_MESSAGE_BUFFER)));
+
+    /* Setup the basic message buffer fields.  */
+    message_buffer_ptr -> tx_message_buffer_name =  name_ptr;
+
+    /* Round the size of the ring down to a multiple of sizeof(ULONG), so that the length
+       of each message is aligned and never wraps around the end of the ring.  */
+    message_buffer_size =  (message_buffer_size/(sizeof(ULONG))) * (sizeof(ULONG));
+
+    /* Save the starting address and calculate the ending address of
+       the ring.  Note that the ending address is really one past the
+       end!  */
+    message_buffer_ptr -> tx_message_buffer_start =  TX_VOID_TO_UCHAR_POINTER_CONVERT(message_buffer_start);
+    message_buffer_ptr -> tx_message_buffer_end =    TX_UCHAR_POINTER_ADD(message_buffer_ptr -> tx_message_buffer_start, message_buffer_size);
+
+    /* Set the read and write pointers to the beginning of the ring.  */
+    message_buffer_ptr -> tx_message_buffer_read =   message_buffer_ptr -> tx_message_buffer_start;
+    message_buffer_ptr -> tx_message_buffer_write =  message_buffer_ptr -> tx_message_buffer_start;
+
+    /* Setup the size of the ring and the number of bytes available.  */
+    message_buffer_ptr -> tx_message_buffer_size =       message_buffer_size;
+    message_buffer_ptr -> tx_message_buffer_available =  message_buffer_size;
+
+    /* Disable interrupts to put the message buffer on the created list.  */
+    TX_DISABLE
+
+    /* Setup the message buffer ID to make it valid.  */
+    message_buffer_ptr -> tx_message_buffer_id =  TX_MESSAGE_BUFFER_ID;
+
+    /* Place the message buffer on the list of created message buffers.  First,
+       check for an empty list.  */
+    if (_tx_message_buffer_created_count == TX_EMPTY)
+    {
+
+        /* The created message buffer list is empty.  Add message buffer to empty list.  */
+        _tx_message_buffer_created_ptr =                           message_buffer_ptr;
+        message_buffer_ptr -> tx_message_buffer_created_next =      message_buffer_ptr;
+        message_buffer_ptr -> tx_message_buffer_created_previous =  message_buffer_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_message_buffer =      _tx_message_buffer_created_ptr;
+        previous_message_buffer =  next_message_buffer -> tx_message_buffer_created_previous;
+
+        /* Place the new message buffer in the list.  */
+        next_message_buffer -> tx_message_buffer_created_previous =  message_buffer_ptr;
+        previous_message_buffer -> tx_message_buffer_created_next =  message_buffer_ptr;
+
+        /* Setup this message buffer's created links.  */
+        message_buffer_ptr -> tx_message_buffer_created_previous =  previous_message_buffer;
+        message_buffer_ptr -> tx_message_buffer_created_next =      next_message_buffer;
+    }
+
+    /* Increment the created message buffer count.  */
+    _tx_message_buffer_created_count++;
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_MESSAGE_BUFFER, message_buffer_ptr, name_ptr, message_buffer_size, 0)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_MESSAGE_BUFFER_CREATE, message_buffer_ptr, TX_POINTER_TO_ULONG_CONVERT(message_buffer_start), message_buffer_size, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
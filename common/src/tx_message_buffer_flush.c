@@ -0,0 +1,202 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_flush                            PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the specified message buffer, if there are     */
+/*    any messages in it. Threads suspended on a full message buffer are  */
+/*    resumed with the TX_SUCCESS status code.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_message_buffer_flush(TX_MESSAGE_BUFFER *message_buffer_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *suspension_list;
+UINT            suspended_count;
+TX_THREAD       *thread_ptr;
+
+
+    /* Initialize the suspended count and list.  */
+    suspended_count =  TX_NO_SUSPENSIONS;
+    suspension_list =  TX_NULL;
+
+    /* Disable interrupts to reset various message buffer parameters.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_MESSAGE_BUFFER_FLUSH, message_buffer_ptr, TX_POINTER_TO_ULONG_CONVERT(&thread_ptr), 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Determine if there is something on the message buffer.  */
+    if (message_buffer_ptr -> tx_message_buffer_enqueued != TX_NO_MESSAGES)
+    {
+
+        /* Yes, there is something in the message buffer.  */
+
+        /* Reset the message buffer parameters to erase all of the queued messages.  */
+        message_buffer_ptr -> tx_message_buffer_enqueued =   TX_NO_MESSAGES;
+        message_buffer_ptr -> tx_message_buffer_available =  message_buffer_ptr -> tx_message_buffer_size;
+        message_buffer_ptr -> tx_message_buffer_read =       message_buffer_ptr -> tx_message_buffer_start;
+        message_buffer_ptr -> tx_message_buffer_write =      message_buffer_ptr -> tx_message_buffer_start;
+
+        /* Now determine if there are any threads suspended on a full message buffer.  */
+        if (message_buffer_ptr -> tx_message_buffer_suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            /* Yes, there are threads suspended on this message buffer, they must be
+               resumed!  */
+
+            /* Copy the information into temporary variables.  */
+            suspension_list =  message_buffer_ptr -> tx_message_buffer_suspension_list;
+            suspended_count =  message_buffer_ptr -> tx_message_buffer_suspended_count;
+
+            /* Clear the message buffer variables.  */
+            message_buffer_ptr -> tx_message_buffer_suspension_list =  TX_NULL;
+            message_buffer_ptr -> tx_message_buffer_suspended_count =  TX_NO_SUSPENSIONS;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Walk through the message buffer list to resume any and all threads suspended
+       on this message buffer.  */
+    if (suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Pickup the thread to resume.  */
+        thread_ptr =  suspension_list;
+        while (suspended_count != ((ULONG) 0))
+        {
+
+            /* Decrement the suspension count.  */
+            suspended_count--;
+
+            /* Check for a NULL thread pointer.  */
+            if (thread_ptr == TX_NULL)
+            {
+
+                /* Get out of the loop.  */
+                break;
+            }
+
+            /* Resume the next suspended thread.  */
+
+            /* Lockout interrupts.  */
+            TX_DISABLE
+
+            /* Clear the cleanup pointer, this prevents the timeout from doing
+               anything.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Set the return status in the thread to TX_SUCCESS.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Move the thread pointer ahead.  */
+            thread_ptr =  thread_ptr -> tx_thread_suspended_next;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr -> tx_thread_suspended_previous);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr -> tx_thread_suspended_previous);
+#endif
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Restore previous preempt posture.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+    }
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,148 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_info_get                         PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information from the specified message      */
+/*    buffer.                                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    name                              Destination for the message       */
+/*                                        buffer name                     */
+/*    enqueued                          Destination for enqueued count    */
+/*    available_bytes                   Destination for number of bytes   */
+/*                                        not used by messages            */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on this        */
+/*                                        message buffer                  */
+/*    suspended_count                   Destination for suspended count   */
+/*    next_message_buffer               Destination for pointer to the    */
+/*                                        next message buffer on the      */
+/*                                        created list                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_message_buffer_info_get(TX_MESSAGE_BUFFER *message_buffer_ptr, CHAR **name, ULONG *enqueued,
+                    ULONG *available_bytes, TX_THREAD **first_suspended, ULONG *suspended_count,
+                    TX_MESSAGE_BUFFER **next_message_buffer)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_MESSAGE_BUFFER_INFO_GET, message_buffer_ptr, 0, 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the name of the message buffer.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  message_buffer_ptr -> tx_message_buffer_name;
+    }
+
+    /* Retrieve the number of messages currently in the message buffer.  */
+    if (enqueued != TX_NULL)
+    {
+
+        *enqueued =  (ULONG) message_buffer_ptr -> tx_message_buffer_enqueued;
+    }
+
+    /* Retrieve the number of bytes that are not used by messages.  */
+    if (available_bytes != TX_NULL)
+    {
+
+        *available_bytes =  message_buffer_ptr -> tx_message_buffer_available;
+    }
+
+    /* Retrieve the first thread suspended on this message buffer.  */
+    if (first_suspended != TX_NULL)
+    {
+
+        *first_suspended =  message_buffer_ptr -> tx_message_buffer_suspension_list;
+    }
+
+    /* Retrieve the number of threads suspended on this message buffer.  */
+    if (suspended_count != TX_NULL)
+    {
+
+        *suspended_count =  (ULONG) message_buffer_ptr -> tx_message_buffer_suspended_count;
+    }
+
+    /* Retrieve the pointer to the next message buffer created.  */
+    if (next_message_buffer != TX_NULL)
+    {
+
+        *next_message_buffer =  message_buffer_ptr -> tx_message_buffer_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
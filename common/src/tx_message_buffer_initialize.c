@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_message_buffer.h"
+
+
+#ifndef TX_INLINE_INITIALIZATION
+
+/* Locate message buffer component data in this file.  */
+
+/* Define the head pointer of the created message buffer list.  */
+
+TX_MESSAGE_BUFFER *     _tx_message_buffer_created_ptr;
+
+
+/* Define the variable that holds the number of created message buffers. */
+
+ULONG                   _tx_message_buffer_created_count;
+
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+/* Define the total number of messages sent.  */
+
+ULONG                   _tx_message_buffer_performance_messages_sent_count;
+
+
+/* Define the total number of messages received.  */
+
+ULONG                   _tx_message_buffer_performance_messages_received_count;
+
+
+/* Define the total number of message buffer empty suspensions.  */
+
+ULONG                   _tx_message_buffer_performance_empty_suspension_count;
+
+
+/* Define the total number of message buffer full suspensions.  */
+
+ULONG                   _tx_message_buffer_performance_full_suspension_count;
+
+
+/* Define the total number of message buffer full errors.  */
+
+ULONG                   _tx_message_buffer_performance_full_error_count;
+
+
+/* Define the total number of message buffer timeouts.  */
+
+ULONG                   _tx_message_buffer_performance_timeout_count;
+
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_initialize                       PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the various control data structures for   */
+/*    the message buffer component.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_high_level         High level initialization         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_message_buffer_initialize(VOID)
+{
+
+#ifndef TX_DISABLE_REDUNDANT_CLEARING
+
+    /* Initialize the head pointer of the created message buffers list and the
+       number of message buffers created.  */
+    _tx_message_buffer_created_ptr =        TX_NULL;
+    _tx_message_buffer_created_count =      TX_EMPTY;
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+    /* Initialize the message buffer performance counters.  */
+    _tx_message_buffer_performance_messages_sent_count =        ((ULONG) 0);
+    _tx_message_buffer_performance_messages_received_count =    ((ULONG) 0);
+    _tx_message_buffer_performance_empty_suspension_count =     ((ULONG) 0);
+    _tx_message_buffer_performance_full_suspension_count =      ((ULONG) 0);
+    _tx_message_buffer_performance_full_error_count =           ((ULONG) 0);
+    _tx_message_buffer_performance_timeout_count =              ((ULONG) 0);
+#endif
+#endif
+}
+#endif
+
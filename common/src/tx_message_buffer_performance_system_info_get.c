@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_message_buffer.h"
+#include "tx_trace.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_performance_system_info_get      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves message buffer performance information.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    messages_sent                     Destination for total messages    */
+/*                                        sent                            */
+/*    messages_received                 Destination for total messages    */
+/*                                        received                        */
+/*    empty_suspensions                 Destination for total empty       */
+/*                                        message buffer suspensions      */
+/*    full_suspensions                  Destination for total full        */
+/*                                        message buffer suspensions      */
+/*    full_errors                       Destination for total full errors */
+/*                                        on message buffers              */
+/*    timeouts                          Destination for total number of   */
+/*                                        timeouts on message buffers     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_message_buffer_performance_system_info_get(ULONG *messages_sent, ULONG *messages_received,
+                    ULONG *empty_suspensions, ULONG *full_suspensions, ULONG *full_errors, ULONG *timeouts)
+{
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_MESSAGE_BUFFER_PERFORMANCE_SYSTEM_INFO_GET, 0, 0, 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the total number of message buffer messages sent.  */
+    if (messages_sent != TX_NULL)
+    {
+
+        *messages_sent =  _tx_message_buffer_performance_messages_sent_count;
+    }
+
+    /* Retrieve the total number of message buffer messages received.  */
+    if (messages_received != TX_NULL)
+    {
+
+        *messages_received =  _tx_message_buffer_performance_messages_received_count;
+    }
+
+    /* Retrieve the total number of empty message buffer suspensions.  */
+    if (empty_suspensions != TX_NULL)
+    {
+
+        *empty_suspensions =  _tx_message_buffer_performance_empty_suspension_count;
+    }
+
+    /* Retrieve the total number of full message buffer suspensions.  */
+    if (full_suspensions != TX_NULL)
+    {
+
+        *full_suspensions =  _tx_message_buffer_performance_full_suspension_count;
+    }
+
+    /* Retrieve the total number of full errors.  */
+    if (full_errors != TX_NULL)
+    {
+
+        *full_errors =  _tx_message_buffer_performance_full_error_count;
+    }
+
+    /* Retrieve the total number of message buffer timeouts.  */
+    if (timeouts != TX_NULL)
+    {
+
+        *timeouts =  _tx_message_buffer_performance_timeout_count;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (messages_sent != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (messages_received != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (empty_suspensions != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (full_suspensions != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (full_errors != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (timeouts != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
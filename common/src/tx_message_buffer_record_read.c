@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_record_read                      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the message at the read pointer of the        */
+/*    message buffer, copies it to the destination and updates the        */
+/*    message buffer counts. The caller must have verified that the       */
+/*    destination is large enough and must have interrupts disabled.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    destination_ptr                   Pointer to message destination    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    size                              Size of the message in bytes      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_message_buffer_receive        Receive message from message      */
+/*                                        buffer                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_message_buffer_record_read(TX_MESSAGE_BUFFER *message_buffer_ptr, UCHAR *destination_ptr)
+{
+
+UCHAR       *source;
+UCHAR       *destination;
+ULONG       *length_ptr;
+ULONG       size;
+ULONG       record_size;
+ULONG       copy_size;
+ULONG       offset;
+
+
+    /* Pickup the length of the message at the read pointer.  */
+    source =       message_buffer_ptr -> tx_message_buffer_read;
+    length_ptr =   TX_UCHAR_TO_ULONG_POINTER_CONVERT(source);
+    size =         *length_ptr;
+    record_size =  TX_MESSAGE_BUFFER_RECORD_SIZE(size);
+    source =       TX_UCHAR_POINTER_ADD(source, (sizeof(ULONG)));
+
+    /* Determine if the length is at the end of the ring.  */
+    if (source == message_buffer_ptr -> tx_message_buffer_end)
+    {
+
+        /* Yes, the message starts at the beginning of the ring.  */
+        source =  message_buffer_ptr -> tx_message_buffer_start;
+    }
+
+    /* Calculate the number of bytes up to the end of the ring.  */
+    offset =  TX_UCHAR_POINTER_DIF(message_buffer_ptr -> tx_message_buffer_end, source);
+
+    /* Copy the part of the message that is before the end of the ring.  Note that the
+       source and destination pointers are incremented by the macro.  */
+    destination =  destination_ptr;
+    if (size > offset)
+    {
+
+        /* The message wraps around the end of the ring.  */
+        copy_size =  offset;
+    }
+    else
+    {
+
+        /* The whole message is before the end of the ring.  */
+        copy_size =  size;
+    }
+    TX_MESSAGE_BUFFER_COPY(source, destination, copy_size)
+
+    /* Determine if there is more of the message to copy.  */
+    if (size > offset)
+    {
+
+        /* Copy the rest of the message from the beginning of the ring.  */
+        source =     message_buffer_ptr -> tx_message_buffer_start;
+        copy_size =  size - offset;
+        TX_MESSAGE_BUFFER_COPY(source, destination, copy_size)
+    }
+
+    /* Advance the read pointer past the padded message.  */
+    offset =  TX_UCHAR_POINTER_DIF(message_buffer_ptr -> tx_message_buffer_read, message_buffer_ptr -> tx_message_buffer_start);
+    offset =  offset + record_size;
+    if (offset >= message_buffer_ptr -> tx_message_buffer_size)
+    {
+
+        /* Wrap around to the beginning.  */
+        offset =  offset - message_buffer_ptr -> tx_message_buffer_size;
+    }
+    message_buffer_ptr -> tx_message_buffer_read =  TX_UCHAR_POINTER_ADD(message_buffer_ptr -> tx_message_buffer_start, offset);
+
+    /* Update the number of bytes available and the number of messages.  */
+    message_buffer_ptr -> tx_message_buffer_available =  message_buffer_ptr -> tx_message_buffer_available + record_size;
+    message_buffer_ptr -> tx_message_buffer_enqueued--;
+
+    /* Return the size of the message.  */
+    return(size);
+}
+
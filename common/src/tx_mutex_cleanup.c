@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_mutex_cleanup                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -73,6 +73,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added priority-ordered        */
+/*                                            suspension lists, resulting */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_mutex_cleanup(TX_THREAD  *thread_ptr, ULONG suspension_sequence)
@@ -126,6 +129,17 @@ TX_THREAD           *previous_thread;
                         /* Clear the suspension cleanup flag.  */
                         thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
 
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+                        /* Determine if the suspension list is kept in priority order.  */
+                        if (mutex_ptr -> tx_mutex_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+                        {
+
+                            /* Update the priority order for the removal of the thread.  */
+                            _tx_thread_priority_suspension_remove(mutex_ptr -> tx_mutex_suspension_list, &(mutex_ptr -> tx_mutex_priority_suspension), thread_ptr);
+                        }
+#endif
+
                         /* Decrement the suspension count.  */
                         mutex_ptr -> tx_mutex_suspended_count--;
 
@@ -220,7 +234,7 @@ TX_THREAD           *previous_thread;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_mutex_thread_release                            PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -254,6 +268,9 @@ TX_THREAD           *previous_thread;
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added priority-ordered        */
+/*                                            suspension lists, resulting */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_mutex_thread_release(TX_THREAD  *thread_ptr)
@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_mutex_get                                       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -72,6 +72,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added priority-ordered        */
+/*                                            suspension lists, resulting */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option)
@@ -258,8 +261,23 @@ UINT            status;
                 thread_ptr -> tx_thread_suspension_sequence++;
 #endif
 
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+                /* Determine if the suspension list is kept in priority order.  */
+                if (mutex_ptr -> tx_mutex_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+                {
+
+                    /* Place the thread in priority order.  */
+                    _tx_thread_priority_suspension_insert(&(mutex_ptr -> tx_mutex_suspension_list), &(mutex_ptr -> tx_mutex_priority_suspension), thread_ptr);
+                }
+
+                /* Setup suspension list.  */
+                else if (mutex_ptr -> tx_mutex_suspended_count == TX_NO_SUSPENSIONS)
+#else
+
                 /* Setup suspension list.  */
                 if (mutex_ptr -> tx_mutex_suspended_count == TX_NO_SUSPENSIONS)
+#endif
                 {
 
                     /* No other threads are suspended.  Setup the head pointer and
@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_mutex_prioritize                                PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -70,6 +70,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added priority-ordered        */
+/*                                            suspension lists, resulting */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_mutex_prioritize(TX_MUTEX *mutex_ptr)
@@ -109,6 +112,19 @@ UINT            status;
         TX_RESTORE
     }
 
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+    /* Determine if the suspension list is kept in priority order.  */
+    else if (mutex_ptr -> tx_mutex_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+    {
+
+        /* The highest priority thread is already at the front of the list.  */
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+#endif
+
     /* Determine if there how many threads are suspended on this mutex.  */
     else if (suspended_count == ((UINT) 2))
     {
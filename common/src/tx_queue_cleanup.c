@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_queue_cleanup                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -73,6 +73,10 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added zero-copy reserve,      */
+/*                                            commit, acquire and release */
+/*                                            services, resulting in      */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_queue_cleanup(TX_THREAD  *thread_ptr, ULONG suspension_sequence)
@@ -180,8 +184,17 @@ TX_THREAD           *previous_thread;
                             queue_ptr -> tx_queue_performance_timeout_count++;
 #endif
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+                            /* Setup return status from the kind of suspension, since the queue
+                               is both empty and full while all of it is held by reservations
+                               and acquisitions.  */
+                            if (thread_ptr -> tx_thread_suspend_info >= TX_QUEUE_SEND_SUSPEND)
+#else
+
                             /* Setup return status.  */
                             if (queue_ptr -> tx_queue_enqueued != TX_NO_MESSAGES)
+#endif
                             {
 
                                 /* Queue full timeout!  */
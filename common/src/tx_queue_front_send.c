@@ -29,6 +29,7 @@
 #include "tx_trace.h"
 #include "tx_thread.h"
 #include "tx_queue.h"
+#include "tx_wait_set.h"
 
 
 /**************************************************************************/
@@ -36,7 +37,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_queue_front_send                                PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -45,7 +46,8 @@
 /*                                                                        */
 /*    This function places a message at the front of the specified queue. */
 /*    If there is no room in the queue, this function returns the         */
-/*    queue full status.                                                  */
+/*    queue full status.  On a priority queue, the message is placed      */
+/*    ahead of all messages of the highest priority.                      */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -59,10 +61,13 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*    _tx_queue_priority_front_insert   Place message at priority front   */
 /*    _tx_thread_system_resume          Resume thread routine             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_thread_system_suspend         Suspend thread routine            */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*    _tx_wait_set_signal               Signal wait set member            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -75,6 +80,14 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added zero-copy reserve,      */
+/*                                            commit, acquire and release */
+/*                                            services, added priority    */
+/*                                            queues, added wait sets,    */
+/*                                            added exact copy of         */
+/*                                            messages with sizes in      */
+/*                                            bytes, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option)
@@ -90,6 +103,9 @@ UINT            suspended_count;
 TX_THREAD       *next_thread;
 TX_THREAD       *previous_thread;
 UINT            status;
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+TX_THREAD       *resume_list;
+#endif
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 #endif
@@ -119,18 +135,83 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
     /* Pickup the suspended count.  */
     suspended_count =  queue_ptr -> tx_queue_suspended_count;
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+    /* Now check for room in the queue for placing the new message in front. The slot in
+       front of the read pointer is not available while acquired messages hold it, unless
+       the queue is empty and its front is at the write pointer.  */
+    if ((queue_ptr -> tx_queue_available_storage != ((UINT) 0)) &&
+        ((queue_ptr -> tx_queue_consumed == ((UINT) 0)) ||
+         ((queue_ptr -> tx_queue_enqueued == TX_NO_MESSAGES) && (queue_ptr -> tx_queue_pending == ((UINT) 0)))))
+#else
+
     /* Now check for room in the queue for placing the new message in front.  */
     if (queue_ptr -> tx_queue_available_storage != ((UINT) 0))
+#endif
     {
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+        /* Yes there is room in the queue. Now determine if there is a thread waiting
+           for a message by copy.  */
+        if ((suspended_count == TX_NO_SUSPENSIONS) ||
+            (queue_ptr -> tx_queue_suspension_list -> tx_thread_suspend_info != TX_QUEUE_RECEIVE_SUSPEND))
+#else
+
         /* Yes there is room in the queue. Now determine if there is a thread waiting
            for a message.  */
         if (suspended_count == TX_NO_SUSPENSIONS)
+#endif
         {
 
             /* No thread suspended while waiting for a message from
                this queue.  */
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+            /* Determine if the queue orders its messages by priority.  */
+            if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+            {
+
+                /* Reduce the amount of available storage.  */
+                queue_ptr -> tx_queue_available_storage--;
+
+                /* Increase the enqueued count.  */
+                queue_ptr -> tx_queue_enqueued++;
+
+                /* Place the message ahead of all messages of the highest priority.  */
+                _tx_queue_priority_front_insert(queue_ptr, TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr));
+            }
+            else
+            {
+#endif
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Determine if the slot in front of the read pointer is held by acquired
+               messages.  */
+            if (queue_ptr -> tx_queue_consumed != ((UINT) 0))
+            {
+
+                /* Yes, the queue is empty and its front is at the write pointer. Move the
+                   write pointer past its slot and the read pointer along with it, so the
+                   read pointer steps back to the slot below.  */
+                destination =  TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_write, queue_ptr -> tx_queue_message_size);
+
+                /* Determine if we are at the end.  */
+                if (destination == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    destination =  queue_ptr -> tx_queue_start;
+                }
+
+                /* Adjust the write and read pointers.  */
+                queue_ptr -> tx_queue_write =  destination;
+                queue_ptr -> tx_queue_read =   destination;
+            }
+#endif
+
             /* Adjust the read pointer since we are adding to the front of the
                queue.  */
 
@@ -164,7 +245,25 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 
             /* Copy message. Note that the source and destination pointers are
                incremented by the macro.  */
-            TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Give the message to the threads suspended on the queue, if any.  */
+            resume_list =  _tx_queue_zero_copy_settle(queue_ptr);
+
+            /* Determine if any suspended threads were served.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Disable preemption until all of the threads are resumed.  */
+                _tx_thread_preempt_disable++;
+            }
+#endif
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+            }
+#endif
 
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 
@@ -175,6 +274,17 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
             /* Restore interrupts.  */
             TX_RESTORE
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Determine if there are threads to resume.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Resume the threads.  */
+                _tx_queue_threads_resume(resume_list);
+            }
+#endif
+
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 
             /* Determine if a notify callback is required.  */
@@ -185,6 +295,17 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
                 (queue_send_notify)(queue_ptr);
             }
 #endif
+
+#ifdef TX_ENABLE_WAIT_SET
+
+            /* Determine if the queue is a member of a wait set.  */
+            if (queue_ptr -> tx_queue_wait_set_member.tx_wait_set_member_set != TX_NULL)
+            {
+
+                /* Yes, resume a thread waiting on the wait set if the queue is still ready.  */
+                _tx_wait_set_signal(&(queue_ptr -> tx_queue_wait_set_member));
+            }
+#endif
         }
         else
         {
@@ -243,7 +364,7 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 
             /* Copy message. Note that the source and destination pointers are
                incremented by the macro.  */
-            TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
 
             /* Put return status into the thread control block.  */
             thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
@@ -284,8 +405,18 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
     else if (wait_option != TX_NO_WAIT)
     {
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+        /* Determine if the preempt disable flag is non-zero, or if the threads suspended on
+           the queue are receiving from the queue. The latter only happens while all of the
+           queue is held by reservations and acquisitions.  */
+        if ((_tx_thread_preempt_disable != ((UINT) 0)) ||
+            ((suspended_count != TX_NO_SUSPENSIONS) && (queue_ptr -> tx_queue_suspension_list -> tx_thread_suspend_info < TX_QUEUE_SEND_SUSPEND)))
+#else
+
         /* Determine if the preempt disable flag is non-zero.  */
         if (_tx_thread_preempt_disable != ((UINT) 0))
+#endif
         {
 
             /* Restore interrupts.  */
@@ -315,6 +446,12 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
             /* Set the flag to true to indicate a queue front send suspension.  */
             thread_ptr -> tx_thread_suspend_option =           TX_TRUE;
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Remember the kind of suspension.  */
+            thread_ptr -> tx_thread_suspend_info =             TX_QUEUE_FRONT_SEND_SUSPEND;
+#endif
+
 #ifndef TX_NOT_INTERRUPTABLE
 
             /* Increment the suspension sequence number, which is used to identify
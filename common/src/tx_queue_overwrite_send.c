@@ -0,0 +1,235 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_queue.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_overwrite_send                            PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a message into the specified queue. If the     */
+/*    queue is full, the oldest message is overwritten by the new         */
+/*    message, which becomes the newest message in the queue, so a queue  */
+/*    of one message holds the latest value sent. This service never      */
+/*    suspends. A queue that is full because of zero-copy reservations    */
+/*    or acquisitions, or a queue ordered by message priority, is not     */
+/*    overwritten and TX_QUEUE_FULL is returned instead.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    source_ptr                        Pointer to message source         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_wait_set_signal               Signal wait set member            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_overwrite_send(TX_QUEUE *queue_ptr, VOID *source_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG           *source;
+ULONG           *destination;
+UINT            size;
+UINT            retry;
+UINT            status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
+#endif
+
+
+    /* Loop until the message is placed in the queue. More than one pass is only needed
+       if the queue is filled by an interrupt after it was found to have room.  */
+    do
+    {
+
+        /* Default to a single pass.  */
+        retry =  TX_FALSE;
+
+        /* Disable interrupts to check the room in the queue.  */
+        TX_DISABLE
+
+        /* Determine if there is room in the queue.  */
+        if (queue_ptr -> tx_queue_available_storage != TX_NO_MESSAGES)
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* There is room in the queue, or a thread suspended on it.  Send the message
+               normally, which also resumes a suspended receiver.  */
+            status =  _tx_queue_send(queue_ptr, source_ptr, TX_NO_WAIT);
+
+            /* Determine if the queue was filled in the meantime.  */
+            if (status == TX_QUEUE_FULL)
+            {
+
+                /* Yes, try again to overwrite the oldest message.  */
+                retry =  TX_TRUE;
+            }
+        }
+
+        /* Determine if the queue is full of messages that can be overwritten, that is
+           the write pointer is at the oldest message.  */
+        else if ((queue_ptr -> tx_queue_enqueued == TX_NO_MESSAGES)
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+                 || (queue_ptr -> tx_queue_reserved != ((UINT) 0))
+                 || (queue_ptr -> tx_queue_pending != ((UINT) 0))
+                 || (queue_ptr -> tx_queue_consumed != ((UINT) 0))
+#endif
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+                 || (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+#endif
+                )
+        {
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total number of full errors.  */
+            _tx_queue_performance_full_error_count++;
+
+            /* Increment the number of full errors on this queue.  */
+            queue_ptr -> tx_queue_performance_full_error_count++;
+#endif
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* The queue is full but can't be overwritten.  */
+            status =  TX_QUEUE_FULL;
+        }
+        else
+        {
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total messages sent counter.  */
+            _tx_queue_performance_messages_sent_count++;
+
+            /* Increment the number of messages sent to this queue.  */
+            queue_ptr -> tx_queue_performance_messages_sent_count++;
+
+            /* Increment the number of messages overwritten on this queue.  */
+            queue_ptr -> tx_queue_performance_overwrite_count++;
+#endif
+
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_OVERWRITE_SEND, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(source_ptr), queue_ptr -> tx_queue_enqueued, queue_ptr -> tx_queue_available_storage, TX_TRACE_QUEUE_EVENTS)
+
+            /* Setup source and destination pointers.  The write pointer of the full
+               queue is at the oldest message.  */
+            source =       TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
+            destination =  queue_ptr -> tx_queue_write;
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy the message over the oldest message. Note that the source and
+               destination pointers are incremented by the macro.  */
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+            /* Determine if we are at the end.  */
+            if (destination == queue_ptr -> tx_queue_end)
+            {
+
+                /* Yes, wrap around to the beginning.  */
+                destination =  queue_ptr -> tx_queue_start;
+            }
+
+            /* Move the write and the read pointers past the new message, which
+               makes it the newest message in the queue.  */
+            queue_ptr -> tx_queue_write =  destination;
+            queue_ptr -> tx_queue_read =   destination;
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Pickup the notify callback routine for this queue.  */
+            queue_send_notify =  queue_ptr -> tx_queue_send_notify;
+#endif
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Determine if a notify callback is required.  */
+            if (queue_send_notify != TX_NULL)
+            {
+
+                /* Call application queue send notification.  */
+                (queue_send_notify)(queue_ptr);
+            }
+#endif
+
+#ifdef TX_ENABLE_WAIT_SET
+
+            /* Determine if the queue is a member of a wait set.  */
+            if (queue_ptr -> tx_queue_wait_set_member.tx_wait_set_member_set != TX_NULL)
+            {
+
+                /* Yes, resume a thread waiting on the wait set if the queue is still ready.  */
+                _tx_wait_set_signal(&(queue_ptr -> tx_queue_wait_set_member));
+            }
+#endif
+
+            /* Return success.  */
+            status =  TX_SUCCESS;
+        }
+    } while (retry == TX_TRUE);
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_priority_front_insert                     PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a message into a free slot of a priority       */
+/*    queue and places the slot at the front of the list of the highest   */
+/*    priority, priority 0, ahead of all other messages in the queue. It  */
+/*    is called with interrupts disabled and with a free slot in the      */
+/*    queue, the caller updates the enqueued and available counts.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    source                            Pointer to message source         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+VOID  _tx_queue_priority_front_insert(TX_QUEUE *queue_ptr, ULONG *source)
+{
+
+ULONG           *lists;
+ULONG           *slot;
+ULONG           *destination;
+ULONG           slot_index;
+UINT            size;
+
+
+    /* Pickup the first free message slot.  */
+    slot_index =  queue_ptr -> tx_queue_priority_free;
+    slot =        TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_start, ((slot_index - ((ULONG) 1)) * (((ULONG) queue_ptr -> tx_queue_message_size) + ((ULONG) 1))));
+
+    /* Remove the message slot from the free list.  */
+    queue_ptr -> tx_queue_priority_free =  *slot;
+
+    /* Copy message. Note that the source and destination pointers are
+       incremented by the macro.  */
+    destination =  TX_ULONG_POINTER_ADD(slot, 1);
+    size =         queue_ptr -> tx_queue_message_size;
+    TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+    /* Pickup the lists of the priorities.  */
+    lists =  queue_ptr -> tx_queue_priority_lists;
+
+    /* Determine if the highest priority has messages.  */
+    if ((queue_ptr -> tx_queue_priority_map & ((ULONG) 1)) != ((ULONG) 0))
+    {
+
+        /* Yes, link the message slot ahead of the first one of the priority.  */
+        *slot =  lists[0];
+    }
+    else
+    {
+
+        /* No, the message slot is also the last one of the priority.  */
+        *slot =     ((ULONG) 0);
+        lists[1] =  slot_index;
+
+        /* Set the priority in the bit map.  */
+        queue_ptr -> tx_queue_priority_map =  queue_ptr -> tx_queue_priority_map | ((ULONG) 1);
+    }
+
+    /* The message slot is the first one of the priority.  */
+    lists[0] =  slot_index;
+}
+#endif
+
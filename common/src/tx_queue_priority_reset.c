@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_priority_reset                            PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function empties the message lists of a priority queue and     */
+/*    links all of its message slots on the free list. It is called when  */
+/*    the queue is created and when the queue is flushed, with            */
+/*    interrupts disabled in the latter case.                             */
+/*                                                                        */
+/*    Each message slot starts with the number of the next slot on the    */
+/*    same list, slots are numbered from one and zero ends a list.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_flush                   Flush queue messages              */
+/*    _tx_queue_priority_create         Create priority queue             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+VOID  _tx_queue_priority_reset(TX_QUEUE *queue_ptr)
+{
+
+ULONG           *lists;
+ULONG           *slot;
+ULONG           slot_size;
+UINT            i;
+
+
+    /* No priority has messages.  */
+    queue_ptr -> tx_queue_priority_map =  ((ULONG) 0);
+
+    /* Clear the first and last message slot of each priority.  */
+    lists =  queue_ptr -> tx_queue_priority_lists;
+    for (i = ((UINT) 0); i < queue_ptr -> tx_queue_priorities; i++)
+    {
+
+        /* Clear the list of this priority.  */
+        lists[i * ((UINT) 2)] =                 ((ULONG) 0);
+        lists[(i * ((UINT) 2)) + ((UINT) 1)] =  ((ULONG) 0);
+    }
+
+    /* Calculate the size of each message slot, the link and the message.  */
+    slot_size =  ((ULONG) queue_ptr -> tx_queue_message_size) + ((ULONG) 1);
+
+    /* Link each message slot to the next one.  */
+    slot =  queue_ptr -> tx_queue_start;
+    for (i = ((UINT) 1); i < queue_ptr -> tx_queue_capacity; i++)
+    {
+
+        /* Link to the next message slot.  */
+        *slot =  ((ULONG) i) + ((ULONG) 1);
+
+        /* Move to the next message slot.  */
+        slot =  TX_ULONG_POINTER_ADD(slot, slot_size);
+    }
+
+    /* The last message slot ends the free list.  */
+    *slot =  ((ULONG) 0);
+
+    /* The free list starts with the first message slot.  */
+    queue_ptr -> tx_queue_priority_free =  ((ULONG) 1);
+}
+#endif
+
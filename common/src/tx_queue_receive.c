@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_queue_receive                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -61,6 +61,9 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*    _tx_queue_priority_insert         Place message by priority         */
+/*    _tx_queue_priority_remove         Remove highest priority message   */
 /*    _tx_thread_system_resume          Resume thread routine             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_thread_system_suspend         Suspend thread routine            */
@@ -77,6 +80,13 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added zero-copy reserve,      */
+/*                                            commit, acquire and release */
+/*                                            services, added priority    */
+/*                                            queues, added exact copy of */
+/*                                            messages with sizes in      */
+/*                                            bytes, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option)
@@ -92,6 +102,9 @@ UINT            suspended_count;
 TX_THREAD       *next_thread;
 TX_THREAD       *previous_thread;
 UINT            status;
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+TX_THREAD       *resume_list;
+#endif
 
 
     /* Default the status to TX_SUCCESS.  */
@@ -123,12 +136,39 @@ UINT            status;
     if (queue_ptr -> tx_queue_enqueued != TX_NO_MESSAGES)
     {
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+        /* Determine if there are any suspensions that take the slot of the message
+           directly. A suspended sender cannot do so while messages are reserved or
+           acquired, or when it reserves the slot, in which case the message is
+           received as if there were no suspensions and the suspended threads are
+           served afterwards.  */
+        if ((suspended_count == TX_NO_SUSPENSIONS) ||
+            ((queue_ptr -> tx_queue_suspension_list -> tx_thread_suspend_option != TX_TRUE) &&
+             ((queue_ptr -> tx_queue_reserved != ((UINT) 0)) || (queue_ptr -> tx_queue_acquired != ((UINT) 0)) ||
+              (queue_ptr -> tx_queue_suspension_list -> tx_thread_suspend_info == TX_QUEUE_RESERVE_SUSPEND))))
+#else
+
         /* Determine if there are any suspensions.  */
         if (suspended_count == TX_NO_SUSPENSIONS)
+#endif
         {
 
             /* There is a message waiting in the queue and there are no suspensi.  */
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+            /* Determine if the queue orders its messages by priority.  */
+            if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+            {
+
+                /* Yes, remove the oldest message of the highest priority.  */
+                _tx_queue_priority_remove(queue_ptr, TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr));
+            }
+            else
+            {
+#endif
+
             /* Setup source and destination pointers.  */
             source =       queue_ptr -> tx_queue_read;
             destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
@@ -136,7 +176,7 @@ UINT            status;
 
             /* Copy message. Note that the source and destination pointers are
                incremented by the macro.  */
-            TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
 
             /* Determine if we are at the end.  */
             if (source == queue_ptr -> tx_queue_end)
@@ -149,14 +189,61 @@ UINT            status;
             /* Setup the queue read pointer.   */
             queue_ptr -> tx_queue_read =  source;
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+            }
+#endif
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Determine if the slot is behind acquired messages.  */
+            if (queue_ptr -> tx_queue_acquired != ((UINT) 0))
+            {
+
+                /* Yes, the slot is held until the acquired messages are released.  */
+                queue_ptr -> tx_queue_consumed++;
+            }
+            else
+            {
+
+                /* Increase the amount of available storage.  */
+                queue_ptr -> tx_queue_available_storage++;
+            }
+#else
+
             /* Increase the amount of available storage.  */
             queue_ptr -> tx_queue_available_storage++;
+#endif
 
             /* Decrease the enqueued count.  */
             queue_ptr -> tx_queue_enqueued--;
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Give the room to the threads suspended on the queue, if any.  */
+            resume_list =  _tx_queue_zero_copy_settle(queue_ptr);
+
+            /* Determine if any suspended threads were served.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Disable preemption until all of the threads are resumed.  */
+                _tx_thread_preempt_disable++;
+            }
+#endif
+
             /* Restore interrupts.  */
             TX_RESTORE
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Determine if there are threads to resume.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Resume the threads.  */
+                _tx_queue_threads_resume(resume_list);
+            }
+#endif
         }
         else
         {
@@ -183,7 +270,7 @@ UINT            status;
 
                 /* Copy message. Note that the source and destination pointers are
                    incremented by the macro.  */
-                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+                TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
 
                 /* Message is now in the caller's destination. See if this is the only suspended thread
                    on the list.  */
@@ -248,6 +335,19 @@ UINT            status;
                    are one or more threads suspended trying to send another
                    message to this queue.  */
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+                /* Determine if the queue orders its messages by priority.  */
+                if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+                {
+
+                    /* Yes, remove the oldest message of the highest priority.  */
+                    _tx_queue_priority_remove(queue_ptr, TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr));
+                }
+                else
+                {
+#endif
+
                 /* Setup source and destination pointers.  */
                 source =       queue_ptr -> tx_queue_read;
                 destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
@@ -255,7 +355,7 @@ UINT            status;
 
                 /* Copy message. Note that the source and destination pointers are
                    incremented by the macro.  */
-                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+                TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
 
                 /* Determine if we are at the end.  */
                 if (source == queue_ptr -> tx_queue_end)
@@ -268,6 +368,10 @@ UINT            status;
                 /* Setup the queue read pointer.   */
                 queue_ptr -> tx_queue_read =  source;
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+                }
+#endif
+
                 /* Disable preemption.  */
                 _tx_thread_preempt_disable++;
 
@@ -286,6 +390,19 @@ UINT            status;
                 /* Decrement the preemption disable variable.  */
                 _tx_thread_preempt_disable--;
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+                /* Determine if the queue orders its messages by priority.  */
+                if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+                {
+
+                    /* Yes, place the message of the suspended thread by its priority.  */
+                    _tx_queue_priority_insert(queue_ptr, TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info), ((UINT) thread_ptr -> tx_thread_suspend_info));
+                }
+                else
+                {
+#endif
+
                 /* Setup source and destination pointers.  */
                 source =       TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
                 destination =  queue_ptr -> tx_queue_write;
@@ -293,7 +410,7 @@ UINT            status;
 
                 /* Copy message. Note that the source and destination pointers are
                    incremented by the macro.  */
-                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+                TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
 
                 /* Determine if we are at the end.  */
                 if (destination == queue_ptr -> tx_queue_end)
@@ -306,6 +423,10 @@ UINT            status;
                 /* Adjust the write pointer.  */
                 queue_ptr -> tx_queue_write =  destination;
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+                }
+#endif
+
                 /* Pickup thread pointer.  */
                 thread_ptr =  queue_ptr -> tx_queue_suspension_list;
 
@@ -372,8 +493,18 @@ UINT            status;
     else if (wait_option != TX_NO_WAIT)
     {
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+        /* Determine if the preempt disable flag is non-zero, or if the threads suspended on
+           the queue are sending to the queue. The latter only happens while all of the
+           queue is held by reservations and acquisitions.  */
+        if ((_tx_thread_preempt_disable != ((UINT) 0)) ||
+            ((suspended_count != TX_NO_SUSPENSIONS) && (queue_ptr -> tx_queue_suspension_list -> tx_thread_suspend_info >= TX_QUEUE_SEND_SUSPEND)))
+#else
+
         /* Determine if the preempt disable flag is non-zero.  */
         if (_tx_thread_preempt_disable != ((UINT) 0))
+#endif
         {
 
             /* Restore interrupts.  */
@@ -408,6 +539,12 @@ UINT            status;
             thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) destination_ptr;
             thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Remember the kind of suspension.  */
+            thread_ptr -> tx_thread_suspend_info =             TX_QUEUE_RECEIVE_SUSPEND;
+#endif
+
 #ifndef TX_NOT_INTERRUPTABLE
 
             /* Increment the suspension sequence number, which is used to identify
@@ -0,0 +1,488 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_receive_multiple                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives up to the specified number of messages from  */
+/*    the specified queue under a single interrupt lockout, placing them  */
+/*    consecutively in the destination area. Threads suspended on the     */
+/*    full queue are given the room freed by the messages, in the order   */
+/*    in which they suspended.                                            */
+/*                                                                        */
+/*    Messages are received until all are received or the queue is        */
+/*    empty. If the queue is empty before any message is received, this   */
+/*    function waits according to the option specified for the first      */
+/*    message.                                                            */
+/*                                                                        */
+/*    The messages are one message slot apart in the destination area,    */
+/*    which is the message size rounded up to whole ULONGs. Only the      */
+/*    bytes of each message are written.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    destination_ptr                   Pointer to the first message      */
+/*                                        destination                     */
+/*    count                             Number of messages to receive     */
+/*    actual_count                      Pointer to destination for the    */
+/*                                        number of messages received     */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*    _tx_queue_priority_insert         Place message by priority         */
+/*    _tx_queue_priority_remove         Remove highest priority message   */
+/*    _tx_queue_receive                 Receive message with suspension   */
+/*    _tx_queue_threads_resume          Resume served threads             */
+/*    _tx_queue_zero_copy_settle        Serve suspended threads           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_receive_multiple(TX_QUEUE *queue_ptr, VOID *destination_ptr, UINT count, UINT *actual_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *resume_list;
+TX_THREAD       *resume_last;
+ULONG           *source;
+ULONG           *destination;
+#ifndef TX_QUEUE_ENABLE_ZERO_COPY
+ULONG           *write_ptr;
+#endif
+UINT            size;
+UINT            received;
+UINT            suspended_count;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Start with no messages received and no threads to resume.  */
+    received =     ((UINT) 0);
+    resume_list =  TX_NULL;
+    resume_last =  TX_NULL;
+
+    /* Setup the destination pointer, which advances over the messages as they are copied.  */
+    destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
+
+    /* Disable interrupts to receive the messages from the queue.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_RECEIVE_MULTIPLE, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(destination_ptr), count, queue_ptr -> tx_queue_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+    /* Receive messages until all are received or the queue is empty.  */
+    while ((received < count) && (queue_ptr -> tx_queue_enqueued != TX_NO_MESSAGES))
+    {
+
+        /* Pickup the thread suspension count.  */
+        suspended_count =  queue_ptr -> tx_queue_suspended_count;
+
+        /* Pickup the head of the suspension list.  */
+        thread_ptr =  queue_ptr -> tx_queue_suspension_list;
+
+        /* Determine if a queue front suspension is present, whose message is ahead of
+           the messages in the queue.  */
+        if ((suspended_count != TX_NO_SUSPENSIONS) && (thread_ptr -> tx_thread_suspend_option == TX_TRUE))
+        {
+
+            /* Yes, return the message associated with this suspension.  */
+
+            /* See if this is the only suspended thread on the list.  */
+            suspended_count--;
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                queue_ptr -> tx_queue_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                            thread_ptr -> tx_thread_suspended_next;
+                queue_ptr -> tx_queue_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =   previous_thread;
+                previous_thread -> tx_thread_suspended_next =   next_thread;
+            }
+
+            /* Decrement the suspension count.  */
+            queue_ptr -> tx_queue_suspended_count =  suspended_count;
+
+            /* Prepare for resumption of the thread.  */
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Setup source pointer.  */
+            source =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            size =    queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Append the thread to the list of threads to resume, which keeps
+               the order in which the threads were suspended.  */
+            thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+            if (resume_list == TX_NULL)
+            {
+
+                /* First thread to resume.  */
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the thread after the last one.  */
+                resume_last -> tx_thread_suspended_next =  thread_ptr;
+            }
+            resume_last =  thread_ptr;
+        }
+        else
+        {
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+            /* Determine if the queue orders its messages by priority.  */
+            if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+            {
+
+                /* Yes, remove the oldest message of the highest priority.  */
+                _tx_queue_priority_remove(queue_ptr, destination);
+
+                /* Move the destination pointer past the message.  */
+                destination =  TX_ULONG_POINTER_ADD(destination, queue_ptr -> tx_queue_message_size);
+            }
+            else
+            {
+#endif
+
+            /* Setup source pointer.  */
+            source =  queue_ptr -> tx_queue_read;
+            size =    queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+            /* Determine if we are at the end.  */
+            if (source == queue_ptr -> tx_queue_end)
+            {
+
+                /* Yes, wrap around to the beginning.  */
+                source =  queue_ptr -> tx_queue_start;
+            }
+
+            /* Setup the queue read pointer.   */
+            queue_ptr -> tx_queue_read =  source;
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+            }
+#endif
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Determine if the slot is behind acquired messages.  */
+            if (queue_ptr -> tx_queue_acquired != ((UINT) 0))
+            {
+
+                /* Yes, the slot is held until the acquired messages are released.  */
+                queue_ptr -> tx_queue_consumed++;
+            }
+            else
+            {
+
+                /* Increase the amount of available storage.  */
+                queue_ptr -> tx_queue_available_storage++;
+            }
+
+            /* Decrease the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued--;
+
+            /* Determine if there are threads suspended on the queue.  */
+            if (queue_ptr -> tx_queue_suspended_count != TX_NO_SUSPENSIONS)
+            {
+
+                /* Give the room to the suspended threads, which may place more
+                   messages in the queue.  */
+                thread_ptr =  _tx_queue_zero_copy_settle(queue_ptr);
+
+                /* Add the served threads to the list of threads to resume.  */
+                if (thread_ptr != TX_NULL)
+                {
+
+                    /* Determine if there are other threads to resume.  */
+                    if (resume_list == TX_NULL)
+                    {
+
+                        /* No, the served threads are the first to resume.  */
+                        resume_list =  thread_ptr;
+                    }
+                    else
+                    {
+
+                        /* Link the served threads after the last one.  */
+                        resume_last -> tx_thread_suspended_next =  thread_ptr;
+                    }
+
+                    /* Find the last of the served threads.  */
+                    while (thread_ptr -> tx_thread_suspended_next != TX_NULL)
+                    {
+
+                        /* Move to the next served thread.  */
+                        thread_ptr =  thread_ptr -> tx_thread_suspended_next;
+                    }
+                    resume_last =  thread_ptr;
+                }
+            }
+#else
+
+            /* Determine if a thread is suspended sending to the full queue.  */
+            if (suspended_count != TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, place its message in the slot just freed.  */
+
+                /* See if this is the only suspended thread on the list.  */
+                suspended_count--;
+                if (suspended_count == TX_NO_SUSPENSIONS)
+                {
+
+                    /* Yes, the only suspended thread.  */
+
+                    /* Update the head pointer.  */
+                    queue_ptr -> tx_queue_suspension_list =  TX_NULL;
+                }
+                else
+                {
+
+                    /* At least one more thread is on the same suspension list.  */
+
+                    /* Update the list head pointer.  */
+                    next_thread =                            thread_ptr -> tx_thread_suspended_next;
+                    queue_ptr -> tx_queue_suspension_list =  next_thread;
+
+                    /* Update the links of the adjacent threads.  */
+                    previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                    next_thread -> tx_thread_suspended_previous =   previous_thread;
+                    previous_thread -> tx_thread_suspended_next =   next_thread;
+                }
+
+                /* Decrement the suspension count.  */
+                queue_ptr -> tx_queue_suspended_count =  suspended_count;
+
+                /* Prepare for resumption of the thread.  */
+
+                /* Clear cleanup routine to avoid timeout.  */
+                thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+                /* Determine if the queue orders its messages by priority.  */
+                if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+                {
+
+                    /* Yes, place the message of the suspended thread by its priority.  */
+                    _tx_queue_priority_insert(queue_ptr, TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info), ((UINT) thread_ptr -> tx_thread_suspend_info));
+                }
+                else
+                {
+#endif
+
+                /* Setup source and write pointers.  */
+                source =     TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                write_ptr =  queue_ptr -> tx_queue_write;
+                size =       queue_ptr -> tx_queue_message_size;
+
+                /* Copy message. Note that the source and write pointers are
+                   incremented by the macro.  */
+                TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, write_ptr, size)
+
+                /* Determine if we are at the end.  */
+                if (write_ptr == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    write_ptr =  queue_ptr -> tx_queue_start;
+                }
+
+                /* Adjust the write pointer.  */
+                queue_ptr -> tx_queue_write =  write_ptr;
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+                }
+#endif
+
+                /* Put return status into the thread control block.  */
+                thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+                /* Append the thread to the list of threads to resume, which keeps
+                   the order in which the threads were suspended.  */
+                thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+                if (resume_list == TX_NULL)
+                {
+
+                    /* First thread to resume.  */
+                    resume_list =  thread_ptr;
+                }
+                else
+                {
+
+                    /* Link the thread after the last one.  */
+                    resume_last -> tx_thread_suspended_next =  thread_ptr;
+                }
+                resume_last =  thread_ptr;
+            }
+            else
+            {
+
+                /* Increase the amount of available storage.  */
+                queue_ptr -> tx_queue_available_storage++;
+
+                /* Decrease the enqueued count.  */
+                queue_ptr -> tx_queue_enqueued--;
+            }
+#endif
+        }
+
+        /* Count the message.  */
+        received++;
+    }
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+    /* Determine if any messages were received.  */
+    if (received != ((UINT) 0))
+    {
+
+        /* Increment the total messages received counter.  */
+        _tx_queue_performance__messages_received_count =  _tx_queue_performance__messages_received_count + ((ULONG) received);
+
+        /* Increment the number of messages received from this queue.  */
+        queue_ptr -> tx_queue_performance_messages_received_count =  queue_ptr -> tx_queue_performance_messages_received_count + ((ULONG) received);
+    }
+#endif
+
+    /* Determine if any suspended threads were served.  */
+    if (resume_list != TX_NULL)
+    {
+
+        /* Disable preemption until all of the threads are resumed.  */
+        _tx_thread_preempt_disable++;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if there are threads to resume.  */
+    if (resume_list != TX_NULL)
+    {
+
+        /* Resume the threads.  */
+        _tx_queue_threads_resume(resume_list);
+    }
+
+    /* Determine if suspension is requested on the empty queue.  */
+    if (received == ((UINT) 0))
+    {
+
+        /* Determine if suspension is requested.  */
+        if (wait_option != TX_NO_WAIT)
+        {
+
+            /* Receive the first message, suspending until one arrives.  */
+            status =  _tx_queue_receive(queue_ptr, destination_ptr, wait_option);
+
+            /* Determine if the message was received.  */
+            if (status == TX_SUCCESS)
+            {
+
+                /* Yes, one message was received.  */
+                received =  ((UINT) 1);
+            }
+        }
+        else
+        {
+
+            /* Return a queue empty error to the caller.  */
+            status =  TX_QUEUE_EMPTY;
+        }
+    }
+
+    /* Return the number of messages received.  */
+    *actual_count =  received;
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,196 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_receive_release                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases a message acquired with                      */
+/*    tx_queue_receive_acquire. Once all of the outstanding acquisitions  */
+/*    of the queue are released, their slots become available again and   */
+/*    are given to threads suspended on the queue, if any.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    message_ptr                       Pointer to the acquired message   */
+/*                                        slot                            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_threads_resume          Resume served threads             */
+/*    _tx_queue_zero_copy_settle        Serve suspended threads           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_receive_release(TX_QUEUE *queue_ptr, VOID *message_ptr)
+{
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *resume_list;
+ULONG           *slot_ptr;
+ULONG           distance;
+UINT            status;
+
+
+    /* Disable interrupts to release the message.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_RECEIVE_RELEASE, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(message_ptr), queue_ptr -> tx_queue_acquired, queue_ptr -> tx_queue_available_storage, TX_TRACE_QUEUE_EVENTS)
+
+    /* Determine how far the message slot is behind the read pointer.  */
+    slot_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(message_ptr);
+    if (slot_ptr < queue_ptr -> tx_queue_read)
+    {
+
+        /* The slot is in the same pass over the queue area.  */
+        distance =  TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_read, slot_ptr);
+    }
+    else
+    {
+
+        /* The read pointer has wrapped around since the slot.  */
+        distance =  TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_read, queue_ptr -> tx_queue_start) + TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_end, slot_ptr);
+    }
+
+    /* Determine if there is an acquisition to release and if the slot is among the slots held.  */
+    if ((queue_ptr -> tx_queue_acquired == ((UINT) 0)) ||
+        (distance > (((ULONG) queue_ptr -> tx_queue_consumed) * ((ULONG) queue_ptr -> tx_queue_message_size))))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* The slot is not acquired, return error completion.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Decrease the acquired count.  */
+        queue_ptr -> tx_queue_acquired--;
+
+        /* Start with no threads to resume.  */
+        resume_list =  TX_NULL;
+
+        /* Determine if this was the last outstanding acquisition.  Acquisitions may
+           be released in any order, the slots become available together.  */
+        if (queue_ptr -> tx_queue_acquired == ((UINT) 0))
+        {
+
+            /* Yes, the slots of the acquired messages, and of the messages received
+               while they were held, are now available.  */
+            queue_ptr -> tx_queue_available_storage =  queue_ptr -> tx_queue_available_storage + queue_ptr -> tx_queue_consumed;
+            queue_ptr -> tx_queue_consumed =           ((UINT) 0);
+
+            /* Give the room to the threads suspended on the queue, if any.  */
+            resume_list =  _tx_queue_zero_copy_settle(queue_ptr);
+
+            /* Determine if any suspended threads were served.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Disable preemption until all of the threads are resumed.  */
+                _tx_thread_preempt_disable++;
+            }
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if there are threads to resume.  */
+        if (resume_list != TX_NULL)
+        {
+
+            /* Resume the threads.  */
+            _tx_queue_threads_resume(resume_list);
+        }
+
+        /* Return successful completion.  */
+        status =  TX_SUCCESS;
+    }
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (queue_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (message_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -29,6 +29,7 @@
 #include "tx_trace.h"
 #include "tx_thread.h"
 #include "tx_queue.h"
+#include "tx_wait_set.h"
 
 
 /**************************************************************************/
@@ -36,7 +37,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_queue_send                                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -59,10 +60,13 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*    _tx_queue_priority_send           Send message by priority          */
 /*    _tx_thread_system_resume          Resume thread routine             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_thread_system_suspend         Suspend thread routine            */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*    _tx_wait_set_signal               Signal wait set member            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -75,6 +79,14 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added zero-copy reserve,      */
+/*                                            commit, acquire and release */
+/*                                            services, added priority    */
+/*                                            queues, added wait sets,    */
+/*                                            added exact copy of         */
+/*                                            messages with sizes in      */
+/*                                            bytes, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option)
@@ -90,6 +102,9 @@ UINT            suspended_count;
 TX_THREAD       *next_thread;
 TX_THREAD       *previous_thread;
 UINT            status;
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+TX_THREAD       *resume_list;
+#endif
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 #endif
@@ -98,6 +113,19 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
     /* Default the status to TX_SUCCESS.  */
     status =  TX_SUCCESS;
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+    /* Determine if the queue orders its messages by priority.  */
+    if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+    {
+
+        /* Yes, send the message at the lowest priority.  */
+        status =  _tx_queue_priority_send(queue_ptr, source_ptr, (queue_ptr -> tx_queue_priorities - ((UINT) 1)), wait_option);
+    }
+    else
+    {
+#endif
+
     /* Disable interrupts to place message in the queue.  */
     TX_DISABLE
 
@@ -125,8 +153,17 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 
         /* There is room for the message in the queue.  */
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+        /* Determine if there are threads suspended on this queue that receive the message
+           by copy, and if the message does not have to stay behind reserved messages.  */
+        if ((suspended_count == TX_NO_SUSPENSIONS) || (queue_ptr -> tx_queue_reserved != ((UINT) 0)) ||
+            (queue_ptr -> tx_queue_suspension_list -> tx_thread_suspend_info != TX_QUEUE_RECEIVE_SUSPEND))
+#else
+
         /* Determine if there are suspended on this queue.  */
         if (suspended_count == TX_NO_SUSPENSIONS)
+#endif
         {
 
             /* No suspended threads, simply place the message in the queue.  */
@@ -134,8 +171,26 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
             /* Reduce the amount of available storage.  */
             queue_ptr -> tx_queue_available_storage--;
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Determine if the message is behind reserved messages.  */
+            if (queue_ptr -> tx_queue_reserved != ((UINT) 0))
+            {
+
+                /* Yes, the message is held back until the reservations are committed.  */
+                queue_ptr -> tx_queue_pending++;
+            }
+            else
+            {
+
+                /* Increase the enqueued count.  */
+                queue_ptr -> tx_queue_enqueued++;
+            }
+#else
+
             /* Increase the enqueued count.  */
             queue_ptr -> tx_queue_enqueued++;
+#endif
 
             /* Setup source and destination pointers.  */
             source =       TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
@@ -144,7 +199,7 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 
             /* Copy message. Note that the source and destination pointers are
                incremented by the macro.  */
-            TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
 
             /* Determine if we are at the end.  */
             if (destination == queue_ptr -> tx_queue_end)
@@ -157,6 +212,20 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
             /* Adjust the write pointer.  */
             queue_ptr -> tx_queue_write =  destination;
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Give the message to the threads suspended on the queue, if any.  */
+            resume_list =  _tx_queue_zero_copy_settle(queue_ptr);
+
+            /* Determine if any suspended threads were served.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Disable preemption until all of the threads are resumed.  */
+                _tx_thread_preempt_disable++;
+            }
+#endif
+
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 
             /* Pickup the notify callback routine for this queue.  */
@@ -168,6 +237,17 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
             /* Restore interrupts.  */
             TX_RESTORE
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Determine if there are threads to resume.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Resume the threads.  */
+                _tx_queue_threads_resume(resume_list);
+            }
+#endif
+
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 
             /* Determine if a notify callback is required.  */
@@ -178,6 +258,17 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
                 (queue_send_notify)(queue_ptr);
             }
 #endif
+
+#ifdef TX_ENABLE_WAIT_SET
+
+            /* Determine if the queue is a member of a wait set.  */
+            if (queue_ptr -> tx_queue_wait_set_member.tx_wait_set_member_set != TX_NULL)
+            {
+
+                /* Yes, resume a thread waiting on the wait set if the queue is still ready.  */
+                _tx_wait_set_signal(&(queue_ptr -> tx_queue_wait_set_member));
+            }
+#endif
         }
         else
         {
@@ -232,7 +323,7 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 
             /* Copy message. Note that the source and destination pointers are
                incremented by the macro.  */
-            TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
 
             /* Put return status into the thread control block.  */
             thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
@@ -279,8 +370,18 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
     else if (wait_option != TX_NO_WAIT)
     {
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+        /* Determine if the preempt disable flag is non-zero, or if the threads suspended on
+           the queue are receiving from the queue. The latter only happens while all of the
+           queue is held by reservations and acquisitions.  */
+        if ((_tx_thread_preempt_disable != ((UINT) 0)) ||
+            ((suspended_count != TX_NO_SUSPENSIONS) && (queue_ptr -> tx_queue_suspension_list -> tx_thread_suspend_info < TX_QUEUE_SEND_SUSPEND)))
+#else
+
         /* Determine if the preempt disable flag is non-zero.  */
         if (_tx_thread_preempt_disable != ((UINT) 0))
+#endif
         {
 
             /* Restore interrupts.  */
@@ -315,6 +416,12 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
             thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) source_ptr;
             thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Remember the kind of suspension.  */
+            thread_ptr -> tx_thread_suspend_info =             TX_QUEUE_SEND_SUSPEND;
+#endif
+
 #ifndef TX_NOT_INTERRUPTABLE
 
             /* Increment the suspension sequence number, which is used to identify
@@ -422,6 +529,10 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
         status =  TX_QUEUE_FULL;
     }
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+    }
+#endif
+
     /* Return completion status.  */
     return(status);
 }
@@ -0,0 +1,244 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_send_commit                               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function commits a message that was built in a slot reserved   */
+/*    with tx_queue_send_reserve. Once all of the outstanding             */
+/*    reservations of the queue are committed, the messages held back     */
+/*    become visible in the order of their slots and are given to         */
+/*    threads suspended on the queue, if any.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    message_ptr                       Pointer to the reserved message   */
+/*                                        slot                            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_threads_resume          Resume served threads             */
+/*    _tx_queue_zero_copy_settle        Serve suspended threads           */
+/*    _tx_wait_set_signal               Signal wait set member            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_send_commit(TX_QUEUE *queue_ptr, VOID *message_ptr)
+{
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *resume_list;
+ULONG           *slot_ptr;
+ULONG           distance;
+UINT            status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
+#endif
+
+
+    /* Disable interrupts to commit the message.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_SEND_COMMIT, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(message_ptr), queue_ptr -> tx_queue_reserved, queue_ptr -> tx_queue_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+    /* Determine how far the message slot is behind the write pointer.  */
+    slot_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(message_ptr);
+    if (slot_ptr < queue_ptr -> tx_queue_write)
+    {
+
+        /* The slot is in the same pass over the queue area.  */
+        distance =  TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_write, slot_ptr);
+    }
+    else
+    {
+
+        /* The write pointer has wrapped around since the slot.  */
+        distance =  TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_write, queue_ptr -> tx_queue_start) + TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_end, slot_ptr);
+    }
+
+    /* Determine if there is a reservation to commit and if the slot is among the slots held back.  */
+    if ((queue_ptr -> tx_queue_reserved == ((UINT) 0)) ||
+        (distance > (((ULONG) queue_ptr -> tx_queue_pending) * ((ULONG) queue_ptr -> tx_queue_message_size))))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* The slot is not reserved, return error completion.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total messages sent counter.  */
+        _tx_queue_performance_messages_sent_count++;
+
+        /* Increment the number of messages sent to this queue.  */
+        queue_ptr -> tx_queue_performance_messages_sent_count++;
+#endif
+
+        /* Decrease the reserved count.  */
+        queue_ptr -> tx_queue_reserved--;
+
+        /* Start with no threads to resume.  */
+        resume_list =  TX_NULL;
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Start without a notify callback.  */
+        queue_send_notify =  TX_NULL;
+#endif
+
+        /* Determine if this was the last outstanding reservation.  Reservations may
+           be committed in any order, the messages become visible together.  */
+        if (queue_ptr -> tx_queue_reserved == ((UINT) 0))
+        {
+
+            /* Yes, the messages held back are now enqueued.  */
+            queue_ptr -> tx_queue_enqueued =  queue_ptr -> tx_queue_enqueued + queue_ptr -> tx_queue_pending;
+            queue_ptr -> tx_queue_pending =   ((UINT) 0);
+
+            /* Give the messages to the threads suspended on the queue, if any.  */
+            resume_list =  _tx_queue_zero_copy_settle(queue_ptr);
+
+            /* Determine if any suspended threads were served.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Disable preemption until all of the threads are resumed.  */
+                _tx_thread_preempt_disable++;
+            }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Pickup the notify callback routine for this queue.  */
+            queue_send_notify =  queue_ptr -> tx_queue_send_notify;
+#endif
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if there are threads to resume.  */
+        if (resume_list != TX_NULL)
+        {
+
+            /* Resume the threads.  */
+            _tx_queue_threads_resume(resume_list);
+        }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if a notify callback is required.  */
+        if (queue_send_notify != TX_NULL)
+        {
+
+            /* Call application queue send notification.  */
+            (queue_send_notify)(queue_ptr);
+        }
+#endif
+
+#ifdef TX_ENABLE_WAIT_SET
+
+        /* Determine if the queue is a member of a wait set.  */
+        if (queue_ptr -> tx_queue_wait_set_member.tx_wait_set_member_set != TX_NULL)
+        {
+
+            /* Yes, resume a thread waiting on the wait set if the queue is still ready.  */
+            _tx_wait_set_signal(&(queue_ptr -> tx_queue_wait_set_member));
+        }
+#endif
+
+        /* Return successful completion.  */
+        status =  TX_SUCCESS;
+    }
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (queue_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (message_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
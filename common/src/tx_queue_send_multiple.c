@@ -0,0 +1,440 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_send_multiple                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places up to the specified number of messages into    */
+/*    the specified queue under a single interrupt lockout. The messages  */
+/*    are consecutive in the source area. Threads suspended on the empty  */
+/*    queue receive the messages directly, in the order in which they     */
+/*    suspended, and the send notification is called once for all of the  */
+/*    messages.                                                           */
+/*                                                                        */
+/*    Messages are sent until all are sent or the queue is full. If the   */
+/*    queue is full before any message is sent, this function waits       */
+/*    according to the option specified for room for the first message.   */
+/*                                                                        */
+/*    The messages are one message slot apart in the source area, which   */
+/*    is the message size rounded up to whole ULONGs. Only the bytes of   */
+/*    each message are read.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    source_ptr                        Pointer to the first message      */
+/*                                        source                          */
+/*    count                             Number of messages to send        */
+/*    actual_count                      Pointer to destination for the    */
+/*                                        number of messages sent         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*    _tx_queue_priority_insert         Place message by priority         */
+/*    _tx_queue_send                    Send message with suspension      */
+/*    _tx_queue_threads_resume          Resume served threads             */
+/*    _tx_queue_zero_copy_settle        Serve suspended threads           */
+/*    _tx_wait_set_signal               Signal wait set member            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_send_multiple(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT count, UINT *actual_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *resume_list;
+TX_THREAD       *resume_last;
+ULONG           *source;
+ULONG           *destination;
+UINT            size;
+UINT            sent;
+UINT            suspended_count;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+UINT            status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
+#endif
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Start with no messages sent and no threads to resume.  */
+    sent =         ((UINT) 0);
+    resume_list =  TX_NULL;
+    resume_last =  TX_NULL;
+
+    /* Setup the source pointer, which advances over the messages as they are copied.  */
+    source =  TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
+
+    /* Disable interrupts to place the messages in the queue.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_SEND_MULTIPLE, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(source_ptr), count, queue_ptr -> tx_queue_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+    /* Send messages until all are sent or the queue is full.  */
+    while ((sent < count) && (queue_ptr -> tx_queue_available_storage != TX_NO_MESSAGES))
+    {
+
+        /* Pickup the thread suspension count.  */
+        suspended_count =  queue_ptr -> tx_queue_suspended_count;
+
+        /* Pickup the head of the suspension list.  */
+        thread_ptr =  queue_ptr -> tx_queue_suspension_list;
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+        /* Determine if a thread suspended on the queue receives the message by copy,
+           and if the message does not have to stay behind reserved messages.  */
+        if ((suspended_count != TX_NO_SUSPENSIONS) && (queue_ptr -> tx_queue_reserved == ((UINT) 0)) &&
+            (thread_ptr -> tx_thread_suspend_info == TX_QUEUE_RECEIVE_SUSPEND))
+#else
+
+        /* Determine if a thread is suspended on the empty queue.  */
+        if (suspended_count != TX_NO_SUSPENSIONS)
+#endif
+        {
+
+            /* Yes, copy the message to the suspended thread's destination.  */
+
+            /* See if this is the only suspended thread on the list.  */
+            suspended_count--;
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                queue_ptr -> tx_queue_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                            thread_ptr -> tx_thread_suspended_next;
+                queue_ptr -> tx_queue_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =   previous_thread;
+                previous_thread -> tx_thread_suspended_next =   next_thread;
+            }
+
+            /* Decrement the suspension count.  */
+            queue_ptr -> tx_queue_suspended_count =  suspended_count;
+
+            /* Prepare for resumption of the thread.  */
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Setup destination pointer.  */
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Append the thread to the list of threads to resume, which keeps
+               the order in which the threads were suspended.  */
+            thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+            if (resume_list == TX_NULL)
+            {
+
+                /* First thread to resume.  */
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the thread after the last one.  */
+                resume_last -> tx_thread_suspended_next =  thread_ptr;
+            }
+            resume_last =  thread_ptr;
+        }
+        else
+        {
+
+            /* Reduce the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage--;
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+            /* Determine if the message is behind reserved messages.  */
+            if (queue_ptr -> tx_queue_reserved != ((UINT) 0))
+            {
+
+                /* Yes, the message is held back until the reservations are committed.  */
+                queue_ptr -> tx_queue_pending++;
+            }
+            else
+            {
+
+                /* Increase the enqueued count.  */
+                queue_ptr -> tx_queue_enqueued++;
+            }
+#else
+
+            /* Increase the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued++;
+#endif
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+            /* Determine if the queue orders its messages by priority.  */
+            if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+            {
+
+                /* Yes, place the message at the lowest priority.  */
+                _tx_queue_priority_insert(queue_ptr, source, (queue_ptr -> tx_queue_priorities - ((UINT) 1)));
+
+                /* Move the source pointer past the message.  */
+                source =  TX_ULONG_POINTER_ADD(source, queue_ptr -> tx_queue_message_size);
+            }
+            else
+            {
+#endif
+
+            /* Setup destination pointer.  */
+            destination =  queue_ptr -> tx_queue_write;
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+            /* Determine if we are at the end.  */
+            if (destination == queue_ptr -> tx_queue_end)
+            {
+
+                /* Yes, wrap around to the beginning.  */
+                destination =  queue_ptr -> tx_queue_start;
+            }
+
+            /* Adjust the write pointer.  */
+            queue_ptr -> tx_queue_write =  destination;
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+            }
+#endif
+        }
+
+        /* Count the message.  */
+        sent++;
+    }
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+    /* Determine if the queue has changed.  */
+    if (sent != ((UINT) 0))
+    {
+
+        /* Serve the threads still suspended on the queue, if any.  */
+        thread_ptr =  _tx_queue_zero_copy_settle(queue_ptr);
+
+        /* Add the served threads to the list of threads to resume.  */
+        if (thread_ptr != TX_NULL)
+        {
+
+            /* Determine if there are other threads to resume.  */
+            if (resume_list == TX_NULL)
+            {
+
+                /* No, the served threads are the first to resume.  */
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the served threads after the last one.  */
+                resume_last -> tx_thread_suspended_next =  thread_ptr;
+            }
+
+            /* Find the last of the served threads.  */
+            while (thread_ptr -> tx_thread_suspended_next != TX_NULL)
+            {
+
+                /* Move to the next served thread.  */
+                thread_ptr =  thread_ptr -> tx_thread_suspended_next;
+            }
+            resume_last =  thread_ptr;
+        }
+    }
+#endif
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+    /* Determine if any messages were sent.  */
+    if (sent != ((UINT) 0))
+    {
+
+        /* Increment the total messages sent counter.  */
+        _tx_queue_performance_messages_sent_count =  _tx_queue_performance_messages_sent_count + ((ULONG) sent);
+
+        /* Increment the number of messages sent to this queue.  */
+        queue_ptr -> tx_queue_performance_messages_sent_count =  queue_ptr -> tx_queue_performance_messages_sent_count + ((ULONG) sent);
+    }
+
+    /* Determine if the queue was full without suspension.  */
+    else if (wait_option == TX_NO_WAIT)
+    {
+
+        /* Increment the number of full non-suspensions on this queue.  */
+        queue_ptr -> tx_queue_performance_full_error_count++;
+
+        /* Increment the total number of full non-suspensions.  */
+        _tx_queue_performance_full_error_count++;
+    }
+    else
+    {
+
+        /* The message is sent with suspension below.  */
+    }
+#endif
+
+    /* Determine if any suspended threads were served.  */
+    if (resume_list != TX_NULL)
+    {
+
+        /* Disable preemption until all of the threads are resumed.  */
+        _tx_thread_preempt_disable++;
+    }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+    /* Pickup the notify callback routine for this queue.  */
+    queue_send_notify =  queue_ptr -> tx_queue_send_notify;
+#endif
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if there are threads to resume.  */
+    if (resume_list != TX_NULL)
+    {
+
+        /* Resume the threads.  */
+        _tx_queue_threads_resume(resume_list);
+    }
+
+    /* Determine if any messages were sent.  */
+    if (sent != ((UINT) 0))
+    {
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if a notify callback is required.  */
+        if (queue_send_notify != TX_NULL)
+        {
+
+            /* Call application queue send notification once for all of the messages.  */
+            (queue_send_notify)(queue_ptr);
+        }
+#endif
+
+#ifdef TX_ENABLE_WAIT_SET
+
+        /* Determine if the queue is a member of a wait set.  */
+        if (queue_ptr -> tx_queue_wait_set_member.tx_wait_set_member_set != TX_NULL)
+        {
+
+            /* Yes, resume a thread waiting on the wait set if the queue is still ready.  */
+            _tx_wait_set_signal(&(queue_ptr -> tx_queue_wait_set_member));
+        }
+#endif
+    }
+
+    /* Determine if suspension is requested on the full queue.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Send the first message, suspending until there is room for it.  */
+        status =  _tx_queue_send(queue_ptr, source_ptr, wait_option);
+
+        /* Determine if the message was sent.  */
+        if (status == TX_SUCCESS)
+        {
+
+            /* Yes, one message was sent.  */
+            sent =  ((UINT) 1);
+        }
+    }
+    else
+    {
+
+        /* Return a queue full error to the caller.  */
+        status =  TX_QUEUE_FULL;
+    }
+
+    /* Return the number of messages sent.  */
+    *actual_count =  sent;
+
+    /* Return completion status.  */
+    return(status);
+}
+
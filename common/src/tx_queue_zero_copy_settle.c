@@ -0,0 +1,404 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_zero_copy_settle                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function serves the threads suspended on a queue that uses     */
+/*    the zero-copy services, in suspension order, for as long as the     */
+/*    queue has messages for suspended receive and acquire requests or    */
+/*    room for suspended send, front send and reserve requests. It is     */
+/*    called with interrupts disabled after the messages or the room of   */
+/*    the queue have changed.                                             */
+/*                                                                        */
+/*    The served threads are removed from the suspension list and         */
+/*    returned in a list that the caller resumes with                     */
+/*    _tx_queue_threads_resume, after restoring interrupts.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    resume_list                       List of threads to resume, linked */
+/*                                        by their suspended next         */
+/*                                        pointers                        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_flush                   Flush queue messages              */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_release         Release acquired message          */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_commit             Commit reserved message           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+TX_THREAD  *_tx_queue_zero_copy_settle(TX_QUEUE *queue_ptr)
+{
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *resume_list;
+TX_THREAD       *resume_last;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+ULONG           *slot_ptr;
+ULONG           *source;
+ULONG           *destination;
+VOID            **message_ptr;
+UINT            size;
+UINT            suspended_count;
+UINT            served;
+
+
+    /* Start with no threads to resume.  */
+    resume_list =  TX_NULL;
+    resume_last =  TX_NULL;
+
+    /* Pickup the thread suspension count.  */
+    suspended_count =  queue_ptr -> tx_queue_suspended_count;
+
+    /* Serve the suspended threads in suspension order, for as long as the
+       queue allows it.  */
+    while (suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Pickup the head of the suspension list.  */
+        thread_ptr =  queue_ptr -> tx_queue_suspension_list;
+
+        /* Default to serving the thread.  */
+        served =  TX_TRUE;
+
+        /* Determine if the thread is receiving from the queue.  */
+        if (thread_ptr -> tx_thread_suspend_info < TX_QUEUE_SEND_SUSPEND)
+        {
+
+            /* Determine if there is a message for the thread.  */
+            if (queue_ptr -> tx_queue_enqueued == TX_NO_MESSAGES)
+            {
+
+                /* No, the thread must keep waiting.  */
+                served =  TX_FALSE;
+            }
+            else
+            {
+
+                /* Remove the message at the front of the queue.  */
+                slot_ptr =  queue_ptr -> tx_queue_read;
+                source =    TX_ULONG_POINTER_ADD(slot_ptr, queue_ptr -> tx_queue_message_size);
+
+                /* Determine if we are at the end.  */
+                if (source == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    source =  queue_ptr -> tx_queue_start;
+                }
+
+                /* Setup the queue read pointer.   */
+                queue_ptr -> tx_queue_read =  source;
+
+                /* Decrease the enqueued count.  */
+                queue_ptr -> tx_queue_enqueued--;
+
+                /* Determine if the thread acquires the message.  */
+                if (thread_ptr -> tx_thread_suspend_info == TX_QUEUE_ACQUIRE_SUSPEND)
+                {
+
+                    /* Yes, give the slot of the message to the thread, which holds
+                       the slot until the message is released.  */
+                    message_ptr =   TX_VOID_TO_INDIRECT_VOID_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                    *message_ptr =  (VOID *) slot_ptr;
+
+                    /* Increase the acquired and consumed counts.  */
+                    queue_ptr -> tx_queue_acquired++;
+                    queue_ptr -> tx_queue_consumed++;
+                }
+                else
+                {
+
+                    /* Setup source and destination pointers.  */
+                    source =       slot_ptr;
+                    destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                    size =         queue_ptr -> tx_queue_message_size;
+
+                    /* Copy message. Note that the source and destination pointers are
+                       incremented by the macro.  */
+                    TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+                    /* Determine if the slot is behind acquired messages.  */
+                    if (queue_ptr -> tx_queue_acquired != ((UINT) 0))
+                    {
+
+                        /* Yes, the slot is held until the acquired messages are released.  */
+                        queue_ptr -> tx_queue_consumed++;
+                    }
+                    else
+                    {
+
+                        /* Increase the amount of available storage.  */
+                        queue_ptr -> tx_queue_available_storage++;
+                    }
+                }
+            }
+        }
+
+        /* The thread is sending to the queue, determine if there is room.  */
+        else if (queue_ptr -> tx_queue_available_storage == TX_NO_MESSAGES)
+        {
+
+            /* No, the thread must keep waiting.  */
+            served =  TX_FALSE;
+        }
+
+        /* Determine if the thread is sending to the front of the queue.  */
+        else if (thread_ptr -> tx_thread_suspend_info == TX_QUEUE_FRONT_SEND_SUSPEND)
+        {
+
+            /* Determine if the slot in front of the read pointer is held by acquired
+               messages.  */
+            if (queue_ptr -> tx_queue_consumed != ((UINT) 0))
+            {
+
+                /* Yes, determine if the queue is empty, in which case the front of the
+                   queue is at the write pointer.  */
+                if ((queue_ptr -> tx_queue_enqueued == TX_NO_MESSAGES) && (queue_ptr -> tx_queue_pending == ((UINT) 0)))
+                {
+
+                    /* Move the write pointer past its slot and the read pointer along
+                       with it, so the read pointer steps back to the slot below.  */
+                    destination =  TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_write, queue_ptr -> tx_queue_message_size);
+
+                    /* Determine if we are at the end.  */
+                    if (destination == queue_ptr -> tx_queue_end)
+                    {
+
+                        /* Yes, wrap around to the beginning.  */
+                        destination =  queue_ptr -> tx_queue_start;
+                    }
+
+                    /* Adjust the write and read pointers.  */
+                    queue_ptr -> tx_queue_write =  destination;
+                    queue_ptr -> tx_queue_read =   destination;
+                }
+                else
+                {
+
+                    /* The thread must keep waiting until the acquired messages are
+                       released.  */
+                    served =  TX_FALSE;
+                }
+            }
+
+            /* Determine if the message can be placed in front.  */
+            if (served == TX_TRUE)
+            {
+
+                /* See if the read pointer is at the beginning of the queue area.  */
+                if (queue_ptr -> tx_queue_read == queue_ptr -> tx_queue_start)
+                {
+
+                    /* Adjust the read pointer to the last message at the end of the
+                       queue.  */
+                    queue_ptr -> tx_queue_read =  TX_ULONG_POINTER_SUB(queue_ptr -> tx_queue_end, queue_ptr -> tx_queue_message_size);
+                }
+                else
+                {
+
+                    /* Not at the beginning of the queue, just move back one message.  */
+                    queue_ptr -> tx_queue_read =  TX_ULONG_POINTER_SUB(queue_ptr -> tx_queue_read, queue_ptr -> tx_queue_message_size);
+                }
+
+                /* Reduce the amount of available storage.  */
+                queue_ptr -> tx_queue_available_storage--;
+
+                /* Increase the enqueued count.  */
+                queue_ptr -> tx_queue_enqueued++;
+
+                /* Setup source and destination pointers.  */
+                source =       TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                destination =  queue_ptr -> tx_queue_read;
+                size =         queue_ptr -> tx_queue_message_size;
+
+                /* Copy message. Note that the source and destination pointers are
+                   incremented by the macro.  */
+                TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+            }
+        }
+        else
+        {
+
+            /* Pickup the slot at the write pointer.  */
+            slot_ptr =     queue_ptr -> tx_queue_write;
+            destination =  TX_ULONG_POINTER_ADD(slot_ptr, queue_ptr -> tx_queue_message_size);
+
+            /* Determine if we are at the end.  */
+            if (destination == queue_ptr -> tx_queue_end)
+            {
+
+                /* Yes, wrap around to the beginning.  */
+                destination =  queue_ptr -> tx_queue_start;
+            }
+
+            /* Adjust the write pointer.  */
+            queue_ptr -> tx_queue_write =  destination;
+
+            /* Reduce the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage--;
+
+            /* Determine if the thread reserves the slot.  */
+            if (thread_ptr -> tx_thread_suspend_info == TX_QUEUE_RESERVE_SUSPEND)
+            {
+
+                /* Yes, give the slot to the thread, which holds it back until the
+                   reservation is committed.  */
+                message_ptr =   TX_VOID_TO_INDIRECT_VOID_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                *message_ptr =  (VOID *) slot_ptr;
+
+                /* Increase the reserved and pending counts.  */
+                queue_ptr -> tx_queue_reserved++;
+                queue_ptr -> tx_queue_pending++;
+            }
+            else
+            {
+
+                /* Setup source and destination pointers.  */
+                source =       TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                destination =  slot_ptr;
+                size =         queue_ptr -> tx_queue_message_size;
+
+                /* Copy message. Note that the source and destination pointers are
+                   incremented by the macro.  */
+                TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+                /* Determine if the message is behind reserved messages.  */
+                if (queue_ptr -> tx_queue_reserved != ((UINT) 0))
+                {
+
+                    /* Yes, the message is held back until the reservations are committed.  */
+                    queue_ptr -> tx_queue_pending++;
+                }
+                else
+                {
+
+                    /* Increase the enqueued count.  */
+                    queue_ptr -> tx_queue_enqueued++;
+                }
+            }
+        }
+
+        /* Determine if the thread has to keep waiting.  */
+        if (served == TX_FALSE)
+        {
+
+            /* Yes, so do the threads suspended after it.  */
+            break;
+        }
+
+        /* See if this is the only suspended thread on the list.  */
+        suspended_count--;
+        if (suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* Yes, the only suspended thread.  */
+
+            /* Update the head pointer.  */
+            queue_ptr -> tx_queue_suspension_list =  TX_NULL;
+        }
+        else
+        {
+
+            /* At least one more thread is on the same suspension list.  */
+
+            /* Update the list head pointer.  */
+            next_thread =                            thread_ptr -> tx_thread_suspended_next;
+            queue_ptr -> tx_queue_suspension_list =  next_thread;
+
+            /* Update the links of the adjacent threads.  */
+            previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+            next_thread -> tx_thread_suspended_previous =   previous_thread;
+            previous_thread -> tx_thread_suspended_next =   next_thread;
+        }
+
+        /* Decrement the suspension count.  */
+        queue_ptr -> tx_queue_suspended_count =  suspended_count;
+
+        /* Clear cleanup routine to avoid timeout.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Put return status into the thread control block.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+        /* Append the thread to the list of threads to resume, which keeps
+           the order in which the threads were suspended.  */
+        thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+        if (resume_list == TX_NULL)
+        {
+
+            /* First thread to resume.  */
+            resume_list =  thread_ptr;
+        }
+        else
+        {
+
+            /* Link the thread after the last one.  */
+            resume_last -> tx_thread_suspended_next =  thread_ptr;
+        }
+        resume_last =  thread_ptr;
+    }
+
+    /* Return the list of threads to resume.  */
+    return(resume_list);
+}
+#endif
+
@@ -29,6 +29,7 @@
 #include "tx_trace.h"
 #include "tx_thread.h"
 #include "tx_semaphore.h"
+#include "tx_wait_set.h"
 
 
 /**************************************************************************/
@@ -36,7 +37,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_semaphore_delete                                PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -60,6 +61,7 @@
 /*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_wait_set_member_remove        Remove member from wait set       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -72,6 +74,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added wait sets, resulting in */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_semaphore_delete(TX_SEMAPHORE *semaphore_ptr)
@@ -104,6 +108,17 @@ TX_SEMAPHORE    *previous_semaphore;
     /* Clear the semaphore ID to make it invalid.  */
     semaphore_ptr -> tx_semaphore_id =  TX_CLEAR_ID;
 
+#ifdef TX_ENABLE_WAIT_SET
+
+    /* Determine if the semaphore is a member of a wait set.  */
+    if (semaphore_ptr -> tx_semaphore_wait_set_member.tx_wait_set_member_set != TX_NULL)
+    {
+
+        /* Yes, remove the semaphore from the wait set.  */
+        _tx_wait_set_member_remove(&(semaphore_ptr -> tx_semaphore_wait_set_member));
+    }
+#endif
+
     /* Decrement the number of semaphores.  */
     _tx_semaphore_created_count--;
 
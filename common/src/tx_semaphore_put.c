@@ -29,6 +29,7 @@
 #include "tx_trace.h"
 #include "tx_thread.h"
 #include "tx_semaphore.h"
+#include "tx_wait_set.h"
 
 
 /**************************************************************************/
@@ -36,7 +37,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_semaphore_put                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -56,8 +57,11 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_semaphore_instances_put       Put semaphore instances and       */
+/*                                        resume threads                  */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_wait_set_signal               Signal wait set member            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -70,6 +74,12 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added wait sets, supported    */
+/*                                            threads waiting for more    */
+/*                                            than one instance, added    */
+/*                                            priority-ordered suspension */
+/*                                            lists, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_semaphore_put(TX_SEMAPHORE *semaphore_ptr)
@@ -124,6 +134,46 @@ TX_THREAD       *previous_thread;
         /* Restore interrupts.  */
         TX_RESTORE
 
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if notification is required.  */
+        if (semaphore_put_notify != TX_NULL)
+        {
+
+            /* Yes, call the appropriate notify callback function.  */
+            (semaphore_put_notify)(semaphore_ptr);
+        }
+#endif
+
+#ifdef TX_ENABLE_WAIT_SET
+
+        /* Determine if the semaphore is a member of a wait set.  */
+        if (semaphore_ptr -> tx_semaphore_wait_set_member.tx_wait_set_member_set != TX_NULL)
+        {
+
+            /* Yes, resume a thread waiting on the wait set if the semaphore is still ready.  */
+            _tx_wait_set_signal(&(semaphore_ptr -> tx_semaphore_wait_set_member));
+        }
+#endif
+    }
+    else if (semaphore_ptr -> tx_semaphore_suspension_list -> tx_thread_suspend_info != ((ULONG) 1))
+    {
+
+        /* The first suspended thread waits for more than one instance, see
+           tx_semaphore_get_count.  */
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Pickup the application notify function.  */
+        semaphore_put_notify =  semaphore_ptr -> tx_semaphore_put_notify;
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Put the instance back and resume the first suspended thread it satisfies.  */
+        _tx_semaphore_instances_put(semaphore_ptr, ((ULONG) 1));
+
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 
         /* Determine if notification is required.  */
@@ -143,6 +193,17 @@ TX_THREAD       *previous_thread;
         /* Pickup the pointer to the first suspended thread.  */
         thread_ptr =  semaphore_ptr -> tx_semaphore_suspension_list;
 
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+        /* Determine if the suspension list is kept in priority order.  */
+        if (semaphore_ptr -> tx_semaphore_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+        {
+
+            /* Update the priority order for the removal of the thread.  */
+            _tx_thread_priority_suspension_remove(semaphore_ptr -> tx_semaphore_suspension_list, &(semaphore_ptr -> tx_semaphore_priority_suspension), thread_ptr);
+        }
+#endif
+
         /* Remove the suspended thread from the list.  */
 
         /* See if this is the only suspended thread on the list.  */
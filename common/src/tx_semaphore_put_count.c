@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Semaphore                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_semaphore.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_semaphore_put_count                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function puts the specified number of instances back to the    */
+/*    semaphore in one operation. Suspended threads are resumed in        */
+/*    suspension order as long as their requested number of instances is  */
+/*    available, with a single check for preemption at the end.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    semaphore_ptr                     Pointer to semaphore control      */
+/*                                        block                           */
+/*    count                             Number of instances to put        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_semaphore_instances_put       Put semaphore instances and       */
+/*                                        resume threads                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_semaphore_put_count(TX_SEMAPHORE *semaphore_ptr, ULONG count)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*semaphore_put_notify)(struct TX_SEMAPHORE_STRUCT *notify_semaphore_ptr);
+#endif
+
+
+    /* Disable interrupts to record the put of the semaphore.  */
+    TX_DISABLE
+
+#ifdef TX_SEMAPHORE_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total semaphore put counter.  */
+    _tx_semaphore_performance_put_count++;
+
+    /* Increment the number of puts on this semaphore.  */
+    semaphore_ptr -> tx_semaphore_performance_put_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_SEMAPHORE_PUT_COUNT, semaphore_ptr, count, semaphore_ptr -> tx_semaphore_count, semaphore_ptr -> tx_semaphore_suspended_count, TX_TRACE_SEMAPHORE_EVENTS)
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+    /* Pickup the application notify function.  */
+    semaphore_put_notify =  semaphore_ptr -> tx_semaphore_put_notify;
+#endif
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Put the instances back to the semaphore and resume the satisfied threads.  */
+    _tx_semaphore_instances_put(semaphore_ptr, count);
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+    /* Determine if notification is required.  */
+    if (semaphore_put_notify != TX_NULL)
+    {
+
+        /* Yes, call the appropriate notify callback function.  */
+        (semaphore_put_notify)(semaphore_ptr);
+    }
+#endif
+
+    /* Return successful completion.  */
+    return(TX_SUCCESS);
+}
+
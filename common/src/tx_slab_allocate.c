@@ -0,0 +1,315 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#ifdef TX_ENABLE_EVENT_TRACE
+#include "tx_trace.h"
+#endif
+#include "tx_thread.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_slab_allocate                                   PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a block of at least the requested size      */
+/*    from the specified slab memory pool.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to place allocated block  */
+/*                                        pointer                         */
+/*    memory_size                       Number of bytes requested         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_slab_pool_class_allocate      Allocate a block of a size class  */
+/*    _tx_thread_system_suspend         Suspend thread                    */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_slab_allocate(TX_SLAB_POOL *pool_ptr, VOID **block_ptr, ULONG memory_size, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                        status;
+TX_THREAD                   *thread_ptr;
+UCHAR                       *work_ptr;
+UCHAR                       **return_ptr;
+UINT                        suspended_count;
+TX_THREAD                   *next_thread;
+TX_THREAD                   *previous_thread;
+#ifdef TX_ENABLE_EVENT_TRACE
+TX_TRACE_BUFFER_ENTRY       *entry_ptr;
+ULONG                       time_stamp =  ((ULONG) 0);
+#endif
+
+
+    /* Disable interrupts to get a block from the pool.  */
+    TX_DISABLE
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+    /* If trace is enabled, save the current event pointer.  */
+    entry_ptr =  _tx_trace_buffer_current_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_SLAB_ALLOCATE, pool_ptr, 0, memory_size, wait_option, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Save the time stamp for later comparison to verify that
+       the event hasn't been overwritten by the time the allocate
+       call succeeds.  */
+    if (entry_ptr != TX_NULL)
+    {
+
+        time_stamp =  entry_ptr -> tx_trace_buffer_entry_time_stamp;
+    }
+#endif
+
+    /* Default the return pointer to NULL.  */
+    return_ptr =   TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+    *return_ptr =  TX_NULL;
+
+    /* Determine if the request is larger than the largest size class.  A zero
+       size wraps around and is also rejected.  */
+    if ((memory_size - ((ULONG) 1)) >= pool_ptr -> tx_slab_pool_route_limit)
+    {
+
+        /* No size class fits the request, return error completion.  */
+        status =  TX_SIZE_ERROR;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* Allocate a block from the size class that fits the request.  */
+        work_ptr =  _tx_slab_pool_class_allocate(pool_ptr, memory_size);
+
+        /* Determine if a block is available.  */
+        if (work_ptr != TX_NULL)
+        {
+
+            /* Return the block to the caller.  */
+            *return_ptr =  work_ptr;
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+            /* Check that the event time stamp is unchanged.  A different
+               timestamp means that a later event wrote over the slab
+               allocate event.  In that case, do nothing here.  */
+            if (entry_ptr != TX_NULL)
+            {
+
+                /* Is the time stamp the same?  */
+                if (time_stamp == entry_ptr -> tx_trace_buffer_entry_time_stamp)
+                {
+
+                    /* Timestamp is the same, update the entry with the address.  */
+#ifdef TX_MISRA_ENABLE
+                    entry_ptr -> tx_trace_buffer_entry_info_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
+#else
+                    entry_ptr -> tx_trace_buffer_entry_information_field_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
+#endif
+                }
+            }
+#endif
+
+            /* Set status to success.  */
+            status =  TX_SUCCESS;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+
+        /* Determine if the request specifies suspension.  */
+        else if (wait_option != TX_NO_WAIT)
+        {
+
+            /* Determine if the preempt disable flag is non-zero.  */
+            if (_tx_thread_preempt_disable != ((UINT) 0))
+            {
+
+                /* Suspension is not allowed if the preempt disable flag is non-zero at this point, return error completion.  */
+                status =  TX_NO_MEMORY;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
+            else
+            {
+
+                /* Prepare for suspension of this thread.  */
+
+                /* Pickup thread pointer.  */
+                TX_THREAD_GET_CURRENT(thread_ptr)
+
+                /* Setup cleanup routine pointer.  */
+                thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_slab_pool_cleanup);
+
+                /* Setup cleanup information, i.e. this pool control
+                   block.  */
+                thread_ptr -> tx_thread_suspend_control_block =  (VOID *) pool_ptr;
+
+                /* Save the request size, which routes the request again when a
+                   block is released.  */
+                thread_ptr -> tx_thread_suspend_info =  memory_size;
+
+                /* Save the return block pointer address as well.  */
+                thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) block_ptr;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+                /* Increment the suspension sequence number, which is used to identify
+                   this suspension event.  */
+                thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+                /* Pickup the number of suspended threads.  */
+                suspended_count =  (pool_ptr -> tx_slab_pool_suspended_count);
+
+                /* Increment the number of suspended threads.  */
+                (pool_ptr -> tx_slab_pool_suspended_count)++;
+
+                /* Setup suspension list.  */
+                if (suspended_count == TX_NO_SUSPENSIONS)
+                {
+
+                    /* No other threads are suspended.  Setup the head pointer and
+                       just setup this threads pointers to itself.  */
+                    pool_ptr -> tx_slab_pool_suspension_list =      thread_ptr;
+                    thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                    thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+                }
+                else
+                {
+
+                    /* This list is not NULL, add current thread to the end. */
+                    next_thread =                                   pool_ptr -> tx_slab_pool_suspension_list;
+                    thread_ptr -> tx_thread_suspended_next =        next_thread;
+                    previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                    thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                    previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                    next_thread -> tx_thread_suspended_previous =   thread_ptr;
+                }
+
+                /* Set the state to suspended.  */
+                thread_ptr -> tx_thread_state =       TX_BLOCK_MEMORY;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Call actual non-interruptable thread suspension routine.  */
+                _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#else
+
+                /* Set the suspending flag.  */
+                thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+                /* Setup the timeout period.  */
+                thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+                /* Temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Call actual thread suspension routine.  */
+                _tx_thread_system_suspend(thread_ptr);
+#endif
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+                /* Check that the event time stamp is unchanged.  A different
+                   timestamp means that a later event wrote over the slab
+                   allocate event.  In that case, do nothing here.  */
+                if (entry_ptr != TX_NULL)
+                {
+
+                    /* Is the time-stamp the same?  */
+                    if (time_stamp == entry_ptr -> tx_trace_buffer_entry_time_stamp)
+                    {
+
+                        /* Timestamp is the same, update the entry with the address.  */
+#ifdef TX_MISRA_ENABLE
+                        entry_ptr -> tx_trace_buffer_entry_info_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
+#else
+                        entry_ptr -> tx_trace_buffer_entry_information_field_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
+#endif
+                    }
+                }
+#endif
+
+                /* Return the completion status.  */
+                status =  thread_ptr -> tx_thread_suspend_status;
+            }
+        }
+        else
+        {
+
+            /* Immediate return, return error completion.  */
+            status =  TX_NO_MEMORY;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,354 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_slab_release                                    PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a previously allocated block to the page and  */
+/*    size class it came from. A page that no longer has allocated        */
+/*    blocks is returned to the free pages of the pool if the pool was    */
+/*    created with TX_SLAB_POOL_BORROW_PAGES and its class has other      */
+/*    free blocks. Each thread suspended on the pool is then given a      */
+/*    block, in suspension order, if its request can be satisfied.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_ptr                         Pointer to memory block           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_slab_pool_class_allocate      Allocate a block of a size class  */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_slab_release(VOID *block_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_SLAB_POOL        *pool_ptr;
+TX_SLAB_POOL_CLASS  *class_ptr;
+TX_SLAB_POOL_PAGE   *page_ptr;
+TX_SLAB_POOL_PAGE   *next_page;
+TX_SLAB_POOL_PAGE   *previous_page;
+TX_THREAD           *thread_ptr;
+TX_THREAD           *resume_list;
+TX_THREAD           *resume_last;
+TX_THREAD           *next_thread;
+TX_THREAD           *previous_thread;
+UCHAR               *work_ptr;
+UCHAR               **next_block_ptr;
+UCHAR               **return_block_ptr;
+UINT                suspended_count;
+
+
+    /* Disable interrupts to put this block back in its page.  */
+    TX_DISABLE
+
+    /* Pickup the page pointer which is just previous to the starting
+       address of the block that the caller sees.  */
+    work_ptr =        TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+    work_ptr =        TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+    next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    page_ptr =        TX_UCHAR_TO_SLAB_POOL_PAGE_POINTER_CONVERT((*next_block_ptr));
+
+    /* Pickup the size class and the pool of the page.  */
+    class_ptr =  page_ptr -> tx_slab_pool_page_class;
+    pool_ptr =   class_ptr -> tx_slab_pool_class_pool;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_SLAB_RELEASE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(block_ptr), pool_ptr -> tx_slab_pool_suspended_count, pool_ptr -> tx_slab_pool_pages_available, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Put the block back in the free list of the page.  */
+    *next_block_ptr =                           page_ptr -> tx_slab_pool_page_free_list;
+    page_ptr -> tx_slab_pool_page_free_list =   work_ptr;
+
+    /* Determine if all of the blocks of the page were allocated.  */
+    if (page_ptr -> tx_slab_pool_page_used == class_ptr -> tx_slab_pool_class_page_blocks)
+    {
+
+        /* Yes, the page is not on the list of the class.  Place it at the end of the list.  */
+        next_page =  class_ptr -> tx_slab_pool_class_page_list;
+        if (next_page == TX_NULL)
+        {
+
+            /* The list is empty, setup the page as the only page.  */
+            page_ptr -> tx_slab_pool_page_next =            page_ptr;
+            page_ptr -> tx_slab_pool_page_previous =        page_ptr;
+            class_ptr -> tx_slab_pool_class_page_list =     page_ptr;
+        }
+        else
+        {
+
+            /* Add the page to the end of the list.  */
+            previous_page =                                 next_page -> tx_slab_pool_page_previous;
+            page_ptr -> tx_slab_pool_page_next =            next_page;
+            page_ptr -> tx_slab_pool_page_previous =        previous_page;
+            previous_page -> tx_slab_pool_page_next =       page_ptr;
+            next_page -> tx_slab_pool_page_previous =       page_ptr;
+        }
+    }
+
+    /* Update the block counts.  */
+    page_ptr -> tx_slab_pool_page_used--;
+    class_ptr -> tx_slab_pool_class_available++;
+
+    /* Determine if the page should go back to the free pages of the pool.  The class keeps
+       its last free page, so that a block released and allocated again does not move pages.  */
+    if ((pool_ptr -> tx_slab_pool_options & TX_SLAB_POOL_BORROW_PAGES) != ((UINT) 0))
+    {
+
+        /* Is the page unused and does the class have free blocks on other pages?  */
+        if ((page_ptr -> tx_slab_pool_page_used == ((UINT) 0)) &&
+            (class_ptr -> tx_slab_pool_class_available > class_ptr -> tx_slab_pool_class_page_blocks))
+        {
+
+            /* Yes, remove the page from the list of the class.  */
+            next_page =      page_ptr -> tx_slab_pool_page_next;
+            previous_page =  page_ptr -> tx_slab_pool_page_previous;
+            next_page -> tx_slab_pool_page_previous =  previous_page;
+            previous_page -> tx_slab_pool_page_next =  next_page;
+
+            /* See if we have to update the list head pointer.  */
+            if (class_ptr -> tx_slab_pool_class_page_list == page_ptr)
+            {
+
+                /* Yes, move the head pointer to the next page.  */
+                class_ptr -> tx_slab_pool_class_page_list =  next_page;
+            }
+
+            /* Update the page and block counts of the class.  */
+            class_ptr -> tx_slab_pool_class_pages--;
+            class_ptr -> tx_slab_pool_class_available =  class_ptr -> tx_slab_pool_class_available - class_ptr -> tx_slab_pool_class_page_blocks;
+
+            /* Place the page on the free page list of the pool.  */
+            page_ptr -> tx_slab_pool_page_class =   TX_NULL;
+            page_ptr -> tx_slab_pool_page_next =    pool_ptr -> tx_slab_pool_page_list;
+            pool_ptr -> tx_slab_pool_page_list =    page_ptr;
+            pool_ptr -> tx_slab_pool_pages_available++;
+        }
+    }
+
+    /* Start with no threads to resume.  */
+    resume_list =  TX_NULL;
+    resume_last =  TX_NULL;
+
+    /* Give blocks to the suspended threads in suspension order.  Each suspended thread
+       is examined once, since a thread waiting for a block of another size class must
+       not hold up the threads after it.  */
+    suspended_count =  pool_ptr -> tx_slab_pool_suspended_count;
+    thread_ptr =       pool_ptr -> tx_slab_pool_suspension_list;
+    while (suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Decrement the number of threads to examine.  */
+        suspended_count--;
+
+        /* Pickup the next suspended thread first.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+        /* Allocate a block for the request of the suspended thread.  */
+        work_ptr =  _tx_slab_pool_class_allocate(pool_ptr, thread_ptr -> tx_thread_suspend_info);
+
+        /* Determine if the request is satisfied.  */
+        if (work_ptr != TX_NULL)
+        {
+
+            /* Remove the suspended thread from the list.  */
+
+            /* Decrement the number of threads suspended.  */
+            (pool_ptr -> tx_slab_pool_suspended_count)--;
+
+            /* See if this is the only suspended thread on the list.  */
+            if (pool_ptr -> tx_slab_pool_suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                pool_ptr -> tx_slab_pool_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+
+                /* Determine if we need to update the head pointer.  */
+                if (pool_ptr -> tx_slab_pool_suspension_list == thread_ptr)
+                {
+
+                    /* Update the list head pointer.  */
+                    pool_ptr -> tx_slab_pool_suspension_list =  next_thread;
+                }
+            }
+
+            /* Prepare for resumption of the thread.  */
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Return the block pointer to the suspended thread.  */
+            return_block_ptr =   TX_VOID_TO_INDIRECT_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            *return_block_ptr =  work_ptr;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Append the thread to the list of threads to resume, which keeps
+               the order in which the threads were suspended.  */
+            thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+            if (resume_list == TX_NULL)
+            {
+
+                /* First thread to resume.  */
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the thread after the last one.  */
+                resume_last -> tx_thread_suspended_next =  thread_ptr;
+            }
+            resume_last =  thread_ptr;
+        }
+
+        /* Move to the next suspended thread.  */
+        thread_ptr =  next_thread;
+    }
+
+    /* Determine if any threads received a block.  */
+    if (resume_list != TX_NULL)
+    {
+
+        /* Disable preemption until all of the threads are resumed.  */
+        _tx_thread_preempt_disable++;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Walk through the list of threads to resume.  */
+        thread_ptr =  resume_list;
+        while (thread_ptr != TX_NULL)
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Move next thread to current.  */
+            thread_ptr =  next_thread;
+        }
+#else
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Walk through the list of threads to resume.  */
+        thread_ptr =  resume_list;
+        while (thread_ptr != TX_NULL)
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupt posture.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr);
+
+            /* Move next thread to current.  */
+            thread_ptr =  next_thread;
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+#endif
+
+        /* Release thread preemption disable.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return successful completion status.  */
+    return(TX_SUCCESS);
+}
+
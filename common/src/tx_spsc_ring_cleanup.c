@@ -0,0 +1,186 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_spsc_ring_cleanup                               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes ring timeout and thread terminate actions   */
+/*    that require the ring's producer or consumer to be cleaned up.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to suspended thread's     */
+/*                                        control block                   */
+/*    suspension_sequence               Suspension sequence number        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_spsc_ring_store               Default ring index store          */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_timeout                Thread timeout processing         */
+/*    _tx_thread_terminate              Thread terminate processing       */
+/*    _tx_thread_wait_abort             Thread wait abort processing      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_spsc_ring_cleanup(TX_THREAD  *thread_ptr, ULONG suspension_sequence)
+{
+
+#ifndef TX_NOT_INTERRUPTABLE
+TX_INTERRUPT_SAVE_AREA
+#endif
+
+TX_SPSC_RING        *ring_ptr;
+
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+    /* Disable interrupts to remove the suspended thread from the ring.  */
+    TX_DISABLE
+
+    /* Determine if the cleanup is still required.  */
+    if (thread_ptr -> tx_thread_suspend_cleanup == &(_tx_spsc_ring_cleanup))
+    {
+
+        /* Check for valid suspension sequence.  */
+        if (suspension_sequence == thread_ptr -> tx_thread_suspension_sequence)
+        {
+
+            /* Setup pointer to ring control block.  */
+            ring_ptr =  TX_VOID_TO_SPSC_RING_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+
+            /* Check for NULL ring pointer.  */
+            if (ring_ptr != TX_NULL)
+            {
+
+                /* Is the ring ID valid?  */
+                if (ring_ptr -> tx_spsc_ring_id == TX_SPSC_RING_ID)
+                {
+#else
+
+                    /* Setup pointer to ring control block.  */
+                    ring_ptr =  TX_VOID_TO_SPSC_RING_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+#endif
+
+                    /* Yes, we still have thread suspension!  */
+
+                    /* Clear the suspension cleanup flag.  */
+                    thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                    /* Remove the suspended thread from the ring.  */
+                    if (thread_ptr -> tx_thread_suspend_info == ((ULONG) TX_TRUE))
+                    {
+
+                        /* Remove the producer.  */
+                        ring_ptr -> tx_spsc_ring_producer_thread =  TX_NULL;
+                        TX_SPSC_RING_STORE(&(ring_ptr -> tx_spsc_ring_producer_waiting), ((ULONG) 0));
+                    }
+                    else
+                    {
+
+                        /* Remove the consumer.  */
+                        ring_ptr -> tx_spsc_ring_consumer_thread =  TX_NULL;
+                        TX_SPSC_RING_STORE(&(ring_ptr -> tx_spsc_ring_consumer_waiting), ((ULONG) 0));
+                    }
+
+                    /* Now we need to determine if this cleanup is from a terminate, timeout,
+                       or from a wait abort.  */
+                    if (thread_ptr -> tx_thread_state == TX_QUEUE_SUSP)
+                    {
+
+                        /* Timeout condition and the thread still suspended on the ring.
+                           Setup return error status and resume the thread.  */
+                        if (thread_ptr -> tx_thread_suspend_info == ((ULONG) TX_TRUE))
+                        {
+
+                            /* Ring full timeout!  */
+                            thread_ptr -> tx_thread_suspend_status =  TX_QUEUE_FULL;
+                        }
+                        else
+                        {
+
+                            /* Ring empty timeout!  */
+                            thread_ptr -> tx_thread_suspend_status =  TX_QUEUE_EMPTY;
+                        }
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                        /* Resume the thread!  */
+                        _tx_thread_system_ni_resume(thread_ptr);
+#else
+
+                        /* Temporarily disable preemption.  */
+                        _tx_thread_preempt_disable++;
+
+                        /* Restore interrupts.  */
+                        TX_RESTORE
+
+                        /* Resume the thread!  */
+                        _tx_thread_system_resume(thread_ptr);
+
+                        /* Disable interrupts.  */
+                        TX_DISABLE
+#endif
+                    }
+#ifndef TX_NOT_INTERRUPTABLE
+                }
+            }
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+}
+
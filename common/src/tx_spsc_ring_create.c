@@ -0,0 +1,156 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_spsc_ring_create                                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a single-producer single-consumer ring of     */
+/*    fixed size messages in the specified area. The number of messages   */
+/*    the ring holds is rounded down to a power of two.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ring_ptr                          Pointer to ring control block     */
+/*    name_ptr                          Pointer to ring name              */
+/*    message_size                      Size of each message in ULONG     */
+/*                                        words                           */
+/*    ring_start                        Starting address of the ring area */
+/*    ring_size                         Number of bytes in the ring area  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_spsc_ring_create(TX_SPSC_RING *ring_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *ring_start, ULONG ring_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG           capacity;
+TX_SPSC_RING    *next_ring;
+TX_SPSC_RING    *previous_ring;
+
+
+    /* Initialize ring control block to all zeros.  */
+    TX_MEMSET(ring_ptr, 0, (sizeof(TX_SPSC_RING)));
+
+    /* Calculate the number of messages that fit in the ring area.  */
+    capacity =  (ring_size/(sizeof(ULONG)))/((ULONG) message_size);
+
+    /* Round the number of messages down to a power of two, so that an index
+       is turned into a message slot with a mask.  */
+    while ((capacity & (capacity - ((ULONG) 1))) != ((ULONG) 0))
+    {
+
+        /* Clear the lowest bit that is set.  */
+        capacity =  capacity & (capacity - ((ULONG) 1));
+    }
+
+    /* Setup the basic ring fields.  */
+    ring_ptr -> tx_spsc_ring_name =             name_ptr;
+    ring_ptr -> tx_spsc_ring_message_size =     message_size;
+    ring_ptr -> tx_spsc_ring_capacity =         capacity;
+    ring_ptr -> tx_spsc_ring_start =            TX_VOID_TO_ULONG_POINTER_CONVERT(ring_start);
+
+    /* Disable interrupts to put the ring on the created list.  */
+    TX_DISABLE
+
+    /* Setup the ring ID to make it valid.  */
+    ring_ptr -> tx_spsc_ring_id =  TX_SPSC_RING_ID;
+
+    /* Place the ring on the list of created rings.  First,
+       check for an empty list.  */
+    if (_tx_spsc_ring_created_count == TX_EMPTY)
+    {
+
+        /* The created ring list is empty.  Add ring to empty list.  */
+        _tx_spsc_ring_created_ptr =                     ring_ptr;
+        ring_ptr -> tx_spsc_ring_created_next =         ring_ptr;
+        ring_ptr -> tx_spsc_ring_created_previous =     ring_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_ring =      _tx_spsc_ring_created_ptr;
+        previous_ring =  next_ring -> tx_spsc_ring_created_previous;
+
+        /* Place the new ring in the list.  */
+        next_ring -> tx_spsc_ring_created_previous =  ring_ptr;
+        previous_ring -> tx_spsc_ring_created_next =  ring_ptr;
+
+        /* Setup this ring's created links.  */
+        ring_ptr -> tx_spsc_ring_created_previous =  previous_ring;
+        ring_ptr -> tx_spsc_ring_created_next =      next_ring;
+    }
+
+    /* Increment the created ring count.  */
+    _tx_spsc_ring_created_count++;
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_SPSC_RING, ring_ptr, name_ptr, capacity, message_size)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_SPSC_RING_CREATE, ring_ptr, message_size, TX_POINTER_TO_ULONG_CONVERT(ring_start), capacity, TX_TRACE_QUEUE_EVENTS)
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
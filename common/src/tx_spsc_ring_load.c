@@ -0,0 +1,87 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_spsc_ring_load                                  PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads a ring index or waiting flag. It is the         */
+/*    default for TX_SPSC_RING_LOAD when the port does not define an      */
+/*    atomic load. Being an external function, the compiler does not      */
+/*    move memory accesses across the call.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    source_ptr                        Pointer to the index or flag      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    value                             Value of the index or flag        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_spsc_ring_receive             Receive message from ring         */
+/*    _tx_spsc_ring_resume              Resume ring producer or consumer  */
+/*    _tx_spsc_ring_send                Send message to ring              */
+/*    _tx_spsc_ring_suspend             Suspend ring producer or consumer */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_spsc_ring_load(ULONG *source_ptr)
+{
+
+volatile ULONG  *volatile_ptr;
+
+
+    /* Read the value through a volatile pointer.  */
+    volatile_ptr =  source_ptr;
+
+    /* Return the value.  */
+    return(*volatile_ptr);
+}
+
@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_spsc_ring_receive                               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives a message from the specified ring. Only one  */
+/*    thread or ISR may receive from a ring. When the ring has a          */
+/*    message, it is removed with plain loads and stores and the          */
+/*    producer index is not even read if the cached copy shows a          */
+/*    message. Only when the ring is empty does the consumer suspend, if  */
+/*    a wait option is specified.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ring_ptr                          Pointer to ring control block     */
+/*    destination_ptr                   Pointer to message destination    */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_QUEUE_EMPTY                    Ring is empty                     */
+/*    TX_DELETED                        Ring was deleted while the        */
+/*                                        consumer was suspended          */
+/*    TX_WAIT_ABORTED                   Suspension was aborted            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_spsc_ring_load                Default ring index load           */
+/*    _tx_spsc_ring_resume              Resume the suspended producer     */
+/*    _tx_spsc_ring_store               Default ring index store          */
+/*    _tx_spsc_ring_suspend             Suspend the consumer              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_spsc_ring_receive(TX_SPSC_RING *ring_ptr, VOID *destination_ptr, ULONG wait_option)
+{
+
+ULONG           head;
+ULONG           tail;
+UINT            size;
+ULONG           *source;
+ULONG           *destination;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Pickup the consumer index, which only the consumer changes, and the
+       consumer's copy of the producer index.  */
+    tail =  ring_ptr -> tx_spsc_ring_tail;
+    head =  ring_ptr -> tx_spsc_ring_head_cache;
+
+    /* Determine if the ring appears to be empty.  */
+    if (head == tail)
+    {
+
+        /* Refresh the copy of the producer index.  */
+        head =  TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_head));
+        ring_ptr -> tx_spsc_ring_head_cache =  head;
+
+        /* Determine if the ring is really empty.  */
+        if (head == tail)
+        {
+
+            /* Determine if the request specifies suspension.  */
+            if (wait_option != TX_NO_WAIT)
+            {
+
+                /* Suspend until the producer sends a message.  */
+                status =  _tx_spsc_ring_suspend(ring_ptr, TX_FALSE, tail, wait_option);
+
+                /* Refresh the copy of the producer index, which would otherwise fall
+                   behind the consumer index once this message is removed.  */
+                ring_ptr -> tx_spsc_ring_head_cache =  TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_head));
+            }
+            else
+            {
+
+                /* Immediate return, the ring is empty.  */
+                status =  TX_QUEUE_EMPTY;
+            }
+        }
+    }
+
+    /* Determine if there is a message.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Setup the source and the destination pointers.  */
+        size =         ring_ptr -> tx_spsc_ring_message_size;
+        source =       TX_ULONG_POINTER_ADD(ring_ptr -> tx_spsc_ring_start, (tail & (ring_ptr -> tx_spsc_ring_capacity - ((ULONG) 1))) * ((ULONG) size));
+        destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
+
+        /* Copy the message out of the ring.  */
+        TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+        /* Release the message slot to the producer.  */
+        TX_SPSC_RING_STORE(&(ring_ptr -> tx_spsc_ring_tail), (tail + ((ULONG) 1)));
+
+        /* Determine if the producer is suspending on the full ring.  */
+        if (TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_producer_waiting)) != ((ULONG) 0))
+        {
+
+            /* Resume the producer.  */
+            _tx_spsc_ring_resume(ring_ptr, TX_TRUE);
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
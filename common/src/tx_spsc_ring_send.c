@@ -0,0 +1,163 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_spsc_ring_send                                  PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends a message to the specified ring. Only one       */
+/*    thread or ISR may send to a ring. When the ring has room, the       */
+/*    message is placed with plain loads and stores and the consumer      */
+/*    index is not even read if the cached copy shows room. Only when     */
+/*    the ring is full does the producer suspend, if a wait option is     */
+/*    specified.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ring_ptr                          Pointer to ring control block     */
+/*    source_ptr                        Pointer to message source         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_QUEUE_FULL                     Ring is full                      */
+/*    TX_DELETED                        Ring was deleted while the        */
+/*                                        producer was suspended          */
+/*    TX_WAIT_ABORTED                   Suspension was aborted            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_spsc_ring_load                Default ring index load           */
+/*    _tx_spsc_ring_resume              Resume the suspended consumer     */
+/*    _tx_spsc_ring_store               Default ring index store          */
+/*    _tx_spsc_ring_suspend             Suspend the producer              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_spsc_ring_send(TX_SPSC_RING *ring_ptr, VOID *source_ptr, ULONG wait_option)
+{
+
+ULONG           head;
+ULONG           tail;
+ULONG           capacity;
+UINT            size;
+ULONG           *source;
+ULONG           *destination;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Pickup the producer index, which only the producer changes, and the
+       producer's copy of the consumer index.  */
+    head =      ring_ptr -> tx_spsc_ring_head;
+    tail =      ring_ptr -> tx_spsc_ring_tail_cache;
+    capacity =  ring_ptr -> tx_spsc_ring_capacity;
+
+    /* Determine if the ring appears to be full.  */
+    if ((head - tail) >= capacity)
+    {
+
+        /* Refresh the copy of the consumer index.  */
+        tail =  TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_tail));
+        ring_ptr -> tx_spsc_ring_tail_cache =  tail;
+
+        /* Determine if the ring is really full.  */
+        if ((head - tail) >= capacity)
+        {
+
+            /* Determine if the request specifies suspension.  */
+            if (wait_option != TX_NO_WAIT)
+            {
+
+                /* Suspend until the consumer makes room.  */
+                status =  _tx_spsc_ring_suspend(ring_ptr, TX_TRUE, head, wait_option);
+
+                /* Refresh the copy of the consumer index, which the consumer moved.  */
+                ring_ptr -> tx_spsc_ring_tail_cache =  TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_tail));
+            }
+            else
+            {
+
+                /* Immediate return, the ring is full.  */
+                status =  TX_QUEUE_FULL;
+            }
+        }
+    }
+
+    /* Determine if there is room for the message.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Setup the source and the destination pointers.  */
+        source =       TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
+        size =         ring_ptr -> tx_spsc_ring_message_size;
+        destination =  TX_ULONG_POINTER_ADD(ring_ptr -> tx_spsc_ring_start, (head & (capacity - ((ULONG) 1))) * ((ULONG) size));
+
+        /* Copy the message into the ring.  */
+        TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+        /* Publish the message to the consumer.  */
+        TX_SPSC_RING_STORE(&(ring_ptr -> tx_spsc_ring_head), (head + ((ULONG) 1)));
+
+        /* Determine if the consumer is suspending on the empty ring.  */
+        if (TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_consumer_waiting)) != ((ULONG) 0))
+        {
+
+            /* Resume the consumer.  */
+            _tx_spsc_ring_resume(ring_ptr, TX_FALSE);
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,246 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_delete                                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified wait set. All of its members    */
+/*    are removed from the wait set and all threads waiting on the wait   */
+/*    set are resumed with the TX_DELETED status code.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set control block */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_FEATURE_NOT_ENABLED            Wait sets are not enabled         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_wait_set_delete(TX_WAIT_SET *wait_set_ptr)
+{
+
+#ifdef TX_ENABLE_WAIT_SET
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD           *thread_ptr;
+TX_THREAD           *next_thread;
+UINT                suspended_count;
+TX_WAIT_SET_MEMBER  *member_ptr;
+TX_WAIT_SET_MEMBER  *next_member;
+TX_WAIT_SET         *next_wait_set;
+TX_WAIT_SET         *previous_wait_set;
+
+
+    /* Disable interrupts to remove the wait set from the created list.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_WAIT_SET_DELETE, wait_set_ptr, TX_POINTER_TO_ULONG_CONVERT(&thread_ptr), 0, 0, TX_TRACE_EVENT_FLAGS_EVENTS)
+
+    /* If trace is enabled, unregister this object.  */
+    TX_TRACE_OBJECT_UNREGISTER(wait_set_ptr)
+
+    /* Clear the wait set ID to make it invalid.  */
+    wait_set_ptr -> tx_wait_set_id =  TX_CLEAR_ID;
+
+    /* Decrement the number of created wait sets.  */
+    _tx_wait_set_created_count--;
+
+    /* See if the wait set is the only one on the list.  */
+    if (_tx_wait_set_created_count == TX_EMPTY)
+    {
+
+        /* Only created wait set, just set the created list to NULL.  */
+        _tx_wait_set_created_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        next_wait_set =                                  wait_set_ptr -> tx_wait_set_created_next;
+        previous_wait_set =                              wait_set_ptr -> tx_wait_set_created_previous;
+        next_wait_set -> tx_wait_set_created_previous =  previous_wait_set;
+        previous_wait_set -> tx_wait_set_created_next =  next_wait_set;
+
+        /* See if we have to update the created list head pointer.  */
+        if (_tx_wait_set_created_ptr == wait_set_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            _tx_wait_set_created_ptr =  next_wait_set;
+        }
+    }
+
+    /* Remove all of the members from the wait set.  */
+    member_ptr =  wait_set_ptr -> tx_wait_set_member_list;
+    while (member_ptr != TX_NULL)
+    {
+
+        /* Pickup the next member.  */
+        next_member =  member_ptr -> tx_wait_set_member_next;
+
+        /* The object is no longer a member of a wait set.  */
+        member_ptr -> tx_wait_set_member_set =   TX_NULL;
+        member_ptr -> tx_wait_set_member_next =  TX_NULL;
+
+        /* Move to the next member.  */
+        member_ptr =  next_member;
+    }
+    wait_set_ptr -> tx_wait_set_member_list =   TX_NULL;
+    wait_set_ptr -> tx_wait_set_member_count =  ((UINT) 0);
+
+    /* Temporarily disable preemption.  */
+    _tx_thread_preempt_disable++;
+
+    /* Pickup the suspension information.  */
+    thread_ptr =                                   wait_set_ptr -> tx_wait_set_suspension_list;
+    wait_set_ptr -> tx_wait_set_suspension_list =  TX_NULL;
+    suspended_count =                              wait_set_ptr -> tx_wait_set_suspended_count;
+    wait_set_ptr -> tx_wait_set_suspended_count =  TX_NO_SUSPENSIONS;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Walk through the wait set list to resume any and all threads suspended
+       on this wait set.  */
+    while (suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Decrement the suspension count.  */
+        suspended_count--;
+
+        /* Lockout interrupts.  */
+        TX_DISABLE
+
+        /* Clear the cleanup pointer, this prevents the timeout from doing
+           anything.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Set the return status in the thread to TX_DELETED.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_DELETED;
+
+        /* Move the thread pointer ahead.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption again.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+
+        /* Move to next thread.  */
+        thread_ptr =  next_thread;
+    }
+
+    /* Execute Port-Specific completion processing. If needed, it is typically defined in tx_port.h.  */
+    TX_WAIT_SET_DELETE_PORT_COMPLETION(wait_set_ptr)
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Release previous preempt disable.  */
+    _tx_thread_preempt_disable--;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Check for preemption.  */
+    _tx_thread_system_preempt_check();
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (wait_set_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
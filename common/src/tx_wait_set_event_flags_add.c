@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_event_flags.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_event_flags_add                        PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a event flags group to a wait set. An event      */
+/*    flags group is ready when one or more of its event flags are set.   */
+/*    An object can only be a member of one wait set.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set control block */
+/*    group_ptr                         Pointer to event flags group      */
+/*                                        control block                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_NOT_AVAILABLE                  Event flags group is already a    */
+/*                                        member of a wait set            */
+/*    TX_FEATURE_NOT_ENABLED            Wait sets are not enabled         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_wait_set_member_add           Add object to wait set            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_wait_set_event_flags_add(TX_WAIT_SET *wait_set_ptr, TX_EVENT_FLAGS_GROUP *group_ptr)
+{
+
+#ifdef TX_ENABLE_WAIT_SET
+
+UINT            status;
+
+
+    /* Add the event flags group to the wait set.  */
+    status =  _tx_wait_set_member_add(wait_set_ptr, &(group_ptr -> tx_event_flags_group_wait_set_member), (VOID *) group_ptr, TX_EVENT_FLAGS_ID);
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (wait_set_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (group_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_remove                                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a queue, semaphore, or event flags group      */
+/*    from a wait set. Threads that were resumed with the object as       */
+/*    their ready object are not affected.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set control block */
+/*    object_ptr                        Pointer to queue, semaphore, or   */
+/*                                        event flags group               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_NOT_AVAILABLE                  Object is not a member of the     */
+/*                                        wait set                        */
+/*    TX_FEATURE_NOT_ENABLED            Wait sets are not enabled         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_wait_set_member_remove        Remove member from wait set       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_wait_set_remove(TX_WAIT_SET *wait_set_ptr, VOID *object_ptr)
+{
+
+#ifdef TX_ENABLE_WAIT_SET
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_WAIT_SET_MEMBER  *member_ptr;
+UINT                status;
+
+
+    /* Default the status to not a member.  */
+    status =  TX_NOT_AVAILABLE;
+
+    /* Disable interrupts to remove the object from the wait set.  */
+    TX_DISABLE
+
+    /* Find the member of the object.  */
+    member_ptr =  wait_set_ptr -> tx_wait_set_member_list;
+    while (member_ptr != TX_NULL)
+    {
+
+        /* Determine if this is the member of the object.  */
+        if (member_ptr -> tx_wait_set_member_object == object_ptr)
+        {
+
+            /* Yes, remove the member from the wait set.  */
+            _tx_wait_set_member_remove(member_ptr);
+
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            TX_TRACE_IN_LINE_INSERT(TX_TRACE_WAIT_SET_REMOVE, wait_set_ptr, TX_POINTER_TO_ULONG_CONVERT(object_ptr), wait_set_ptr -> tx_wait_set_member_count, 0, TX_TRACE_EVENT_FLAGS_EVENTS)
+
+            /* Set the status to success.  */
+            status =  TX_SUCCESS;
+
+            /* End the search.  */
+            member_ptr =  TX_NULL;
+        }
+        else
+        {
+
+            /* Move to the next member.  */
+            member_ptr =  member_ptr -> tx_wait_set_member_next;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (wait_set_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (object_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
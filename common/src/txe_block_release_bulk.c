@@ -0,0 +1,163 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_block_release_bulk                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the bulk block release function  */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_ptrs                        Array of pointers to the blocks   */
+/*    count                             Number of blocks to release       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_PTR_ERROR                      Invalid block or array pointer    */
+/*    TX_SIZE_ERROR                     Invalid number of blocks          */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_release_bulk            Actual bulk block release         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_block_release_bulk(VOID **block_ptrs, UINT count)
+{
+
+UINT                status;
+UINT                index;
+TX_BLOCK_POOL       *pool_ptr;
+UCHAR               **indirect_ptr;
+UCHAR               *work_ptr;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* First check the supplied array pointer.  */
+    if (block_ptrs == TX_NULL)
+    {
+
+        /* The array pointer is invalid, return appropriate status.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Check for an invalid number of blocks.  */
+    else if (count == ((UINT) 0))
+    {
+
+        /* No blocks to release, return appropriate error.  */
+        status =  TX_SIZE_ERROR;
+    }
+    else
+    {
+
+        /* Check each of the blocks.  */
+        index =  ((UINT) 0);
+        while ((index < count) && (status == TX_SUCCESS))
+        {
+
+            /* Check the block pointer.  */
+            if (block_ptrs[index] == TX_NULL)
+            {
+
+                /* The block pointer is invalid, return appropriate status.  */
+                status =  TX_PTR_ERROR;
+            }
+            else
+            {
+
+                /* Pickup the pool pointer which is just previous to the starting
+                   address of block that the caller sees.  */
+                work_ptr =      TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptrs[index]);
+                work_ptr =      TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+                indirect_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                work_ptr =      *indirect_ptr;
+                pool_ptr =      TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT(work_ptr);
+
+                /* Check for an invalid pool pointer.  */
+                if (pool_ptr == TX_NULL)
+                {
+
+                    /* Pool pointer is invalid, return appropriate error code.  */
+                    status =  TX_PTR_ERROR;
+                }
+
+                /* Now check for invalid pool ID.  */
+                else if  (pool_ptr -> tx_block_pool_id != TX_BLOCK_POOL_ID)
+                {
+
+                    /* Pool pointer is invalid, return appropriate error code.  */
+                    status =  TX_PTR_ERROR;
+                }
+                else
+                {
+
+                    /* Move to the next block.  */
+                    index++;
+                }
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual bulk block release function.  */
+        status =  _tx_block_release_bulk(block_ptrs, count);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_message_buffer_info_get                        PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the message buffer information   */
+/*    get service.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    name                              Destination for the message       */
+/*                                        buffer name                     */
+/*    enqueued                          Destination for enqueued count    */
+/*    available_bytes                   Destination for number of bytes   */
+/*                                        not used by messages            */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on this        */
+/*                                        message buffer                  */
+/*    suspended_count                   Destination for suspended count   */
+/*    next_message_buffer               Destination for pointer to the    */
+/*                                        next message buffer on the      */
+/*                                        created list                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_QUEUE_ERROR                    Invalid message buffer pointer    */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_message_buffer_info_get       Actual message buffer info get    */
+/*                                        function                        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_message_buffer_info_get(TX_MESSAGE_BUFFER *message_buffer_ptr, CHAR **name, ULONG *enqueued,
+                    ULONG *available_bytes, TX_THREAD **first_suspended, ULONG *suspended_count,
+                    TX_MESSAGE_BUFFER **next_message_buffer)
+{
+
+UINT    status;
+
+
+    /* Check for an invalid message buffer pointer.  */
+    if (message_buffer_ptr == TX_NULL)
+    {
+
+        /* Message buffer pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+
+    /* Now check for a valid message buffer ID.  */
+    else if (message_buffer_ptr -> tx_message_buffer_id != TX_MESSAGE_BUFFER_ID)
+    {
+
+        /* Message buffer pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+    else
+    {
+
+        /* Otherwise, call the actual message buffer information get service.  */
+        status =  _tx_message_buffer_info_get(message_buffer_ptr, name, enqueued, available_bytes, first_suspended,
+                                                            suspended_count, next_message_buffer);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,274 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_queue_priority_create                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the priority queue create        */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    name_ptr                          Pointer to queue name             */
+/*    message_size                      Size of each queue message        */
+/*    queue_start                       Starting address of the queue     */
+/*                                        area                            */
+/*    queue_size                        Number of bytes in the queue      */
+/*    priorities                        Number of message priorities      */
+/*    queue_control_block_size          Size of queue control block       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_QUEUE_ERROR                    Invalid queue pointer             */
+/*    TX_PTR_ERROR                      Invalid starting address of queue */
+/*    TX_SIZE_ERROR                     Invalid message queue size        */
+/*    TX_PRIORITY_ERROR                 Invalid number of priorities      */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_priority_create         Actual priority queue create      */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_queue_priority_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *queue_start, ULONG queue_size, UINT priorities, UINT queue_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+ULONG           i;
+ULONG           message_words;
+TX_QUEUE        *next_queue;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD       *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid queue pointer.  */
+    if (queue_ptr == TX_NULL)
+    {
+
+        /* Queue pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+
+    /* Now check for a valid control block size.  */
+    else if (queue_control_block_size != (sizeof(TX_QUEUE)))
+    {
+
+        /* Queue pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_queue =   _tx_queue_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_queue_created_count; i++)
+        {
+
+            /* Determine if this queue matches the queue in the list.  */
+            if (queue_ptr == next_queue)
+            {
+
+                break;
+            }
+            else
+            {
+
+                /* Move to the next queue.  */
+                next_queue =  next_queue -> tx_queue_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+
+        /* Calculate the number of ULONGs of each message.  */
+        if (message_size > TX_QUEUE_MESSAGE_BYTES_BASE)
+        {
+
+            /* Round the number of bytes up to the number of ULONGs.  */
+            message_words =  ((((ULONG) message_size) - ((ULONG) TX_QUEUE_MESSAGE_BYTES_BASE)) + (sizeof(ULONG)) - ((ULONG) 1))/(sizeof(ULONG));
+        }
+        else
+        {
+
+            /* The message size is given in ULONGs.  */
+            message_words =  (ULONG) message_size;
+        }
+
+        /* At this point, check to see if there is a duplicate queue.  */
+        if (queue_ptr == next_queue)
+        {
+
+            /* Queue is already created, return appropriate error code.  */
+            status =  TX_QUEUE_ERROR;
+        }
+
+        /* Check the starting address of the queue.  */
+        else if (queue_start == TX_NULL)
+        {
+
+            /* Invalid starting address of queue.  */
+            status =  TX_PTR_ERROR;
+        }
+
+        /* Check for an invalid message size - less than 1.  */
+        else if (message_size < TX_1_ULONG)
+        {
+
+            /* Invalid message size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check for an invalid message size - greater than 16 and not given in bytes.  */
+        else if ((message_size > TX_16_ULONG) && (message_size <= TX_QUEUE_MESSAGE_BYTES_BASE))
+        {
+
+            /* Invalid message size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check for an invalid message size in bytes - greater than the maximum.  */
+        else if (message_size > TX_QUEUE_MESSAGE_BYTES(TX_QUEUE_MAXIMUM_MESSAGE_BYTES))
+        {
+
+            /* Invalid message size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check for an invalid number of priorities.  */
+        else if ((priorities == ((UINT) 0)) || (priorities > TX_QUEUE_MAXIMUM_PRIORITIES))
+        {
+
+            /* Invalid number of priorities specified.  */
+            status =  TX_PRIORITY_ERROR;
+        }
+
+        /* Check on the queue size, which must hold the message lists and one message slot.  */
+        else if ((queue_size/(sizeof(ULONG))) < ((((ULONG) priorities) * ((ULONG) 2)) + message_words + ((ULONG) 1)))
+        {
+
+            /* Invalid queue size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+        else
+        {
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Check for invalid caller of this function.  First check for a calling thread.  */
+            if (thread_ptr == &_tx_timer_thread)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+#endif
+
+            /* Check for interrupt call.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+            {
+
+                /* Now, make sure the call is from an interrupt and not initialization.  */
+                if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+                {
+
+                    /* Invalid caller of this function, return appropriate error code.  */
+                    status =  TX_CALLER_ERROR;
+                }
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual priority queue create function.  */
+        status =  _tx_queue_priority_create(queue_ptr, name_ptr, message_size, queue_start, queue_size, priorities);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
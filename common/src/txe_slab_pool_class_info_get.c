@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_slab_pool_class_info_get                       PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the slab pool class information  */
+/*    get service.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to slab pool control block*/
+/*    class_index                       Index of the size class           */
+/*    block_size                        Destination for the block size of */
+/*                                        the class                       */
+/*    pages                             Destination for the number of     */
+/*                                        pages of the class              */
+/*    available_blocks                  Destination for the number of free*/
+/*                                        blocks of the class             */
+/*    allocated_blocks                  Destination for the number of     */
+/*                                        allocated blocks of the class   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_POOL_ERROR                     Invalid slab pool pointer         */
+/*    TX_OPTION_ERROR                   Invalid size class index          */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_slab_pool_class_info_get      Actual slab pool class info get   */
+/*                                        service                         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_slab_pool_class_info_get(TX_SLAB_POOL *pool_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *pages, ULONG *available_blocks, ULONG *allocated_blocks)
+{
+
+UINT    status;
+
+
+    /* Check for an invalid slab pool pointer.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Slab pool pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Now check the pool ID.  */
+    else if (pool_ptr -> tx_slab_pool_id != TX_SLAB_POOL_ID)
+    {
+
+        /* Slab pool pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Check for an invalid size class index.  */
+    else if (class_index >= pool_ptr -> tx_slab_pool_class_count)
+    {
+
+        /* Size class index is invalid, return appropriate error code.  */
+        status =  TX_OPTION_ERROR;
+    }
+    else
+    {
+
+        /* Otherwise, call the actual slab pool class information get service.  */
+        status =  _tx_slab_pool_class_info_get(pool_ptr, class_index, block_size,
+                        pages, available_blocks, allocated_blocks);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,265 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_slab_pool_create                               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the create slab memory pool      */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    name_ptr                          Pointer to slab pool name         */
+/*    class_sizes                       Pointer to the block sizes of the */
+/*                                        size classes, in ascending order*/
+/*    class_count                       Number of size classes            */
+/*    page_size                         Number of bytes in each page      */
+/*    pool_start                        Address of beginning of pool area */
+/*    pool_size                         Number of bytes in the slab pool  */
+/*    options                           Pool options                      */
+/*    pool_control_block_size           Size of slab pool control block   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_POOL_ERROR                     Invalid slab pool pointer         */
+/*    TX_PTR_ERROR                      Invalid starting address or size  */
+/*                                        class pointer                   */
+/*    TX_SIZE_ERROR                     Invalid size classes              */
+/*    TX_OPTION_ERROR                   Invalid pool options              */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_slab_pool_create              Actual slab pool create function  */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_slab_pool_create(TX_SLAB_POOL *pool_ptr, CHAR *name_ptr, ULONG *class_sizes, UINT class_count,
+                    ULONG page_size, VOID *pool_start, ULONG pool_size, UINT options, UINT pool_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+ULONG           i;
+UINT            class_index;
+TX_SLAB_POOL    *next_pool;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD       *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid pool pointer.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Pool pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Check for invalid control block size.  */
+    else if (pool_control_block_size != (sizeof(TX_SLAB_POOL)))
+    {
+
+        /* Pool pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_pool =   _tx_slab_pool_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_slab_pool_created_count; i++)
+        {
+
+            /* Determine if this slab pool matches the pool in the list.  */
+            if (pool_ptr == next_pool)
+            {
+
+                break;
+            }
+            else
+            {
+                /* Move to the next pool.  */
+                next_pool =  next_pool -> tx_slab_pool_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+
+        /* At this point, check to see if there is a duplicate pool.  */
+        if (pool_ptr == next_pool)
+        {
+
+            /* Pool is already created, return appropriate error code.  */
+            status =  TX_POOL_ERROR;
+        }
+
+        /* Check for an invalid starting address.  */
+        else if (pool_start == TX_NULL)
+        {
+
+            /* Null starting address pointer, return appropriate error.  */
+            status =  TX_PTR_ERROR;
+        }
+
+        /* Check for an invalid size class pointer.  */
+        else if (class_sizes == TX_NULL)
+        {
+
+            /* Null size class pointer, return appropriate error.  */
+            status =  TX_PTR_ERROR;
+        }
+
+        /* Check for an invalid number of size classes.  */
+        else if ((class_count == ((UINT) 0)) || (class_count > TX_SLAB_POOL_MAX_CLASSES))
+        {
+
+            /* Invalid number of size classes, return appropriate error.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check for invalid options.  */
+        else if ((options & ~TX_SLAB_POOL_BORROW_PAGES) != ((UINT) 0))
+        {
+
+            /* Invalid options, return appropriate error.  */
+            status =  TX_OPTION_ERROR;
+        }
+        else
+        {
+
+            /* Check that the block sizes are not zero and are in ascending order.  */
+            if (class_sizes[0] == ((ULONG) 0))
+            {
+
+                /* Invalid block size, return appropriate error.  */
+                status =  TX_SIZE_ERROR;
+            }
+            for (class_index =  ((UINT) 1); class_index < class_count; class_index++)
+            {
+
+                /* Is the block size larger than the previous one?  */
+                if (class_sizes[class_index] <= class_sizes[class_index - ((UINT) 1)])
+                {
+
+                    /* No, return appropriate error.  */
+                    status =  TX_SIZE_ERROR;
+                }
+            }
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Check for invalid caller of this function.  First check for a calling thread.  */
+            if (thread_ptr == &_tx_timer_thread)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+#endif
+
+            /* Check for interrupt call.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+            {
+
+                /* Now, make sure the call is from an interrupt and not initialization.  */
+                if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+                {
+
+                    /* Invalid caller of this function, return appropriate error code.  */
+                    status =  TX_CALLER_ERROR;
+                }
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual slab pool create function.  */
+        status =  _tx_slab_pool_create(pool_ptr, name_ptr, class_sizes, class_count, page_size, pool_start, pool_size, options);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
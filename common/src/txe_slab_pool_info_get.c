@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_slab_pool_info_get                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the slab pool information get    */
+/*    service.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to slab pool control block*/
+/*    name                              Destination for the pool name     */
+/*    available_pages                   Number of free pages in pool      */
+/*    total_pages                       Total number of pages in pool     */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on slab pool   */
+/*    suspended_count                   Destination for suspended count   */
+/*    next_pool                         Destination for pointer to next   */
+/*                                        slab pool on the created list   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_POOL_ERROR                     Invalid slab pool pointer         */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_slab_pool_info_get            Actual slab pool info get service */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_slab_pool_info_get(TX_SLAB_POOL *pool_ptr, CHAR **name, ULONG *available_pages,
+                    ULONG *total_pages, TX_THREAD **first_suspended,
+                    ULONG *suspended_count, TX_SLAB_POOL **next_pool)
+{
+
+UINT    status;
+
+
+    /* Check for an invalid slab pool pointer.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Slab pool pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Now check the pool ID.  */
+    else if (pool_ptr -> tx_slab_pool_id != TX_SLAB_POOL_ID)
+    {
+
+        /* Slab pool pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+    else
+    {
+
+        /* Otherwise, call the actual slab pool information get service.  */
+        status =  _tx_slab_pool_info_get(pool_ptr, name, available_pages,
+                        total_pages, first_suspended, suspended_count, next_pool);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
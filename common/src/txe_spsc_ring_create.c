@@ -0,0 +1,240 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_spsc_ring_create                               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the ring create function call.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ring_ptr                          Pointer to ring control block     */
+/*    name_ptr                          Pointer to ring name              */
+/*    message_size                      Size of each message in ULONG     */
+/*                                        words                           */
+/*    ring_start                        Starting address of the ring area */
+/*    ring_size                         Number of bytes in the ring area  */
+/*    ring_control_block_size           Size of ring control block        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_QUEUE_ERROR                    Invalid ring pointer              */
+/*    TX_PTR_ERROR                      Invalid starting address of ring  */
+/*    TX_SIZE_ERROR                     Invalid message size or ring size */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_spsc_ring_create              Actual ring create function       */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_spsc_ring_create(TX_SPSC_RING *ring_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *ring_start, ULONG ring_size, UINT ring_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+ULONG           i;
+TX_SPSC_RING    *next_ring;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD       *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid ring pointer.  */
+    if (ring_ptr == TX_NULL)
+    {
+
+        /* Ring pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+
+    /* Now check for a valid control block size.  */
+    else if (ring_control_block_size != (sizeof(TX_SPSC_RING)))
+    {
+
+        /* Ring pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_ring =   _tx_spsc_ring_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_spsc_ring_created_count; i++)
+        {
+
+            /* Determine if this ring matches the ring in the list.  */
+            if (ring_ptr == next_ring)
+            {
+
+                break;
+            }
+            else
+            {
+
+                /* Move to the next ring.  */
+                next_ring =  next_ring -> tx_spsc_ring_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+
+        /* At this point, check to see if there is a duplicate ring.  */
+        if (ring_ptr == next_ring)
+        {
+
+            /* Ring is already created, return appropriate error code.  */
+            status =  TX_QUEUE_ERROR;
+        }
+
+        /* Check the starting address of the ring.  */
+        else if (ring_start == TX_NULL)
+        {
+
+            /* Invalid starting address of ring.  */
+            status =  TX_PTR_ERROR;
+        }
+
+        /* Check for an invalid message size - less than 1.  */
+        else if (message_size < TX_1_ULONG)
+        {
+
+            /* Invalid message size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check for an invalid message size - greater than 16.  */
+        else if (message_size > TX_16_ULONG)
+        {
+
+            /* Invalid message size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check on the ring size.  */
+        else if ((ring_size/(sizeof(ULONG))) < message_size)
+        {
+
+            /* Invalid ring size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+        else
+        {
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Check for invalid caller of this function.  First check for a calling thread.  */
+            if (thread_ptr == &_tx_timer_thread)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+#endif
+
+            /* Check for interrupt call.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+            {
+
+                /* Now, make sure the call is from an interrupt and not initialization.  */
+                if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+                {
+
+                    /* Invalid caller of this function, return appropriate error code.  */
+                    status =  TX_CALLER_ERROR;
+                }
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual ring create function.  */
+        status =  _tx_spsc_ring_create(ring_ptr, name_ptr, message_size, ring_start, ring_size);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,202 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_wait_set_create                                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the wait set create function     */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set control block */
+/*    name_ptr                          Pointer to wait set name          */
+/*    wait_set_control_block_size       Size of wait set control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_WAIT_SET_ERROR                 Invalid wait set pointer          */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_wait_set_create               Actual create function            */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_wait_set_create(TX_WAIT_SET *wait_set_ptr, CHAR *name_ptr, UINT wait_set_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+ULONG               i;
+TX_WAIT_SET         *next_wait_set;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD           *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid wait set pointer.  */
+    if (wait_set_ptr == TX_NULL)
+    {
+
+        /* Wait set pointer is invalid, return appropriate error code.  */
+        status =  TX_WAIT_SET_ERROR;
+    }
+
+    /* Now check for a valid control block size.  */
+    else if (wait_set_control_block_size != (sizeof(TX_WAIT_SET)))
+    {
+
+        /* Wait set pointer is invalid, return appropriate error code.  */
+        status =  TX_WAIT_SET_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_wait_set =   _tx_wait_set_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_wait_set_created_count; i++)
+        {
+
+            /* Determine if this wait set matches the wait set in the list.  */
+            if (wait_set_ptr == next_wait_set)
+            {
+
+                break;
+            }
+            else
+            {
+
+                /* Move to the next wait set.  */
+                next_wait_set =  next_wait_set -> tx_wait_set_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+
+        /* At this point, check to see if there is a duplicate wait set.  */
+        if (wait_set_ptr == next_wait_set)
+        {
+
+            /* Wait set is already created, return appropriate error code.  */
+            status =  TX_WAIT_SET_ERROR;
+        }
+        else
+        {
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Check for invalid caller of this function.  First check for a calling thread.  */
+            if (thread_ptr == &_tx_timer_thread)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+#endif
+
+            /* Check for interrupt call.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+            {
+
+                /* Now, make sure the call is from an interrupt and not initialization.  */
+                if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+                {
+
+                    /* Invalid caller of this function, return appropriate error code.  */
+                    status =  TX_CALLER_ERROR;
+                }
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual wait set create function.  */
+        status =  _tx_wait_set_create(wait_set_ptr, name_ptr);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
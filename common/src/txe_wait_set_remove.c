@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_wait_set_remove                                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the wait set remove function     */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set control block */
+/*    object_ptr                        Pointer to queue, semaphore, or   */
+/*                                        event flags group               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_WAIT_SET_ERROR                 Invalid wait set pointer          */
+/*    TX_PTR_ERROR                      Invalid object pointer            */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_wait_set_remove               Actual remove function            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_wait_set_remove(TX_WAIT_SET *wait_set_ptr, VOID *object_ptr)
+{
+
+UINT            status;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid wait set pointer.  */
+    if (wait_set_ptr == TX_NULL)
+    {
+
+        /* Wait set pointer is invalid, return appropriate error code.  */
+        status =  TX_WAIT_SET_ERROR;
+    }
+
+    /* Now check for a valid wait set ID.  */
+    else if (wait_set_ptr -> tx_wait_set_id != TX_WAIT_SET_ID)
+    {
+
+        /* Wait set pointer is invalid, return appropriate error code.  */
+        status =  TX_WAIT_SET_ERROR;
+    }
+
+    /* Check for an invalid object pointer.  */
+    else if (object_ptr == TX_NULL)
+    {
+
+        /* Null object pointer, return appropriate error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Call actual wait set remove function.  */
+        status =  _tx_wait_set_remove(wait_set_ptr, object_ptr);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
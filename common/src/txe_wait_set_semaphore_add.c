@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_semaphore.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_wait_set_semaphore_add                         PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the wait set semaphore add       */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set control block */
+/*    semaphore_ptr                     Pointer to semaphore control      */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_WAIT_SET_ERROR                 Invalid wait set pointer          */
+/*    TX_SEMAPHORE_ERROR                Invalid semaphore pointer         */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_wait_set_semaphore_add        Actual semaphore add function     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_wait_set_semaphore_add(TX_WAIT_SET *wait_set_ptr, TX_SEMAPHORE *semaphore_ptr)
+{
+
+UINT            status;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid wait set pointer.  */
+    if (wait_set_ptr == TX_NULL)
+    {
+
+        /* Wait set pointer is invalid, return appropriate error code.  */
+        status =  TX_WAIT_SET_ERROR;
+    }
+
+    /* Now check for a valid wait set ID.  */
+    else if (wait_set_ptr -> tx_wait_set_id != TX_WAIT_SET_ID)
+    {
+
+        /* Wait set pointer is invalid, return appropriate error code.  */
+        status =  TX_WAIT_SET_ERROR;
+    }
+
+    /* Check for an invalid semaphore pointer.  */
+    else if (semaphore_ptr == TX_NULL)
+    {
+
+        /* Semaphore pointer is invalid, return appropriate error code.  */
+        status =  TX_SEMAPHORE_ERROR;
+    }
+
+    /* Now check for a valid semaphore ID.  */
+    else if (semaphore_ptr -> tx_semaphore_id != TX_SEMAPHORE_ID)
+    {
+
+        /* Semaphore pointer is invalid, return appropriate error code.  */
+        status =  TX_SEMAPHORE_ERROR;
+    }
+    else
+    {
+
+        /* Call actual wait set semaphore add function.  */
+        status =  _tx_wait_set_semaphore_add(wait_set_ptr, semaphore_ptr);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
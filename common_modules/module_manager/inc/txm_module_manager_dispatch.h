@@ -1355,7 +1355,7 @@ TX_QUEUE *queue_ptr;
 
         /* We need to get the size of the message from the queue.  */
         queue_ptr =  (TX_QUEUE *) param_0;
-        if (!TXM_MODULE_MANAGER_PARAM_CHECK_BUFFER_READ(module_instance, param_1, queue_ptr -> tx_queue_message_size))
+        if (!TXM_MODULE_MANAGER_PARAM_CHECK_BUFFER_READ(module_instance, param_1, queue_ptr -> tx_queue_message_bytes))
             return(TXM_MODULE_INVALID_MEMORY);
     }
 
@@ -1569,7 +1569,7 @@ TX_QUEUE *queue_ptr;
 
         /* We need to get the max size of the buffer from the queue.  */
         queue_ptr =  (TX_QUEUE *) param_0;
-        if (!TXM_MODULE_MANAGER_PARAM_CHECK_BUFFER_WRITE(module_instance, param_1, sizeof(ULONG)*queue_ptr -> tx_queue_message_size))
+        if (!TXM_MODULE_MANAGER_PARAM_CHECK_BUFFER_WRITE(module_instance, param_1, queue_ptr -> tx_queue_message_bytes))
             return(TXM_MODULE_INVALID_MEMORY);
     }
 
@@ -1601,7 +1601,7 @@ TX_QUEUE *queue_ptr;
 
         /* We need to get the size of the message from the queue.  */
         queue_ptr =  (TX_QUEUE *) param_0;
-        if (!TXM_MODULE_MANAGER_PARAM_CHECK_BUFFER_READ(module_instance, param_1, sizeof(ULONG)*queue_ptr -> tx_queue_message_size))
+        if (!TXM_MODULE_MANAGER_PARAM_CHECK_BUFFER_READ(module_instance, param_1, queue_ptr -> tx_queue_message_bytes))
             return(TXM_MODULE_INVALID_MEMORY);
     }
 
@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    tx_api.h                                            PORTABLE SMP    */
-/*                                                           6.2.1        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -85,6 +85,37 @@
 /*  03-08-2023      Tiejun Zhou             Modified comment(s),          */
 /*                                            update patch number,        */
 /*                                            resulting in version 6.2.1  */
+/*  xx-xx-xxxx      Microsoft Corporation   Added byte pool allocation    */
+/*                                            policy, added coalescing    */
+/*                                            first-fit byte pool policy, */
+/*                                            added byte pool size-class  */
+/*                                            cache, added byte pool      */
+/*                                            search restart and maximum  */
+/*                                            search length counters,     */
+/*                                            added byte pool suspended   */
+/*                                            size map, added aligned     */
+/*                                            byte allocation, added byte */
+/*                                            reallocate, added byte pool */
+/*                                            fragmentation information,  */
+/*                                            added per-core arenas,      */
+/*                                            added bulk block allocate   */
+/*                                            and release, added per-core */
+/*                                            block pool caches, added    */
+/*                                            slab pool services, added   */
+/*                                            lock-free block pool        */
+/*                                            option, added message       */
+/*                                            buffer services, added      */
+/*                                            zero-copy reserve, commit,  */
+/*                                            acquire and release         */
+/*                                            services, added queue send  */
+/*                                            and receive multiple        */
+/*                                            services, added queue       */
+/*                                            message sizes in bytes,     */
+/*                                            added priority queues,      */
+/*                                            added wait sets, added byte */
+/*                                            pool waiter size-class      */
+/*                                            lists, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 
@@ -156,6 +187,10 @@ extern   "C" {
 #define TX_4_ULONG                      ((UINT)   4)
 #define TX_8_ULONG                      ((UINT)   8)
 #define TX_16_ULONG                     ((UINT)   16)
+#define TX_QUEUE_MESSAGE_BYTES_BASE     ((UINT)   0x8000)
+#define TX_QUEUE_MAXIMUM_MESSAGE_BYTES  ((UINT)   0x7FFF)
+#define TX_QUEUE_MESSAGE_BYTES(n)       (TX_QUEUE_MESSAGE_BYTES_BASE + ((UINT) (n)))
+#define TX_QUEUE_MAXIMUM_PRIORITIES     ((UINT)   32)
 #define TX_NO_TIME_SLICE                ((ULONG)  0)
 #define TX_AUTO_START                   ((UINT)   1)
 #define TX_DONT_START                   ((UINT)   0)
@@ -173,6 +208,17 @@ extern   "C" {
 #define TX_EMPTY                        ((ULONG)  0)
 #define TX_CLEAR_ID                     ((ULONG)  0)
 #define TX_STACK_FILL                   ((ULONG)  0xEFEFEFEFUL)
+#define TX_BYTE_POOL_FIRST_FIT          ((UINT)   0)
+#define TX_BYTE_POOL_TLSF               ((UINT)   1)
+#define TX_BYTE_POOL_FIRST_FIT_COALESCE ((UINT)   2)
+#define TX_SLAB_POOL_NO_BORROW          ((UINT)   0)
+#define TX_SLAB_POOL_BORROW_PAGES       ((UINT)   1)
+#define TX_THREAD_NOTIFY_SET_BITS       ((UINT)   0)
+#define TX_THREAD_NOTIFY_INCREMENT      ((UINT)   1)
+#define TX_THREAD_NOTIFY_OVERWRITE      ((UINT)   2)
+#define TX_THREAD_NOTIFY_KEEP           ((UINT)   0)
+#define TX_THREAD_NOTIFY_CLEAR          ((UINT)   1)
+#define TX_THREAD_NOTIFY_DECREMENT      ((UINT)   2)
 
 
 /* Thread execution state values.  */
@@ -192,6 +238,8 @@ extern   "C" {
 #define TX_TCP_IP                       ((UINT) 12)
 #define TX_MUTEX_SUSP                   ((UINT) 13)
 #define TX_PRIORITY_CHANGE              ((UINT) 14)
+#define TX_WAIT_SET_SUSP                ((UINT) 15)
+#define TX_NOTIFY_SUSP                  ((UINT) 16)
 
 
 /* API return values.  */
@@ -232,6 +280,7 @@ extern   "C" {
 #define TX_NOT_DONE                     ((UINT) 0x20)
 #define TX_CEILING_EXCEEDED             ((UINT) 0x21)
 #define TX_INVALID_CEILING              ((UINT) 0x22)
+#define TX_WAIT_SET_ERROR               ((UINT) 0x23)
 #define TX_FEATURE_NOT_ENABLED          ((UINT) 0xFF)
 
 
@@ -583,6 +632,31 @@ typedef struct TX_THREAD_STRUCT
     struct TX_MUTEX_STRUCT
                         *tx_thread_owned_mutex_list;
 
+#ifdef TX_THREAD_ENABLE_NOTIFICATION
+
+    /* Define the notification value of the thread, along with a flag that is
+       set when the thread is notified and cleared when the thread receives
+       the notification with tx_thread_notify_wait.  */
+    ULONG               tx_thread_notify_value;
+    UINT                tx_thread_notify_pending;
+#endif
+
+    /* Define the links of the size-class list of the byte pool the thread
+       is suspended on, along with the stamp that gives the order of the
+       thread in the suspension list of the pool.  */
+    struct TX_THREAD_STRUCT
+                        *tx_thread_suspended_class_next,
+                        *tx_thread_suspended_class_previous;
+    ULONG               tx_thread_suspended_class_stamp;
+
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+    /* Define the priority under which the thread is placed in a priority-ordered
+       suspension list.  The thread keeps its place if its priority changes while
+       it is suspended.  */
+    UINT                tx_thread_suspension_priority;
+#endif
+
 #ifdef TX_THREAD_ENABLE_PERFORMANCE_INFO
 
     /* Define the number of times this thread is resumed.  */
@@ -648,6 +722,37 @@ typedef struct TX_THREAD_STRUCT
 } TX_THREAD;
 
 
+/* Define the optional per-core cache of a block pool. Each core keeps a LIFO list of
+   free blocks that is refilled from and drained to the available list of the pool in
+   batches. The cache is only accessed by the thread that holds its lock, so the global
+   protection is not needed.  */
+
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+typedef struct TX_BLOCK_POOL_CORE_CACHE_STRUCT
+{
+
+    /* Define the lock of the cache, which is not NULL while the cache is in use.  */
+    UCHAR               *tx_block_pool_core_cache_lock;
+
+    /* Define the list of free blocks and the number of blocks on it.  */
+    UCHAR               *tx_block_pool_core_cache_list;
+    UINT                tx_block_pool_core_cache_count;
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of allocations satisfied by the cache.  */
+    ULONG               tx_block_pool_core_cache_performance_hit_count;
+
+    /* Define the number of times the cache was refilled from the pool.  */
+    ULONG               tx_block_pool_core_cache_performance_refill_count;
+
+    /* Define the number of times the cache was drained to the pool.  */
+    ULONG               tx_block_pool_core_cache_performance_drain_count;
+#endif
+} TX_BLOCK_POOL_CORE_CACHE;
+#endif
+
+
 /* Define the block memory pool structure utilized by the application.  */
 
 typedef struct TX_BLOCK_POOL_STRUCT
@@ -703,6 +808,35 @@ typedef struct TX_BLOCK_POOL_STRUCT
     ULONG               tx_block_pool_performance_timeout_count;
 #endif
 
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+
+    /* Define the per-core caches of free blocks.  */
+    TX_BLOCK_POOL_CORE_CACHE
+                        tx_block_pool_core_cache[TX_THREAD_SMP_MAX_CORES];
+
+    /* Define the maximum number of blocks in each core cache. A value of
+       zero disables the core caches.  */
+    UINT                tx_block_pool_core_cache_depth;
+
+    /* Define the flag that is set when a thread finds the pool empty, which
+       makes released blocks bypass the core caches until no thread waits.  */
+    UINT                tx_block_pool_core_cache_bypass;
+#endif
+
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+    /* Define the head of the lock-free list of available blocks. It holds the
+       index of the first block, a flag that is set while threads wait for a
+       block, and a tag that changes with every update of the list.  */
+    ULONG               tx_block_pool_lock_free_head;
+
+    /* Define the number of blocks on the lock-free list.  */
+    ULONG               tx_block_pool_lock_free_available;
+
+    /* Define the flag that is set once the pool uses the lock-free list.  */
+    UINT                tx_block_pool_lock_free_enabled;
+#endif
+
     /* Define the port extension in the block pool control block. This
        is typically defined to whitespace in tx_port.h.  */
     TX_BLOCK_POOL_EXTENSION
@@ -726,6 +860,91 @@ typedef struct TX_BLOCK_POOL_STRUCT
 #endif
 
 
+/* Define the size classes of the optional byte pool cache. Class N holds blocks of at
+   least TX_BYTE_POOL_CACHE_MIN_SIZE << N bytes. The minimum size must be a power of two
+   large enough to hold a pointer.  */
+
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+#ifndef TX_BYTE_POOL_CACHE_CLASSES
+#define TX_BYTE_POOL_CACHE_CLASSES      ((UINT) 5)
+#endif
+#ifndef TX_BYTE_POOL_CACHE_MIN_SIZE
+#define TX_BYTE_POOL_CACHE_MIN_SIZE     ((ULONG) 16)
+#endif
+#endif
+
+
+/* Define the number of size classes of the requests of threads suspended on a byte pool.
+   Class N holds the requests of 2^N up to 2^(N+1)-1 bytes, and class 31 also holds all
+   larger requests, so that each class has one bit in a ULONG map.  */
+
+#define TX_BYTE_POOL_SIZE_CLASSES       ((UINT) 32)
+
+
+/* Define the number of classes of the optional free block size histogram of byte pools.
+   Class N counts the free blocks of 2^(N+4) up to 2^(N+5)-1 bytes.  */
+
+#ifdef TX_BYTE_POOL_ENABLE_FRAGMENTATION_INFO
+#ifndef TX_BYTE_POOL_FRAGMENTATION_CLASSES
+#define TX_BYTE_POOL_FRAGMENTATION_CLASSES  ((UINT) 16)
+#endif
+#endif
+
+
+/* Define the size classes of the optional per-core byte pool arenas and the number of
+   blocks allocated from the pool when an arena class is empty. Class N holds blocks of
+   at least TX_BYTE_POOL_ARENA_MIN_SIZE << N bytes. The minimum size must be a power of
+   two large enough to hold a pointer.  */
+
+#ifdef TX_BYTE_POOL_ENABLE_ARENAS
+#ifndef TX_BYTE_POOL_ARENA_CLASSES
+#define TX_BYTE_POOL_ARENA_CLASSES      ((UINT) 5)
+#endif
+#ifndef TX_BYTE_POOL_ARENA_MIN_SIZE
+#define TX_BYTE_POOL_ARENA_MIN_SIZE     ((ULONG) 16)
+#endif
+#ifndef TX_BYTE_POOL_ARENA_REFILL_COUNT
+#define TX_BYTE_POOL_ARENA_REFILL_COUNT ((UINT) 4)
+#endif
+
+
+/* Define the per-core arena of a byte pool. Each arena holds blocks that remain
+   allocated from the pool on LIFO lists of size classes. The arena is only accessed
+   by the core that holds its lock, so the global protection is not needed. Blocks
+   released on other cores are placed on the deferred list without taking the lock
+   and are moved to the classes by the owning core.  */
+
+typedef struct TX_BYTE_POOL_ARENA_STRUCT
+{
+
+    /* Define the lock of the arena, which is not NULL while the arena is in use.  */
+    UCHAR               *tx_byte_pool_arena_lock;
+
+    /* Define the list of blocks released to this arena by other cores.  */
+    UCHAR               *tx_byte_pool_arena_deferred_list;
+
+    /* Define the lists of blocks of each class and the number of blocks on them.  */
+    UCHAR               *tx_byte_pool_arena_list[TX_BYTE_POOL_ARENA_CLASSES];
+    UINT                tx_byte_pool_arena_count[TX_BYTE_POOL_ARENA_CLASSES];
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of allocations satisfied by the arena.  */
+    ULONG               tx_byte_pool_arena_performance_hit_count;
+
+    /* Define the number of times the arena was refilled from the pool.  */
+    ULONG               tx_byte_pool_arena_performance_refill_count;
+
+    /* Define the number of blocks taken from this arena by other cores.  */
+    ULONG               tx_byte_pool_arena_performance_steal_count;
+
+    /* Define the number of blocks released to this arena by other cores.  */
+    ULONG               tx_byte_pool_arena_performance_remote_release_count;
+#endif
+} TX_BYTE_POOL_ARENA;
+#endif
+
+
 /* Define the byte memory pool structure utilized by the application.  */
 
 typedef struct TX_BYTE_POOL_STRUCT
@@ -773,6 +992,75 @@ typedef struct TX_BYTE_POOL_STRUCT
                         *tx_byte_pool_created_next,
                         *tx_byte_pool_created_previous;
 
+    /* Define the allocation policy selected when the pool was created.  */
+    UINT                tx_byte_pool_policy;
+
+    /* Define the pointer to the two-level segregated fit (TLSF) index. This
+       is only used by TLSF pools and is located at the start of the pool's
+       memory area.  */
+    struct TX_BYTE_POOL_TLSF_STRUCT
+                        *tx_byte_pool_tlsf;
+
+    /* Define the map of the size classes of the requests of suspended
+       threads. Bit N is set if a thread is suspended with a request of
+       size class N, and only then is the list of class N valid.  */
+    ULONG               tx_byte_pool_suspended_size_map;
+
+    /* Define the lists of the suspended threads of each size class. Each
+       list is in the order of the suspension list.  */
+    struct TX_THREAD_STRUCT
+                        *tx_byte_pool_suspended_class_list[TX_BYTE_POOL_SIZE_CLASSES];
+
+    /* Define the stamp given to the next suspended thread. Stamps increase
+       along the suspension list.  */
+    ULONG               tx_byte_pool_suspended_class_stamp;
+
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+
+    /* Define the size-class cache of recently released blocks. Each class
+       is a LIFO list of blocks that remain allocated from the pool until
+       the cache is flushed.  */
+    UCHAR               *tx_byte_pool_cache_list[TX_BYTE_POOL_CACHE_CLASSES];
+    UINT                tx_byte_pool_cache_count[TX_BYTE_POOL_CACHE_CLASSES];
+
+    /* Define the maximum number of blocks in each cache class. A value
+       of zero disables the cache.  */
+    UINT                tx_byte_pool_cache_depth;
+#endif
+
+#ifdef TX_BYTE_POOL_ENABLE_FRAGMENTATION_INFO
+
+    /* Define the histogram of the sizes of the free blocks, which is updated
+       as blocks are split and merged. The first class also counts smaller
+       blocks and the last class also counts larger blocks.  */
+    ULONG               tx_byte_pool_fragmentation_histogram[TX_BYTE_POOL_FRAGMENTATION_CLASSES];
+
+    /* Define the number of bytes in free blocks, not counting the headers.  */
+    ULONG               tx_byte_pool_fragmentation_free_bytes;
+
+    /* Define the size of the largest free block and the number of free blocks
+       of that size. Once the last of these blocks is allocated, the size is
+       lowered to the smallest size of the largest non-empty class and the
+       count is zero until a larger block is freed.  */
+    ULONG               tx_byte_pool_fragmentation_largest;
+    ULONG               tx_byte_pool_fragmentation_largest_count;
+#endif
+
+#ifdef TX_BYTE_POOL_ENABLE_ARENAS
+
+    /* Define the per-core arenas of the pool.  */
+    TX_BYTE_POOL_ARENA  tx_byte_pool_arena[TX_THREAD_SMP_MAX_CORES];
+
+    /* Define the maximum number of blocks released to each class of an
+       arena by its own core. A value of zero disables the arenas.  */
+    UINT                tx_byte_pool_arena_depth;
+
+    /* Define the number of threads that have found the pool empty and not
+       yet completed their allocation. While it is not zero, released blocks
+       bypass the arenas.  */
+    UINT                tx_byte_pool_arena_bypass;
+#endif
+
 #ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
 
     /* Define the number of allocates.  */
@@ -796,6 +1084,27 @@ typedef struct TX_BYTE_POOL_STRUCT
 
     /* Define the number of byte pool timeouts.  */
     ULONG               tx_byte_pool_performance_timeout_count;
+
+    /* Define the number of times a search was restarted because another
+       thread took over the pool.  */
+    ULONG               tx_byte_pool_performance_search_restart_count;
+
+    /* Define the maximum number of blocks examined by a single search.  */
+    ULONG               tx_byte_pool_performance_search_max_count;
+
+    /* Define the number of reallocations done in place.  */
+    ULONG               tx_byte_pool_performance_reallocate_in_place_count;
+
+    /* Define the number of reallocations that moved the memory to a new block.  */
+    ULONG               tx_byte_pool_performance_reallocate_moved_count;
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+
+    /* Define the number of allocations satisfied by the cache.  */
+    ULONG               tx_byte_pool_performance_cache_hit_count;
+
+    /* Define the number of cacheable allocations that required a search.  */
+    ULONG               tx_byte_pool_performance_cache_miss_count;
+#endif
 #endif
 
     /* Define the port extension in the byte pool control block. This
@@ -805,6 +1114,149 @@ typedef struct TX_BYTE_POOL_STRUCT
 } TX_BYTE_POOL;
 
 
+/* Define the maximum number of size classes of a slab pool and the granularity of the
+   size routing table. Class block sizes are rounded up to a multiple of the granule, which
+   must be a multiple of sizeof(ALIGN_TYPE). The routing table takes one byte for each
+   granule up to the largest class block size.  */
+
+#ifndef TX_SLAB_POOL_MAX_CLASSES
+#define TX_SLAB_POOL_MAX_CLASSES        ((UINT) 8)
+#endif
+#ifndef TX_SLAB_POOL_ROUTE_GRANULE
+#define TX_SLAB_POOL_ROUTE_GRANULE      (sizeof(ALIGN_TYPE))
+#endif
+
+
+/* Define the size class structure of a slab pool.  */
+
+typedef struct TX_SLAB_POOL_CLASS_STRUCT
+{
+
+    /* Define the slab pool the class belongs to.  */
+    struct TX_SLAB_POOL_STRUCT
+                        *tx_slab_pool_class_pool;
+
+    /* Save the block size of the class - rounded for alignment.  */
+    ULONG               tx_slab_pool_class_block_size;
+
+    /* Save the number of blocks that fit in one page.  */
+    UINT                tx_slab_pool_class_page_blocks;
+
+    /* Define the number of pages held by the class.  */
+    UINT                tx_slab_pool_class_pages;
+
+    /* Define the number of free blocks in the pages of the class.  */
+    UINT                tx_slab_pool_class_available;
+
+    /* Define the head pointer of the list of pages of the class that have
+       free blocks.  */
+    struct TX_SLAB_POOL_PAGE_STRUCT
+                        *tx_slab_pool_class_page_list;
+
+} TX_SLAB_POOL_CLASS;
+
+
+/* Define the slab memory pool structure utilized by the application.  */
+
+typedef struct TX_SLAB_POOL_STRUCT
+{
+
+    /* Define the slab pool ID used for error checking.  */
+    ULONG               tx_slab_pool_id;
+
+    /* Define the slab pool's name.  */
+    CHAR                *tx_slab_pool_name;
+
+    /* Save the slab pool's options, i.e. page borrowing.  */
+    UINT                tx_slab_pool_options;
+
+    /* Save the start address of the slab pool's memory area.  */
+    UCHAR               *tx_slab_pool_start;
+
+    /* Save the slab pool's size in bytes.  */
+    ULONG               tx_slab_pool_size;
+
+    /* Define the size routing table, which holds the class index for each
+       granule of request sizes.  */
+    UCHAR               *tx_slab_pool_route;
+
+    /* Save the largest request size, i.e. the block size of the largest class.  */
+    ULONG               tx_slab_pool_route_limit;
+
+    /* Save the size of each page - rounded for alignment.  */
+    ULONG               tx_slab_pool_page_size;
+
+    /* Define the number of free pages and the total number of pages.  */
+    UINT                tx_slab_pool_pages_available;
+    UINT                tx_slab_pool_pages_total;
+
+    /* Define the head pointer of the free page list.  */
+    struct TX_SLAB_POOL_PAGE_STRUCT
+                        *tx_slab_pool_page_list;
+
+    /* Define the size classes of the pool.  */
+    UINT                tx_slab_pool_class_count;
+    TX_SLAB_POOL_CLASS  tx_slab_pool_class[TX_SLAB_POOL_MAX_CLASSES];
+
+    /* Define the slab pool suspension list head along with a count of
+       how many threads are suspended.  */
+    struct TX_THREAD_STRUCT
+                        *tx_slab_pool_suspension_list;
+    UINT                tx_slab_pool_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_SLAB_POOL_STRUCT
+                        *tx_slab_pool_created_next,
+                        *tx_slab_pool_created_previous;
+
+} TX_SLAB_POOL;
+
+
+/* Define the wait set member structure, which is part of each queue, semaphore, and
+   event flags group control block when wait sets are enabled.  */
+
+typedef struct TX_WAIT_SET_MEMBER_STRUCT
+{
+
+    /* Define the wait set this object is a member of, TX_NULL if none.  */
+    struct TX_WAIT_SET_STRUCT
+                        *tx_wait_set_member_set;
+
+    /* Define the next member of the same wait set.  */
+    struct TX_WAIT_SET_MEMBER_STRUCT
+                        *tx_wait_set_member_next;
+
+    /* Define the object this member belongs to, along with the ID of its object
+       type, which selects how the readiness of the object is determined.  */
+    VOID                *tx_wait_set_member_object;
+    ULONG               tx_wait_set_member_type;
+
+} TX_WAIT_SET_MEMBER;
+
+
+/* Define the priority suspension structure, which is part of each semaphore and mutex
+   control block when priority-ordered suspension lists are enabled.  The suspension list
+   of an ordered object is sorted by priority, with a bit map of the priorities that have
+   suspended threads and the first suspended thread of each such priority.  */
+
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+typedef struct TX_PRIORITY_SUSPENSION_STRUCT
+{
+
+    /* Define the flag that is set if the suspension list is kept in priority order.  */
+    UINT                tx_priority_suspension_enabled;
+
+    /* Define the bit map of priorities with suspended threads.  */
+    ULONG               tx_priority_suspension_maps[TX_MAX_PRIORITIES/32];
+
+    /* Define the first suspended thread of each priority.  */
+    struct TX_THREAD_STRUCT
+                        *tx_priority_suspension_first[TX_MAX_PRIORITIES];
+
+} TX_PRIORITY_SUSPENSION;
+#endif
+
+
 /* Define the event flags group structure utilized by the application.  */
 
 typedef struct TX_EVENT_FLAGS_GROUP_STRUCT
@@ -860,6 +1312,12 @@ typedef struct TX_EVENT_FLAGS_GROUP_STRUCT
     VOID                (*tx_event_flags_group_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *group_ptr);
 #endif
 
+#ifdef TX_ENABLE_WAIT_SET
+
+    /* Define the wait set membership of this event flags group.  */
+    TX_WAIT_SET_MEMBER  tx_event_flags_group_wait_set_member;
+#endif
+
     /* Define the port extension in the event flags group control block. This
        is typically defined to whitespace in tx_port.h.  */
     TX_EVENT_FLAGS_GROUP_EXTENSION
@@ -957,6 +1415,29 @@ typedef struct TX_MUTEX_STRUCT
     ULONG               tx_mutex_performance__priority_inheritance_count;
 #endif
 
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+    /* Define the priority order of the suspension list.  */
+    TX_PRIORITY_SUSPENSION
+                        tx_mutex_priority_suspension;
+#endif
+
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+
+    /* Define the maximum number of times the mutex is polled while its owner
+       executes on another core. A value of zero disables spinning.  */
+    ULONG               tx_mutex_spin_limit;
+
+#ifdef TX_MUTEX_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of spins that obtained the mutex.  */
+    ULONG               tx_mutex_performance_spin_success_count;
+
+    /* Define the number of spins that ended in a suspension.  */
+    ULONG               tx_mutex_performance_spin_fail_count;
+#endif
+#endif
+
     /* Define the port extension in the mutex control block. This
        is typically defined to whitespace in tx_port.h.  */
     TX_MUTEX_EXTENSION
@@ -978,6 +1459,9 @@ typedef struct TX_QUEUE_STRUCT
     /* Define the message size that was specified in queue creation.  */
     UINT                tx_queue_message_size;
 
+    /* Define the size of each message in bytes.  */
+    UINT                tx_queue_message_bytes;
+
     /* Define the total number of messages in the queue.  */
     UINT                tx_queue_capacity;
 
@@ -1007,6 +1491,35 @@ typedef struct TX_QUEUE_STRUCT
                         *tx_queue_created_next,
                         *tx_queue_created_previous;
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+    /* Define the number of outstanding zero-copy reservations along with the
+       number of message slots behind the enqueued messages, which are held
+       back until all of the reservations are committed.  */
+    UINT                tx_queue_reserved;
+    UINT                tx_queue_pending;
+
+    /* Define the number of outstanding zero-copy acquisitions along with the
+       number of message slots before the read pointer, which are held until
+       all of the acquisitions are released.  */
+    UINT                tx_queue_acquired;
+    UINT                tx_queue_consumed;
+#endif
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+    /* Define the number of message priorities, zero for a queue that is not
+       ordered by priority, along with the bit map of the priorities that
+       have messages.  */
+    UINT                tx_queue_priorities;
+    ULONG               tx_queue_priority_map;
+
+    /* Define the first and last message slot of each priority, which are
+       at the start of the queue area, and the first free message slot.  */
+    ULONG               *tx_queue_priority_lists;
+    ULONG               tx_queue_priority_free;
+#endif
+
 #ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
 
     /* Define the number of messages sent to this queue.  */
@@ -1027,6 +1540,10 @@ typedef struct TX_QUEUE_STRUCT
 
     /* Define the number of queue timeouts.  */
     ULONG               tx_queue_performance_timeout_count;
+
+    /* Define the number of messages overwritten on this queue by
+       overwrite sends to the full queue.  */
+    ULONG               tx_queue_performance_overwrite_count;
 #endif
 
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
@@ -1036,6 +1553,12 @@ typedef struct TX_QUEUE_STRUCT
     VOID                (*tx_queue_send_notify)(struct TX_QUEUE_STRUCT *queue_ptr);
 #endif
 
+#ifdef TX_ENABLE_WAIT_SET
+
+    /* Define the wait set membership of this queue.  */
+    TX_WAIT_SET_MEMBER  tx_queue_wait_set_member;
+#endif
+
     /* Define the port extension in the queue control block. This
        is typically defined to whitespace in tx_port.h.  */
     TX_QUEUE_EXTENSION
@@ -1043,6 +1566,80 @@ typedef struct TX_QUEUE_STRUCT
 } TX_QUEUE;
 
 
+/* Define the message buffer structure utilized by the application.  */
+
+typedef struct TX_MESSAGE_BUFFER_STRUCT
+{
+
+    /* Define the message buffer ID used for error checking.  */
+    ULONG               tx_message_buffer_id;
+
+    /* Define the message buffer's name.  */
+    CHAR                *tx_message_buffer_name;
+
+    /* Define the size of the message buffer's ring in bytes - a multiple of
+       sizeof(ULONG).  */
+    ULONG               tx_message_buffer_size;
+
+    /* Define the number of bytes that are not used by messages.  */
+    ULONG               tx_message_buffer_available;
+
+    /* Define the number of messages in the message buffer.  */
+    UINT                tx_message_buffer_enqueued;
+
+    /* Define the start and end of the message buffer's ring.  Note that
+       the end is one past the last byte of the ring.  */
+    UCHAR               *tx_message_buffer_start;
+    UCHAR               *tx_message_buffer_end;
+
+    /* Define the read and write pointers.  Each message is stored as a ULONG
+       length followed by the message, padded to a multiple of sizeof(ULONG).  */
+    UCHAR               *tx_message_buffer_read;
+    UCHAR               *tx_message_buffer_write;
+
+    /* Define the message buffer suspension list head along with a count of
+       how many threads are suspended.  */
+    struct TX_THREAD_STRUCT
+                        *tx_message_buffer_suspension_list;
+    UINT                tx_message_buffer_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_MESSAGE_BUFFER_STRUCT
+                        *tx_message_buffer_created_next,
+                        *tx_message_buffer_created_previous;
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of messages sent to this message buffer.  */
+    ULONG               tx_message_buffer_performance_messages_sent_count;
+
+    /* Define the number of messages received from this message buffer.  */
+    ULONG               tx_message_buffer_performance_messages_received_count;
+
+    /* Define the number of empty suspensions on this message buffer.  */
+    ULONG               tx_message_buffer_performance_empty_suspension_count;
+
+    /* Define the number of full suspensions on this message buffer.  */
+    ULONG               tx_message_buffer_performance_full_suspension_count;
+
+    /* Define the number of full non-suspensions on this message buffer. These
+       messages are rejected with an appropriate error code.  */
+    ULONG               tx_message_buffer_performance_full_error_count;
+
+    /* Define the number of message buffer timeouts.  */
+    ULONG               tx_message_buffer_performance_timeout_count;
+#endif
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+    /* Define the application callback routine used to notify the application when
+       a message is sent to the message buffer.  */
+    VOID                (*tx_message_buffer_send_notify)(struct TX_MESSAGE_BUFFER_STRUCT *message_buffer_ptr);
+#endif
+
+} TX_MESSAGE_BUFFER;
+
+
 /* Define the semaphore structure utilized by the application.  */
 
 typedef struct TX_SEMAPHORE_STRUCT
@@ -1091,6 +1688,19 @@ typedef struct TX_SEMAPHORE_STRUCT
     VOID                (*tx_semaphore_put_notify)(struct TX_SEMAPHORE_STRUCT *semaphore_ptr);
 #endif
 
+#ifdef TX_ENABLE_WAIT_SET
+
+    /* Define the wait set membership of this semaphore.  */
+    TX_WAIT_SET_MEMBER  tx_semaphore_wait_set_member;
+#endif
+
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+    /* Define the priority order of the suspension list.  */
+    TX_PRIORITY_SUSPENSION
+                        tx_semaphore_priority_suspension;
+#endif
+
     /* Define the port extension in the semaphore control block. This
        is typically defined to whitespace in tx_port.h.  */
     TX_SEMAPHORE_EXTENSION
@@ -1098,6 +1708,98 @@ typedef struct TX_SEMAPHORE_STRUCT
 } TX_SEMAPHORE;
 
 
+/* Define the size of a cache line, which is used to place the producer and the consumer
+   indices of a single-producer single-consumer ring on separate cache lines. This may be
+   redefined in tx_port.h.  */
+
+#ifndef TX_SPSC_RING_CACHE_LINE_SIZE
+#define TX_SPSC_RING_CACHE_LINE_SIZE    ((UINT) 64)
+#endif
+
+
+/* Define the single-producer single-consumer ring structure utilized by the application.  */
+
+typedef struct TX_SPSC_RING_STRUCT
+{
+
+    /* Define the ring ID used for error checking.  */
+    ULONG               tx_spsc_ring_id;
+
+    /* Define the ring's name.  */
+    CHAR                *tx_spsc_ring_name;
+
+    /* Define the message size in ULONG words and the number of messages the
+       ring holds, which is a power of two.  */
+    UINT                tx_spsc_ring_message_size;
+    ULONG               tx_spsc_ring_capacity;
+
+    /* Define the start of the message area.  */
+    ULONG               *tx_spsc_ring_start;
+
+    /* Define the producer and the consumer suspended on the ring, if any.  */
+    struct TX_THREAD_STRUCT
+                        *tx_spsc_ring_producer_thread;
+    struct TX_THREAD_STRUCT
+                        *tx_spsc_ring_consumer_thread;
+
+    /* Define the flags that tell the other side that the producer or the consumer
+       is suspending, and must be resumed after the next receive or send.  */
+    ULONG               tx_spsc_ring_producer_waiting;
+    ULONG               tx_spsc_ring_consumer_waiting;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_SPSC_RING_STRUCT
+                        *tx_spsc_ring_created_next,
+                        *tx_spsc_ring_created_previous;
+
+    /* Keep the fields above, which rarely change, off the producer's cache line.  */
+    ULONG               tx_spsc_ring_reserved_1[TX_SPSC_RING_CACHE_LINE_SIZE/(sizeof(ULONG))];
+
+    /* Define the producer index, the number of messages ever sent, along with the
+       producer's copy of the consumer index.  Only the producer writes these.  */
+    ULONG               tx_spsc_ring_head;
+    ULONG               tx_spsc_ring_tail_cache;
+    ULONG               tx_spsc_ring_reserved_2[(TX_SPSC_RING_CACHE_LINE_SIZE/(sizeof(ULONG))) - ((UINT) 2)];
+
+    /* Define the consumer index, the number of messages ever received, along with
+       the consumer's copy of the producer index.  Only the consumer writes these.  */
+    ULONG               tx_spsc_ring_tail;
+    ULONG               tx_spsc_ring_head_cache;
+    ULONG               tx_spsc_ring_reserved_3[(TX_SPSC_RING_CACHE_LINE_SIZE/(sizeof(ULONG))) - ((UINT) 2)];
+
+} TX_SPSC_RING;
+
+
+/* Define the wait set structure utilized by the application.  */
+
+typedef struct TX_WAIT_SET_STRUCT
+{
+
+    /* Define the wait set ID used for error checking.  */
+    ULONG               tx_wait_set_id;
+
+    /* Define the wait set's name.  */
+    CHAR                *tx_wait_set_name;
+
+    /* Define the list of queues, semaphores, and event flags groups that are
+       members of this wait set, along with a count of how many there are.  */
+    TX_WAIT_SET_MEMBER  *tx_wait_set_member_list;
+    UINT                tx_wait_set_member_count;
+
+    /* Define the wait set suspension list head along with a count of
+       how many threads are suspended.  */
+    struct TX_THREAD_STRUCT
+                        *tx_wait_set_suspension_list;
+    UINT                tx_wait_set_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_WAIT_SET_STRUCT
+                        *tx_wait_set_created_next,
+                        *tx_wait_set_created_previous;
+
+} TX_WAIT_SET;
+
+
 /************* Define ThreadX SMP function prototypes and remapping.  *************/
 
 /* Re-map user API to internal API for SMP routines.  */
@@ -1155,6 +1857,17 @@ void        _tx_thread_smp_debug_entry_insert(ULONG id, ULONG suspend, VOID *thr
 #define TX_SMP_CORE_ID                          _tx_thread_smp_core_get()
 
 
+/* Define the atomic compare and swap of a pointer, which evaluates to TX_TRUE if the pointer
+   held the expected value and was replaced. Ports with an atomic instruction can define this
+   in tx_port.h, otherwise the swap is performed under the SMP protection.  */
+
+UINT        _tx_thread_smp_pointer_compare_swap(UCHAR **destination, UCHAR *expected, UCHAR *new_value);
+
+#ifndef TX_SMP_POINTER_COMPARE_AND_SWAP
+#define TX_SMP_POINTER_COMPARE_AND_SWAP(a, e, n)    _tx_thread_smp_pointer_compare_swap((a), (e), (n))
+#endif
+
+
 /************* End of ThreadX SMP function prototypes and remapping.  *************/
 
 
@@ -1179,21 +1892,36 @@ void        _tx_thread_smp_debug_entry_insert(ULONG id, ULONG suspend, VOID *thr
 #define tx_kernel_enter                             _tx_initialize_kernel_enter
 
 #define tx_block_allocate                           _tx_block_allocate
+#define tx_block_allocate_bulk                      _tx_block_allocate_bulk
+#define tx_block_pool_core_cache_enable             _tx_block_pool_core_cache_enable
+#define tx_block_pool_core_cache_performance_info_get _tx_block_pool_core_cache_performance_info_get
 #define tx_block_pool_create                        _tx_block_pool_create
 #define tx_block_pool_delete                        _tx_block_pool_delete
 #define tx_block_pool_info_get                      _tx_block_pool_info_get
+#define tx_block_pool_lock_free_enable              _tx_block_pool_lock_free_enable
 #define tx_block_pool_performance_info_get          _tx_block_pool_performance_info_get
 #define tx_block_pool_performance_system_info_get   _tx_block_pool_performance_system_info_get
 #define tx_block_pool_prioritize                    _tx_block_pool_prioritize
 #define tx_block_release                            _tx_block_release
+#define tx_block_release_bulk                       _tx_block_release_bulk
 
 #define tx_byte_allocate                            _tx_byte_allocate
+#define tx_byte_allocate_aligned                    _tx_byte_allocate_aligned
 #define tx_byte_pool_create                         _tx_byte_pool_create
+#define tx_byte_pool_cache_enable                   _tx_byte_pool_cache_enable
+#define tx_byte_pool_cache_performance_info_get     _tx_byte_pool_cache_performance_info_get
+#define tx_byte_pool_search_performance_info_get    _tx_byte_pool_search_performance_info_get
+#define tx_byte_pool_reallocate_performance_info_get _tx_byte_pool_reallocate_performance_info_get
+#define tx_byte_pool_fragmentation_info_get         _tx_byte_pool_fragmentation_info_get
+#define tx_byte_pool_arena_enable                   _tx_byte_pool_arena_enable
+#define tx_byte_pool_arena_performance_info_get     _tx_byte_pool_arena_performance_info_get
+#define tx_byte_pool_create_ex                      _tx_byte_pool_create_ex
 #define tx_byte_pool_delete                         _tx_byte_pool_delete
 #define tx_byte_pool_info_get                       _tx_byte_pool_info_get
 #define tx_byte_pool_performance_info_get           _tx_byte_pool_performance_info_get
 #define tx_byte_pool_performance_system_info_get    _tx_byte_pool_performance_system_info_get
 #define tx_byte_pool_prioritize                     _tx_byte_pool_prioritize
+#define tx_byte_reallocate                          _tx_byte_reallocate
 #define tx_byte_release                             _tx_byte_release
 
 #define tx_event_flags_create                       _tx_event_flags_create
@@ -1216,7 +1944,18 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #endif
 #endif
 
+#define tx_message_buffer_create                    _tx_message_buffer_create
+#define tx_message_buffer_delete                    _tx_message_buffer_delete
+#define tx_message_buffer_flush                     _tx_message_buffer_flush
+#define tx_message_buffer_info_get                  _tx_message_buffer_info_get
+#define tx_message_buffer_performance_info_get      _tx_message_buffer_performance_info_get
+#define tx_message_buffer_performance_system_info_get _tx_message_buffer_performance_system_info_get
+#define tx_message_buffer_receive                   _tx_message_buffer_receive
+#define tx_message_buffer_send                      _tx_message_buffer_send
+#define tx_message_buffer_send_notify               _tx_message_buffer_send_notify
+
 #define tx_mutex_create                             _tx_mutex_create
+#define tx_mutex_ordered_create                     _tx_mutex_ordered_create
 #define tx_mutex_delete                             _tx_mutex_delete
 #define tx_mutex_get                                _tx_mutex_get
 #define tx_mutex_info_get                           _tx_mutex_info_get
@@ -1224,6 +1963,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_mutex_performance_system_info_get        _tx_mutex_performance_system_info_get
 #define tx_mutex_prioritize                         _tx_mutex_prioritize
 #define tx_mutex_put                                _tx_mutex_put
+#define tx_mutex_spin_enable                        _tx_mutex_spin_enable
+#define tx_mutex_spin_performance_info_get          _tx_mutex_spin_performance_info_get
 
 #define tx_queue_create                             _tx_queue_create
 #define tx_queue_delete                             _tx_queue_delete
@@ -1236,9 +1977,20 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_queue_send_notify                        _tx_queue_send_notify
 #define tx_queue_front_send                         _tx_queue_front_send
 #define tx_queue_prioritize                         _tx_queue_prioritize
+#define tx_queue_receive_acquire                    _tx_queue_receive_acquire
+#define tx_queue_receive_release                    _tx_queue_receive_release
+#define tx_queue_send_commit                        _tx_queue_send_commit
+#define tx_queue_send_reserve                       _tx_queue_send_reserve
+#define tx_queue_receive_multiple                   _tx_queue_receive_multiple
+#define tx_queue_send_multiple                      _tx_queue_send_multiple
+#define tx_queue_priority_create                    _tx_queue_priority_create
+#define tx_queue_priority_send                      _tx_queue_priority_send
+#define tx_queue_overwrite_send                     _tx_queue_overwrite_send
+#define tx_queue_overwrite_performance_info_get     _tx_queue_overwrite_performance_info_get
 
 #define tx_semaphore_ceiling_put                    _tx_semaphore_ceiling_put
 #define tx_semaphore_create                         _tx_semaphore_create
+#define tx_semaphore_ordered_create                 _tx_semaphore_ordered_create
 #define tx_semaphore_delete                         _tx_semaphore_delete
 #define tx_semaphore_get                            _tx_semaphore_get
 #define tx_semaphore_info_get                       _tx_semaphore_info_get
@@ -1247,6 +1999,20 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_semaphore_prioritize                     _tx_semaphore_prioritize
 #define tx_semaphore_put                            _tx_semaphore_put
 #define tx_semaphore_put_notify                     _tx_semaphore_put_notify
+#define tx_semaphore_put_count                      _tx_semaphore_put_count
+#define tx_semaphore_get_count                      _tx_semaphore_get_count
+
+#define tx_slab_allocate                            _tx_slab_allocate
+#define tx_slab_pool_class_info_get                 _tx_slab_pool_class_info_get
+#define tx_slab_pool_create                         _tx_slab_pool_create
+#define tx_slab_pool_delete                         _tx_slab_pool_delete
+#define tx_slab_pool_info_get                       _tx_slab_pool_info_get
+#define tx_slab_release                             _tx_slab_release
+
+#define tx_spsc_ring_create                         _tx_spsc_ring_create
+#define tx_spsc_ring_delete                         _tx_spsc_ring_delete
+#define tx_spsc_ring_receive                        _tx_spsc_ring_receive
+#define tx_spsc_ring_send                           _tx_spsc_ring_send
 
 #define tx_thread_create                            _tx_thread_create
 #define tx_thread_delete                            _tx_thread_delete
@@ -1266,6 +2032,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_thread_terminate                         _tx_thread_terminate
 #define tx_thread_time_slice_change                 _tx_thread_time_slice_change
 #define tx_thread_wait_abort                        _tx_thread_wait_abort
+#define tx_thread_notify                            _tx_thread_notify
+#define tx_thread_notify_wait                       _tx_thread_notify_wait
 
 /************* Define ThreadX SMP remapping of tx_time_get.  *************/
 #ifndef TX_MISRA_ENABLE
@@ -1293,6 +2061,14 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_trace_buffer_full_notify                 _tx_trace_buffer_full_notify
 #define tx_trace_user_event_insert                  _tx_trace_user_event_insert
 
+#define tx_wait_set_create                          _tx_wait_set_create
+#define tx_wait_set_delete                          _tx_wait_set_delete
+#define tx_wait_set_event_flags_add                 _tx_wait_set_event_flags_add
+#define tx_wait_set_queue_add                       _tx_wait_set_queue_add
+#define tx_wait_set_remove                          _tx_wait_set_remove
+#define tx_wait_set_semaphore_add                   _tx_wait_set_semaphore_add
+#define tx_wait_set_wait                            _tx_wait_set_wait
+
 #else
 
 /* Services with error checking.  */
@@ -1307,21 +2083,36 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 /* Services with MULTI runtime error checking ThreadX.  */
 
 #define tx_block_allocate                           _txr_block_allocate
+#define tx_block_allocate_bulk                      _txe_block_allocate_bulk
+#define tx_block_pool_core_cache_enable             _txe_block_pool_core_cache_enable
+#define tx_block_pool_core_cache_performance_info_get _tx_block_pool_core_cache_performance_info_get
 #define tx_block_pool_create(p,n,b,s,l)             _txr_block_pool_create((p),(n),(b),(s),(l),(sizeof(TX_BLOCK_POOL)))
 #define tx_block_pool_delete                        _txr_block_pool_delete
 #define tx_block_pool_info_get                      _txr_block_pool_info_get
+#define tx_block_pool_lock_free_enable              _txe_block_pool_lock_free_enable
 #define tx_block_pool_performance_info_get          _tx_block_pool_performance_info_get
 #define tx_block_pool_performance_system_info_get   _tx_block_pool_performance_system_info_get
 #define tx_block_pool_prioritize                    _txr_block_pool_prioritize
 #define tx_block_release                            _txr_block_release
+#define tx_block_release_bulk                       _txe_block_release_bulk
 
 #define tx_byte_allocate                            _txr_byte_allocate
+#define tx_byte_allocate_aligned                    _txe_byte_allocate_aligned
 #define tx_byte_pool_create(p,n,s,l)                _txr_byte_pool_create((p),(n),(s),(l),(sizeof(TX_BYTE_POOL)))
+#define tx_byte_pool_cache_enable                   _txe_byte_pool_cache_enable
+#define tx_byte_pool_cache_performance_info_get     _tx_byte_pool_cache_performance_info_get
+#define tx_byte_pool_search_performance_info_get    _tx_byte_pool_search_performance_info_get
+#define tx_byte_pool_reallocate_performance_info_get _tx_byte_pool_reallocate_performance_info_get
+#define tx_byte_pool_fragmentation_info_get         _tx_byte_pool_fragmentation_info_get
+#define tx_byte_pool_arena_enable                   _txe_byte_pool_arena_enable
+#define tx_byte_pool_arena_performance_info_get     _tx_byte_pool_arena_performance_info_get
+#define tx_byte_pool_create_ex(p,n,s,l,a)           _txe_byte_pool_create_ex((p),(n),(s),(l),(a),(sizeof(TX_BYTE_POOL)))
 #define tx_byte_pool_delete                         _txr_byte_pool_delete
 #define tx_byte_pool_info_get                       _txr_byte_pool_info_get
 #define tx_byte_pool_performance_info_get           _tx_byte_pool_performance_info_get
 #define tx_byte_pool_performance_system_info_get    _tx_byte_pool_performance_system_info_get
 #define tx_byte_pool_prioritize                     _txr_byte_pool_prioritize
+#define tx_byte_reallocate                          _txe_byte_reallocate
 #define tx_byte_release                             _txr_byte_release
 
 #define tx_event_flags_create(g,n)                  _txr_event_flags_create((g),(n),(sizeof(TX_EVENT_FLAGS_GROUP)))
@@ -1344,7 +2135,18 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #endif
 #endif
 
+#define tx_message_buffer_create(b,n,s,l)           _txe_message_buffer_create((b),(n),(s),(l),(sizeof(TX_MESSAGE_BUFFER)))
+#define tx_message_buffer_delete                    _txe_message_buffer_delete
+#define tx_message_buffer_flush                     _txe_message_buffer_flush
+#define tx_message_buffer_info_get                  _txe_message_buffer_info_get
+#define tx_message_buffer_performance_info_get      _tx_message_buffer_performance_info_get
+#define tx_message_buffer_performance_system_info_get _tx_message_buffer_performance_system_info_get
+#define tx_message_buffer_receive                   _txe_message_buffer_receive
+#define tx_message_buffer_send                      _txe_message_buffer_send
+#define tx_message_buffer_send_notify               _txe_message_buffer_send_notify
+
 #define tx_mutex_create(m,n,i)                      _txr_mutex_create((m),(n),(i),(sizeof(TX_MUTEX)))
+#define tx_mutex_ordered_create(m,n,i)              _txe_mutex_ordered_create((m),(n),(i),(sizeof(TX_MUTEX)))
 #define tx_mutex_delete                             _txr_mutex_delete
 #define tx_mutex_get                                _txr_mutex_get
 #define tx_mutex_info_get                           _txr_mutex_info_get
@@ -1352,6 +2154,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_mutex_performance_system_info_get        _tx_mutex_performance_system_info_get
 #define tx_mutex_prioritize                         _txr_mutex_prioritize
 #define tx_mutex_put                                _txr_mutex_put
+#define tx_mutex_spin_enable                        _txe_mutex_spin_enable
+#define tx_mutex_spin_performance_info_get          _tx_mutex_spin_performance_info_get
 
 #define tx_queue_create(q,n,m,s,l)                  _txr_queue_create((q),(n),(m),(s),(l),(sizeof(TX_QUEUE)))
 #define tx_queue_delete                             _txr_queue_delete
@@ -1364,9 +2168,20 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_queue_send_notify                        _txr_queue_send_notify
 #define tx_queue_front_send                         _txr_queue_front_send
 #define tx_queue_prioritize                         _txr_queue_prioritize
+#define tx_queue_receive_acquire                    _txe_queue_receive_acquire
+#define tx_queue_receive_release                    _txe_queue_receive_release
+#define tx_queue_send_commit                        _txe_queue_send_commit
+#define tx_queue_send_reserve                       _txe_queue_send_reserve
+#define tx_queue_receive_multiple                   _txe_queue_receive_multiple
+#define tx_queue_send_multiple                      _txe_queue_send_multiple
+#define tx_queue_priority_create(q,n,m,s,l,p)       _txe_queue_priority_create((q),(n),(m),(s),(l),(p),(sizeof(TX_QUEUE)))
+#define tx_queue_priority_send                      _txe_queue_priority_send
+#define tx_queue_overwrite_send                     _txe_queue_overwrite_send
+#define tx_queue_overwrite_performance_info_get     _tx_queue_overwrite_performance_info_get
 
 #define tx_semaphore_ceiling_put                    _txr_semaphore_ceiling_put
 #define tx_semaphore_create(s,n,i)                  _txr_semaphore_create((s),(n),(i),(sizeof(TX_SEMAPHORE)))
+#define tx_semaphore_ordered_create(s,n,i)          _txe_semaphore_ordered_create((s),(n),(i),(sizeof(TX_SEMAPHORE)))
 #define tx_semaphore_delete                         _txr_semaphore_delete
 #define tx_semaphore_get                            _txr_semaphore_get
 #define tx_semaphore_info_get                       _txr_semaphore_info_get
@@ -1375,6 +2190,20 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_semaphore_prioritize                     _txr_semaphore_prioritize
 #define tx_semaphore_put                            _txr_semaphore_put
 #define tx_semaphore_put_notify                     _txr_semaphore_put_notify
+#define tx_semaphore_put_count                      _txe_semaphore_put_count
+#define tx_semaphore_get_count                      _txe_semaphore_get_count
+
+#define tx_slab_allocate                            _txe_slab_allocate
+#define tx_slab_pool_class_info_get                 _txe_slab_pool_class_info_get
+#define tx_slab_pool_create(p,n,c,k,g,s,l,o)        _txe_slab_pool_create((p),(n),(c),(k),(g),(s),(l),(o),(sizeof(TX_SLAB_POOL)))
+#define tx_slab_pool_delete                         _txe_slab_pool_delete
+#define tx_slab_pool_info_get                       _txe_slab_pool_info_get
+#define tx_slab_release                             _txe_slab_release
+
+#define tx_spsc_ring_create(r,n,m,s,l)              _txe_spsc_ring_create((r),(n),(m),(s),(l),(sizeof(TX_SPSC_RING)))
+#define tx_spsc_ring_delete                         _txe_spsc_ring_delete
+#define tx_spsc_ring_receive                        _txe_spsc_ring_receive
+#define tx_spsc_ring_send                           _txe_spsc_ring_send
 
 #define tx_thread_create(t,n,e,i,s,l,p,r,c,a)       _txr_thread_create((t),(n),(e),(i),(s),(l),(p),(r),(c),(a),(sizeof(TX_THREAD)))
 #define tx_thread_delete                            _txr_thread_delete
@@ -1394,6 +2223,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_thread_terminate                         _txr_thread_terminate
 #define tx_thread_time_slice_change                 _txr_thread_time_slice_change
 #define tx_thread_wait_abort                        _txr_thread_wait_abort
+#define tx_thread_notify                            _txe_thread_notify
+#define tx_thread_notify_wait                       _txe_thread_notify_wait
 
 /************* Define ThreadX SMP remapping of tx_time_get.  *************/
 #ifndef TX_MISRA_ENABLE
@@ -1421,24 +2252,47 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_trace_buffer_full_notify                 _tx_trace_buffer_full_notify
 #define tx_trace_user_event_insert                  _tx_trace_user_event_insert
 
+#define tx_wait_set_create(w,n)                     _txe_wait_set_create((w),(n),(sizeof(TX_WAIT_SET)))
+#define tx_wait_set_delete                          _txe_wait_set_delete
+#define tx_wait_set_event_flags_add                 _txe_wait_set_event_flags_add
+#define tx_wait_set_queue_add                       _txe_wait_set_queue_add
+#define tx_wait_set_remove                          _txe_wait_set_remove
+#define tx_wait_set_semaphore_add                   _txe_wait_set_semaphore_add
+#define tx_wait_set_wait                            _txe_wait_set_wait
+
 #else
 
 #define tx_block_allocate                           _txe_block_allocate
+#define tx_block_allocate_bulk                      _txe_block_allocate_bulk
+#define tx_block_pool_core_cache_enable             _txe_block_pool_core_cache_enable
+#define tx_block_pool_core_cache_performance_info_get _tx_block_pool_core_cache_performance_info_get
 #define tx_block_pool_create(p,n,b,s,l)             _txe_block_pool_create((p),(n),(b),(s),(l),(sizeof(TX_BLOCK_POOL)))
 #define tx_block_pool_delete                        _txe_block_pool_delete
 #define tx_block_pool_info_get                      _txe_block_pool_info_get
+#define tx_block_pool_lock_free_enable              _txe_block_pool_lock_free_enable
 #define tx_block_pool_performance_info_get          _tx_block_pool_performance_info_get
 #define tx_block_pool_performance_system_info_get   _tx_block_pool_performance_system_info_get
 #define tx_block_pool_prioritize                    _txe_block_pool_prioritize
 #define tx_block_release                            _txe_block_release
+#define tx_block_release_bulk                       _txe_block_release_bulk
 
 #define tx_byte_allocate                            _txe_byte_allocate
+#define tx_byte_allocate_aligned                    _txe_byte_allocate_aligned
 #define tx_byte_pool_create(p,n,s,l)                _txe_byte_pool_create((p),(n),(s),(l),(sizeof(TX_BYTE_POOL)))
+#define tx_byte_pool_cache_enable                   _txe_byte_pool_cache_enable
+#define tx_byte_pool_cache_performance_info_get     _tx_byte_pool_cache_performance_info_get
+#define tx_byte_pool_search_performance_info_get    _tx_byte_pool_search_performance_info_get
+#define tx_byte_pool_reallocate_performance_info_get _tx_byte_pool_reallocate_performance_info_get
+#define tx_byte_pool_fragmentation_info_get         _tx_byte_pool_fragmentation_info_get
+#define tx_byte_pool_arena_enable                   _txe_byte_pool_arena_enable
+#define tx_byte_pool_arena_performance_info_get     _tx_byte_pool_arena_performance_info_get
+#define tx_byte_pool_create_ex(p,n,s,l,a)           _txe_byte_pool_create_ex((p),(n),(s),(l),(a),(sizeof(TX_BYTE_POOL)))
 #define tx_byte_pool_delete                         _txe_byte_pool_delete
 #define tx_byte_pool_info_get                       _txe_byte_pool_info_get
 #define tx_byte_pool_performance_info_get           _tx_byte_pool_performance_info_get
 #define tx_byte_pool_performance_system_info_get    _tx_byte_pool_performance_system_info_get
 #define tx_byte_pool_prioritize                     _txe_byte_pool_prioritize
+#define tx_byte_reallocate                          _txe_byte_reallocate
 #define tx_byte_release                             _txe_byte_release
 
 #define tx_event_flags_create(g,n)                  _txe_event_flags_create((g),(n),(sizeof(TX_EVENT_FLAGS_GROUP)))
@@ -1461,7 +2315,18 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #endif
 #endif
 
+#define tx_message_buffer_create(b,n,s,l)           _txe_message_buffer_create((b),(n),(s),(l),(sizeof(TX_MESSAGE_BUFFER)))
+#define tx_message_buffer_delete                    _txe_message_buffer_delete
+#define tx_message_buffer_flush                     _txe_message_buffer_flush
+#define tx_message_buffer_info_get                  _txe_message_buffer_info_get
+#define tx_message_buffer_performance_info_get      _tx_message_buffer_performance_info_get
+#define tx_message_buffer_performance_system_info_get _tx_message_buffer_performance_system_info_get
+#define tx_message_buffer_receive                   _txe_message_buffer_receive
+#define tx_message_buffer_send                      _txe_message_buffer_send
+#define tx_message_buffer_send_notify               _txe_message_buffer_send_notify
+
 #define tx_mutex_create(m,n,i)                      _txe_mutex_create((m),(n),(i),(sizeof(TX_MUTEX)))
+#define tx_mutex_ordered_create(m,n,i)              _txe_mutex_ordered_create((m),(n),(i),(sizeof(TX_MUTEX)))
 #define tx_mutex_delete                             _txe_mutex_delete
 #define tx_mutex_get                                _txe_mutex_get
 #define tx_mutex_info_get                           _txe_mutex_info_get
@@ -1469,6 +2334,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_mutex_performance_system_info_get        _tx_mutex_performance_system_info_get
 #define tx_mutex_prioritize                         _txe_mutex_prioritize
 #define tx_mutex_put                                _txe_mutex_put
+#define tx_mutex_spin_enable                        _txe_mutex_spin_enable
+#define tx_mutex_spin_performance_info_get          _tx_mutex_spin_performance_info_get
 
 #define tx_queue_create(q,n,m,s,l)                  _txe_queue_create((q),(n),(m),(s),(l),(sizeof(TX_QUEUE)))
 #define tx_queue_delete                             _txe_queue_delete
@@ -1481,9 +2348,20 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_queue_send_notify                        _txe_queue_send_notify
 #define tx_queue_front_send                         _txe_queue_front_send
 #define tx_queue_prioritize                         _txe_queue_prioritize
+#define tx_queue_receive_acquire                    _txe_queue_receive_acquire
+#define tx_queue_receive_release                    _txe_queue_receive_release
+#define tx_queue_send_commit                        _txe_queue_send_commit
+#define tx_queue_send_reserve                       _txe_queue_send_reserve
+#define tx_queue_receive_multiple                   _txe_queue_receive_multiple
+#define tx_queue_send_multiple                      _txe_queue_send_multiple
+#define tx_queue_priority_create(q,n,m,s,l,p)       _txe_queue_priority_create((q),(n),(m),(s),(l),(p),(sizeof(TX_QUEUE)))
+#define tx_queue_priority_send                      _txe_queue_priority_send
+#define tx_queue_overwrite_send                     _txe_queue_overwrite_send
+#define tx_queue_overwrite_performance_info_get     _tx_queue_overwrite_performance_info_get
 
 #define tx_semaphore_ceiling_put                    _txe_semaphore_ceiling_put
 #define tx_semaphore_create(s,n,i)                  _txe_semaphore_create((s),(n),(i),(sizeof(TX_SEMAPHORE)))
+#define tx_semaphore_ordered_create(s,n,i)          _txe_semaphore_ordered_create((s),(n),(i),(sizeof(TX_SEMAPHORE)))
 #define tx_semaphore_delete                         _txe_semaphore_delete
 #define tx_semaphore_get                            _txe_semaphore_get
 #define tx_semaphore_info_get                       _txe_semaphore_info_get
@@ -1492,6 +2370,20 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_semaphore_prioritize                     _txe_semaphore_prioritize
 #define tx_semaphore_put                            _txe_semaphore_put
 #define tx_semaphore_put_notify                     _txe_semaphore_put_notify
+#define tx_semaphore_put_count                      _txe_semaphore_put_count
+#define tx_semaphore_get_count                      _txe_semaphore_get_count
+
+#define tx_slab_allocate                            _txe_slab_allocate
+#define tx_slab_pool_class_info_get                 _txe_slab_pool_class_info_get
+#define tx_slab_pool_create(p,n,c,k,g,s,l,o)        _txe_slab_pool_create((p),(n),(c),(k),(g),(s),(l),(o),(sizeof(TX_SLAB_POOL)))
+#define tx_slab_pool_delete                         _txe_slab_pool_delete
+#define tx_slab_pool_info_get                       _txe_slab_pool_info_get
+#define tx_slab_release                             _txe_slab_release
+
+#define tx_spsc_ring_create(r,n,m,s,l)              _txe_spsc_ring_create((r),(n),(m),(s),(l),(sizeof(TX_SPSC_RING)))
+#define tx_spsc_ring_delete                         _txe_spsc_ring_delete
+#define tx_spsc_ring_receive                        _txe_spsc_ring_receive
+#define tx_spsc_ring_send                           _txe_spsc_ring_send
 
 #define tx_thread_create(t,n,e,i,s,l,p,r,c,a)       _txe_thread_create((t),(n),(e),(i),(s),(l),(p),(r),(c),(a),(sizeof(TX_THREAD)))
 #define tx_thread_delete                            _txe_thread_delete
@@ -1511,6 +2403,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_thread_terminate                         _txe_thread_terminate
 #define tx_thread_time_slice_change                 _txe_thread_time_slice_change
 #define tx_thread_wait_abort                        _txe_thread_wait_abort
+#define tx_thread_notify                            _txe_thread_notify
+#define tx_thread_notify_wait                       _txe_thread_notify_wait
 
 /************* Define ThreadX SMP remapping of tx_time_get.  *************/
 #ifndef TX_MISRA_ENABLE
@@ -1538,6 +2432,14 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_trace_buffer_full_notify                 _tx_trace_buffer_full_notify
 #define tx_trace_user_event_insert                  _tx_trace_user_event_insert
 
+#define tx_wait_set_create(w,n)                     _txe_wait_set_create((w),(n),(sizeof(TX_WAIT_SET)))
+#define tx_wait_set_delete                          _txe_wait_set_delete
+#define tx_wait_set_event_flags_add                 _txe_wait_set_event_flags_add
+#define tx_wait_set_queue_add                       _txe_wait_set_queue_add
+#define tx_wait_set_remove                          _txe_wait_set_remove
+#define tx_wait_set_semaphore_add                   _txe_wait_set_semaphore_add
+#define tx_wait_set_wait                            _txe_wait_set_wait
+
 #endif
 #endif
 
@@ -1555,40 +2457,57 @@ VOID        tx_application_define(VOID *first_unused_memory);
 /* Define block memory pool management function prototypes.  */
 
 UINT        _tx_block_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option);
+UINT        _tx_block_allocate_bulk(TX_BLOCK_POOL *pool_ptr, VOID **block_ptrs, UINT count, ULONG wait_option);
+UINT        _tx_block_pool_core_cache_enable(TX_BLOCK_POOL *pool_ptr, UINT depth);
+UINT        _tx_block_pool_core_cache_performance_info_get(TX_BLOCK_POOL *pool_ptr, ULONG *hits, ULONG *refills,
+                    ULONG *drains);
 UINT        _tx_block_pool_create(TX_BLOCK_POOL *pool_ptr, CHAR *name_ptr, ULONG block_size,
                     VOID *pool_start, ULONG pool_size);
 UINT        _tx_block_pool_delete(TX_BLOCK_POOL *pool_ptr);
 UINT        _tx_block_pool_info_get(TX_BLOCK_POOL *pool_ptr, CHAR **name, ULONG *available_blocks,
                     ULONG *total_blocks, TX_THREAD **first_suspended,
                     ULONG *suspended_count, TX_BLOCK_POOL **next_pool);
+UINT        _tx_block_pool_lock_free_enable(TX_BLOCK_POOL *pool_ptr);
 UINT        _tx_block_pool_performance_info_get(TX_BLOCK_POOL *pool_ptr, ULONG *allocates, ULONG *releases,
                     ULONG *suspensions, ULONG *timeouts);
 UINT        _tx_block_pool_performance_system_info_get(ULONG *allocates, ULONG *releases,
                     ULONG *suspensions, ULONG *timeouts);
 UINT        _tx_block_pool_prioritize(TX_BLOCK_POOL *pool_ptr);
 UINT        _tx_block_release(VOID *block_ptr);
+UINT        _tx_block_release_bulk(VOID **block_ptrs, UINT count);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
    application.  */
 
 UINT        _txe_block_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option);
+UINT        _txe_block_allocate_bulk(TX_BLOCK_POOL *pool_ptr, VOID **block_ptrs, UINT count, ULONG wait_option);
+UINT        _txe_block_pool_core_cache_enable(TX_BLOCK_POOL *pool_ptr, UINT depth);
 UINT        _txe_block_pool_create(TX_BLOCK_POOL *pool_ptr, CHAR *name_ptr, ULONG block_size,
                     VOID *pool_start, ULONG pool_size, UINT pool_control_block_size);
 UINT        _txe_block_pool_delete(TX_BLOCK_POOL *pool_ptr);
 UINT        _txe_block_pool_info_get(TX_BLOCK_POOL *pool_ptr, CHAR **name, ULONG *available_blocks,
                     ULONG *total_blocks, TX_THREAD **first_suspended,
                     ULONG *suspended_count, TX_BLOCK_POOL **next_pool);
+UINT        _txe_block_pool_lock_free_enable(TX_BLOCK_POOL *pool_ptr);
 UINT        _txe_block_pool_prioritize(TX_BLOCK_POOL *pool_ptr);
 UINT        _txe_block_release(VOID *block_ptr);
+UINT        _txe_block_release_bulk(VOID **block_ptrs, UINT count);
 
 
 /* Define byte memory pool management function prototypes.  */
 
 UINT        _tx_byte_allocate(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
                     ULONG wait_option);
+UINT        _tx_byte_allocate_aligned(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
+                    ULONG alignment, ULONG wait_option);
 UINT        _tx_byte_pool_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
                     ULONG pool_size);
+UINT        _tx_byte_pool_cache_enable(TX_BYTE_POOL *pool_ptr, UINT blocks_per_class);
+UINT        _tx_byte_pool_cache_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *hits, ULONG *misses,
+                    ULONG *cached_blocks);
+UINT        _tx_byte_pool_create_ex(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
+                    ULONG pool_size, UINT policy);
 UINT        _tx_byte_pool_delete(TX_BYTE_POOL *pool_ptr);
 UINT        _tx_byte_pool_info_get(TX_BYTE_POOL *pool_ptr, CHAR **name, ULONG *available_bytes,
                     ULONG *fragments, TX_THREAD **first_suspended,
@@ -1598,6 +2517,14 @@ UINT        _tx_byte_pool_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *al
 UINT        _tx_byte_pool_performance_system_info_get(ULONG *allocates, ULONG *releases,
                     ULONG *fragments_searched, ULONG *merges, ULONG *splits, ULONG *suspensions, ULONG *timeouts);
 UINT        _tx_byte_pool_prioritize(TX_BYTE_POOL *pool_ptr);
+UINT        _tx_byte_pool_search_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *restarts, ULONG *max_blocks_examined);
+UINT        _tx_byte_pool_reallocate_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *in_place, ULONG *moved);
+UINT        _tx_byte_pool_fragmentation_info_get(TX_BYTE_POOL *pool_ptr, ULONG *largest_free_block,
+                    UINT *fragmentation_index, ULONG *free_block_histogram);
+UINT        _tx_byte_pool_arena_enable(TX_BYTE_POOL *pool_ptr, UINT blocks_per_class);
+UINT        _tx_byte_pool_arena_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *hits, ULONG *refills,
+                    ULONG *steals, ULONG *remote_releases);
+UINT        _tx_byte_reallocate(VOID **memory_ptr, ULONG memory_size, ULONG wait_option);
 UINT        _tx_byte_release(VOID *memory_ptr);
 
 
@@ -1606,13 +2533,20 @@ UINT        _tx_byte_release(VOID *memory_ptr);
 
 UINT        _txe_byte_allocate(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
                     ULONG wait_option);
+UINT        _txe_byte_allocate_aligned(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
+                    ULONG alignment, ULONG wait_option);
 UINT        _txe_byte_pool_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
                     ULONG pool_size, UINT pool_control_block_size);
+UINT        _txe_byte_pool_cache_enable(TX_BYTE_POOL *pool_ptr, UINT blocks_per_class);
+UINT        _txe_byte_pool_arena_enable(TX_BYTE_POOL *pool_ptr, UINT blocks_per_class);
+UINT        _txe_byte_pool_create_ex(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
+                    ULONG pool_size, UINT policy, UINT pool_control_block_size);
 UINT        _txe_byte_pool_delete(TX_BYTE_POOL *pool_ptr);
 UINT        _txe_byte_pool_info_get(TX_BYTE_POOL *pool_ptr, CHAR **name, ULONG *available_bytes,
                     ULONG *fragments, TX_THREAD **first_suspended,
                     ULONG *suspended_count, TX_BYTE_POOL **next_pool);
 UINT        _txe_byte_pool_prioritize(TX_BYTE_POOL *pool_ptr);
+UINT        _txe_byte_reallocate(VOID **memory_ptr, ULONG memory_size, ULONG wait_option);
 UINT        _txe_byte_release(VOID *memory_ptr);
 
 
@@ -1654,9 +2588,50 @@ UINT        _txe_event_flags_set_notify(TX_EVENT_FLAGS_GROUP *group_ptr, VOID (*
 VOID        _tx_initialize_kernel_enter(VOID);
 
 
+/* Define message buffer management function prototypes.  */
+
+UINT        _tx_message_buffer_create(TX_MESSAGE_BUFFER *message_buffer_ptr, CHAR *name_ptr,
+                    VOID *message_buffer_start, ULONG message_buffer_size);
+UINT        _tx_message_buffer_delete(TX_MESSAGE_BUFFER *message_buffer_ptr);
+UINT        _tx_message_buffer_flush(TX_MESSAGE_BUFFER *message_buffer_ptr);
+UINT        _tx_message_buffer_info_get(TX_MESSAGE_BUFFER *message_buffer_ptr, CHAR **name, ULONG *enqueued,
+                    ULONG *available_bytes, TX_THREAD **first_suspended, ULONG *suspended_count,
+                    TX_MESSAGE_BUFFER **next_message_buffer);
+UINT        _tx_message_buffer_performance_info_get(TX_MESSAGE_BUFFER *message_buffer_ptr, ULONG *messages_sent,
+                    ULONG *messages_received, ULONG *empty_suspensions, ULONG *full_suspensions,
+                    ULONG *full_errors, ULONG *timeouts);
+UINT        _tx_message_buffer_performance_system_info_get(ULONG *messages_sent, ULONG *messages_received,
+                    ULONG *empty_suspensions, ULONG *full_suspensions, ULONG *full_errors, ULONG *timeouts);
+UINT        _tx_message_buffer_receive(TX_MESSAGE_BUFFER *message_buffer_ptr, VOID *destination_ptr,
+                    ULONG destination_size, ULONG *actual_size, ULONG wait_option);
+UINT        _tx_message_buffer_send(TX_MESSAGE_BUFFER *message_buffer_ptr, VOID *source_ptr, ULONG size,
+                    ULONG wait_option);
+UINT        _tx_message_buffer_send_notify(TX_MESSAGE_BUFFER *message_buffer_ptr,
+                    VOID (*message_buffer_send_notify)(TX_MESSAGE_BUFFER *notify_message_buffer_ptr));
+
+
+/* Define error checking shells for API services.  These are only referenced by the
+   application.  */
+
+UINT        _txe_message_buffer_create(TX_MESSAGE_BUFFER *message_buffer_ptr, CHAR *name_ptr,
+                    VOID *message_buffer_start, ULONG message_buffer_size, UINT message_buffer_control_block_size);
+UINT        _txe_message_buffer_delete(TX_MESSAGE_BUFFER *message_buffer_ptr);
+UINT        _txe_message_buffer_flush(TX_MESSAGE_BUFFER *message_buffer_ptr);
+UINT        _txe_message_buffer_info_get(TX_MESSAGE_BUFFER *message_buffer_ptr, CHAR **name, ULONG *enqueued,
+                    ULONG *available_bytes, TX_THREAD **first_suspended, ULONG *suspended_count,
+                    TX_MESSAGE_BUFFER **next_message_buffer);
+UINT        _txe_message_buffer_receive(TX_MESSAGE_BUFFER *message_buffer_ptr, VOID *destination_ptr,
+                    ULONG destination_size, ULONG *actual_size, ULONG wait_option);
+UINT        _txe_message_buffer_send(TX_MESSAGE_BUFFER *message_buffer_ptr, VOID *source_ptr, ULONG size,
+                    ULONG wait_option);
+UINT        _txe_message_buffer_send_notify(TX_MESSAGE_BUFFER *message_buffer_ptr,
+                    VOID (*message_buffer_send_notify)(TX_MESSAGE_BUFFER *notify_message_buffer_ptr));
+
+
 /* Define mutex management function prototypes.  */
 
 UINT        _tx_mutex_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit);
+UINT        _tx_mutex_ordered_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit);
 UINT        _tx_mutex_delete(TX_MUTEX *mutex_ptr);
 UINT        _tx_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option);
 UINT        _tx_mutex_info_get(TX_MUTEX *mutex_ptr, CHAR **name, ULONG *count, TX_THREAD **owner,
@@ -1668,12 +2643,15 @@ UINT        _tx_mutex_performance_system_info_get(ULONG *puts, ULONG *gets, ULON
                     ULONG *inversions, ULONG *inheritances);
 UINT        _tx_mutex_prioritize(TX_MUTEX *mutex_ptr);
 UINT        _tx_mutex_put(TX_MUTEX *mutex_ptr);
+UINT        _tx_mutex_spin_enable(TX_MUTEX *mutex_ptr, ULONG spin_limit);
+UINT        _tx_mutex_spin_performance_info_get(TX_MUTEX *mutex_ptr, ULONG *spin_successes, ULONG *spin_failures);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
    application.  */
 
 UINT        _txe_mutex_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit, UINT mutex_control_block_size);
+UINT        _txe_mutex_ordered_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit, UINT mutex_control_block_size);
 UINT        _txe_mutex_delete(TX_MUTEX *mutex_ptr);
 UINT        _txe_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option);
 UINT        _txe_mutex_info_get(TX_MUTEX *mutex_ptr, CHAR **name, ULONG *count, TX_THREAD **owner,
@@ -1681,6 +2659,7 @@ UINT        _txe_mutex_info_get(TX_MUTEX *mutex_ptr, CHAR **name, ULONG *count,
                     TX_MUTEX **next_mutex);
 UINT        _txe_mutex_prioritize(TX_MUTEX *mutex_ptr);
 UINT        _txe_mutex_put(TX_MUTEX *mutex_ptr);
+UINT        _txe_mutex_spin_enable(TX_MUTEX *mutex_ptr, ULONG spin_limit);
 
 
 /* Define queue management function prototypes.  */
@@ -1700,6 +2679,19 @@ UINT        _tx_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG
 UINT        _tx_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
 UINT        _tx_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
 UINT        _tx_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _tx_queue_receive_acquire(TX_QUEUE *queue_ptr, VOID **message_ptr, ULONG wait_option);
+UINT        _tx_queue_receive_release(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _tx_queue_send_commit(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _tx_queue_send_reserve(TX_QUEUE *queue_ptr, VOID **message_ptr, ULONG wait_option);
+UINT        _tx_queue_receive_multiple(TX_QUEUE *queue_ptr, VOID *destination_ptr, UINT count, UINT *actual_count,
+                    ULONG wait_option);
+UINT        _tx_queue_send_multiple(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT count, UINT *actual_count,
+                    ULONG wait_option);
+UINT        _tx_queue_priority_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *queue_start, ULONG queue_size, UINT priorities);
+UINT        _tx_queue_priority_send(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT priority, ULONG wait_option);
+UINT        _tx_queue_overwrite_send(TX_QUEUE *queue_ptr, VOID *source_ptr);
+UINT        _tx_queue_overwrite_performance_info_get(TX_QUEUE *queue_ptr, ULONG *overwrites);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
@@ -1716,12 +2708,25 @@ UINT        _txe_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG
 UINT        _txe_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
 UINT        _txe_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
 UINT        _txe_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _txe_queue_receive_acquire(TX_QUEUE *queue_ptr, VOID **message_ptr, ULONG wait_option);
+UINT        _txe_queue_receive_release(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _txe_queue_send_commit(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _txe_queue_send_reserve(TX_QUEUE *queue_ptr, VOID **message_ptr, ULONG wait_option);
+UINT        _txe_queue_receive_multiple(TX_QUEUE *queue_ptr, VOID *destination_ptr, UINT count, UINT *actual_count,
+                    ULONG wait_option);
+UINT        _txe_queue_send_multiple(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT count, UINT *actual_count,
+                    ULONG wait_option);
+UINT        _txe_queue_priority_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *queue_start, ULONG queue_size, UINT priorities, UINT queue_control_block_size);
+UINT        _txe_queue_priority_send(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT priority, ULONG wait_option);
+UINT        _txe_queue_overwrite_send(TX_QUEUE *queue_ptr, VOID *source_ptr);
 
 
 /* Define semaphore management function prototypes.  */
 
 UINT        _tx_semaphore_ceiling_put(TX_SEMAPHORE *semaphore_ptr, ULONG ceiling);
 UINT        _tx_semaphore_create(TX_SEMAPHORE *semaphore_ptr, CHAR *name_ptr, ULONG initial_count);
+UINT        _tx_semaphore_ordered_create(TX_SEMAPHORE *semaphore_ptr, CHAR *name_ptr, ULONG initial_count);
 UINT        _tx_semaphore_delete(TX_SEMAPHORE *semaphore_ptr);
 UINT        _tx_semaphore_get(TX_SEMAPHORE *semaphore_ptr, ULONG wait_option);
 UINT        _tx_semaphore_info_get(TX_SEMAPHORE *semaphore_ptr, CHAR **name, ULONG *current_value,
@@ -1733,6 +2738,8 @@ UINT        _tx_semaphore_performance_system_info_get(ULONG *puts, ULONG *gets,
 UINT        _tx_semaphore_prioritize(TX_SEMAPHORE *semaphore_ptr);
 UINT        _tx_semaphore_put(TX_SEMAPHORE *semaphore_ptr);
 UINT        _tx_semaphore_put_notify(TX_SEMAPHORE *semaphore_ptr, VOID (*semaphore_put_notify)(TX_SEMAPHORE *notify_semaphore_ptr));
+UINT        _tx_semaphore_put_count(TX_SEMAPHORE *semaphore_ptr, ULONG count);
+UINT        _tx_semaphore_get_count(TX_SEMAPHORE *semaphore_ptr, ULONG count, ULONG wait_option);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
@@ -1740,6 +2747,7 @@ UINT        _tx_semaphore_put_notify(TX_SEMAPHORE *semaphore_ptr, VOID (*semapho
 
 UINT        _txe_semaphore_ceiling_put(TX_SEMAPHORE *semaphore_ptr, ULONG ceiling);
 UINT        _txe_semaphore_create(TX_SEMAPHORE *semaphore_ptr, CHAR *name_ptr, ULONG initial_count, UINT semaphore_control_block_size);
+UINT        _txe_semaphore_ordered_create(TX_SEMAPHORE *semaphore_ptr, CHAR *name_ptr, ULONG initial_count, UINT semaphore_control_block_size);
 UINT        _txe_semaphore_delete(TX_SEMAPHORE *semaphore_ptr);
 UINT        _txe_semaphore_get(TX_SEMAPHORE *semaphore_ptr, ULONG wait_option);
 UINT        _txe_semaphore_info_get(TX_SEMAPHORE *semaphore_ptr, CHAR **name, ULONG *current_value,
@@ -1748,6 +2756,56 @@ UINT        _txe_semaphore_info_get(TX_SEMAPHORE *semaphore_ptr, CHAR **name, UL
 UINT        _txe_semaphore_prioritize(TX_SEMAPHORE *semaphore_ptr);
 UINT        _txe_semaphore_put(TX_SEMAPHORE *semaphore_ptr);
 UINT        _txe_semaphore_put_notify(TX_SEMAPHORE *semaphore_ptr, VOID (*semaphore_put_notify)(TX_SEMAPHORE *notify_semaphore_ptr));
+UINT        _txe_semaphore_put_count(TX_SEMAPHORE *semaphore_ptr, ULONG count);
+UINT        _txe_semaphore_get_count(TX_SEMAPHORE *semaphore_ptr, ULONG count, ULONG wait_option);
+
+
+/* Define slab memory pool management function prototypes.  */
+
+UINT        _tx_slab_allocate(TX_SLAB_POOL *pool_ptr, VOID **block_ptr, ULONG memory_size, ULONG wait_option);
+UINT        _tx_slab_pool_class_info_get(TX_SLAB_POOL *pool_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *pages, ULONG *available_blocks, ULONG *allocated_blocks);
+UINT        _tx_slab_pool_create(TX_SLAB_POOL *pool_ptr, CHAR *name_ptr, ULONG *class_sizes, UINT class_count,
+                    ULONG page_size, VOID *pool_start, ULONG pool_size, UINT options);
+UINT        _tx_slab_pool_delete(TX_SLAB_POOL *pool_ptr);
+UINT        _tx_slab_pool_info_get(TX_SLAB_POOL *pool_ptr, CHAR **name, ULONG *available_pages,
+                    ULONG *total_pages, TX_THREAD **first_suspended,
+                    ULONG *suspended_count, TX_SLAB_POOL **next_pool);
+UINT        _tx_slab_release(VOID *block_ptr);
+
+
+/* Define error checking shells for API services.  These are only referenced by the
+   application.  */
+
+UINT        _txe_slab_allocate(TX_SLAB_POOL *pool_ptr, VOID **block_ptr, ULONG memory_size, ULONG wait_option);
+UINT        _txe_slab_pool_class_info_get(TX_SLAB_POOL *pool_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *pages, ULONG *available_blocks, ULONG *allocated_blocks);
+UINT        _txe_slab_pool_create(TX_SLAB_POOL *pool_ptr, CHAR *name_ptr, ULONG *class_sizes, UINT class_count,
+                    ULONG page_size, VOID *pool_start, ULONG pool_size, UINT options, UINT pool_control_block_size);
+UINT        _txe_slab_pool_delete(TX_SLAB_POOL *pool_ptr);
+UINT        _txe_slab_pool_info_get(TX_SLAB_POOL *pool_ptr, CHAR **name, ULONG *available_pages,
+                    ULONG *total_pages, TX_THREAD **first_suspended,
+                    ULONG *suspended_count, TX_SLAB_POOL **next_pool);
+UINT        _txe_slab_release(VOID *block_ptr);
+
+
+/* Define single-producer single-consumer ring management function prototypes.  */
+
+UINT        _tx_spsc_ring_create(TX_SPSC_RING *ring_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *ring_start, ULONG ring_size);
+UINT        _tx_spsc_ring_delete(TX_SPSC_RING *ring_ptr);
+UINT        _tx_spsc_ring_receive(TX_SPSC_RING *ring_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _tx_spsc_ring_send(TX_SPSC_RING *ring_ptr, VOID *source_ptr, ULONG wait_option);
+
+
+/* Define error checking shells for API services.  These are only referenced by the
+   application.  */
+
+UINT        _txe_spsc_ring_create(TX_SPSC_RING *ring_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *ring_start, ULONG ring_size, UINT ring_control_block_size);
+UINT        _txe_spsc_ring_delete(TX_SPSC_RING *ring_ptr);
+UINT        _txe_spsc_ring_receive(TX_SPSC_RING *ring_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txe_spsc_ring_send(TX_SPSC_RING *ring_ptr, VOID *source_ptr, ULONG wait_option);
 
 
 /* Define thread control function prototypes.  */
@@ -1786,6 +2844,8 @@ UINT        _tx_thread_suspend(TX_THREAD *thread_ptr);
 UINT        _tx_thread_terminate(TX_THREAD *thread_ptr);
 UINT        _tx_thread_time_slice_change(TX_THREAD *thread_ptr, ULONG new_time_slice, ULONG *old_time_slice);
 UINT        _tx_thread_wait_abort(TX_THREAD *thread_ptr);
+UINT        _tx_thread_notify(TX_THREAD *thread_ptr, ULONG value, UINT action);
+UINT        _tx_thread_notify_wait(UINT exit_option, ULONG *value_ptr, ULONG wait_option);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
@@ -1812,6 +2872,8 @@ UINT        _txe_thread_suspend(TX_THREAD *thread_ptr);
 UINT        _txe_thread_terminate(TX_THREAD *thread_ptr);
 UINT        _txe_thread_time_slice_change(TX_THREAD *thread_ptr, ULONG new_time_slice, ULONG *old_time_slice);
 UINT        _txe_thread_wait_abort(TX_THREAD *thread_ptr);
+UINT        _txe_thread_notify(TX_THREAD *thread_ptr, ULONG value, UINT action);
+UINT        _txe_thread_notify_wait(UINT exit_option, ULONG *value_ptr, ULONG wait_option);
 
 
 /* Define timer management function prototypes.  */
@@ -1861,6 +2923,29 @@ UINT        _tx_trace_user_event_insert(ULONG event_id, ULONG info_field_1, ULON
 UINT        _tx_trace_interrupt_control(UINT new_posture);
 
 
+/* Define wait set management function prototypes.  */
+
+UINT        _tx_wait_set_create(TX_WAIT_SET *wait_set_ptr, CHAR *name_ptr);
+UINT        _tx_wait_set_delete(TX_WAIT_SET *wait_set_ptr);
+UINT        _tx_wait_set_event_flags_add(TX_WAIT_SET *wait_set_ptr, TX_EVENT_FLAGS_GROUP *group_ptr);
+UINT        _tx_wait_set_queue_add(TX_WAIT_SET *wait_set_ptr, TX_QUEUE *queue_ptr);
+UINT        _tx_wait_set_remove(TX_WAIT_SET *wait_set_ptr, VOID *object_ptr);
+UINT        _tx_wait_set_semaphore_add(TX_WAIT_SET *wait_set_ptr, TX_SEMAPHORE *semaphore_ptr);
+UINT        _tx_wait_set_wait(TX_WAIT_SET *wait_set_ptr, VOID **ready_object_ptr, ULONG wait_option);
+
+
+/* Define error checking shells for API services.  These are only referenced by the
+   application.  */
+
+UINT        _txe_wait_set_create(TX_WAIT_SET *wait_set_ptr, CHAR *name_ptr, UINT wait_set_control_block_size);
+UINT        _txe_wait_set_delete(TX_WAIT_SET *wait_set_ptr);
+UINT        _txe_wait_set_event_flags_add(TX_WAIT_SET *wait_set_ptr, TX_EVENT_FLAGS_GROUP *group_ptr);
+UINT        _txe_wait_set_queue_add(TX_WAIT_SET *wait_set_ptr, TX_QUEUE *queue_ptr);
+UINT        _txe_wait_set_remove(TX_WAIT_SET *wait_set_ptr, VOID *object_ptr);
+UINT        _txe_wait_set_semaphore_add(TX_WAIT_SET *wait_set_ptr, TX_SEMAPHORE *semaphore_ptr);
+UINT        _txe_wait_set_wait(TX_WAIT_SET *wait_set_ptr, VOID **ready_object_ptr, ULONG wait_option);
+
+
 /* Add a default macro that can be re-defined in tx_port.h to add default processing when a thread starts. Common usage
    would be for enabling floating point for a thread by default, however, the additional processing could be anything
    defined in tx_port.h.  */
@@ -0,0 +1,201 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_message_buffer.h                                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX message buffer management component,  */
+/*    including all data types and external references.  It is assumed    */
+/*    that tx_api.h and tx_port.h have already been included.             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_MESSAGE_BUFFER_H
+#define TX_MESSAGE_BUFFER_H
+
+
+/* Define message buffer control specific data definitions.  */
+
+#define TX_MESSAGE_BUFFER_ID                    ((ULONG) 0x4D534742)
+
+
+/* Define the number of bytes a message of the specified size uses in the ring of a
+   message buffer.  Each message is stored as a ULONG length followed by the message,
+   padded to a multiple of sizeof(ULONG) so that the length of the next message is
+   always aligned and never wraps around the end of the ring.  */
+
+#define TX_MESSAGE_BUFFER_RECORD_SIZE(z)        ((((((ULONG) (z)) + (sizeof(ULONG))) - ((ULONG) 1))/(sizeof(ULONG))) * (sizeof(ULONG))) + (sizeof(ULONG))
+
+
+/* Define the message buffer copy macro.  Note that the source and destination pointers
+   are incremented by the macro and that the size is destroyed.  This macro may be
+   redefined in tx_port.h to use a faster copy for the target.  */
+
+#ifndef TX_MESSAGE_BUFFER_COPY
+#define TX_MESSAGE_BUFFER_COPY(s, d, z)         \
+                    while ((z) != ((ULONG) 0))  \
+                    {                           \
+                        *(d)++ =  *(s)++;       \
+                        (z)--;                  \
+                    }
+#endif
+
+
+/* Define the pointer conversions used to access the message buffer.  */
+
+#ifndef TX_VOID_TO_MESSAGE_BUFFER_POINTER_CONVERT
+#define TX_VOID_TO_MESSAGE_BUFFER_POINTER_CONVERT(a)    ((TX_MESSAGE_BUFFER *) ((VOID *) (a)))
+#endif
+#ifndef TX_UCHAR_TO_ULONG_POINTER_CONVERT
+#define TX_UCHAR_TO_ULONG_POINTER_CONVERT(a)            ((ULONG *) ((VOID *) (a)))
+#endif
+
+
+/* Define the macros used to access unused arguments for the sake of lint, MISRA, etc.  */
+
+#ifndef TX_MESSAGE_BUFFER_NOT_USED
+#define TX_MESSAGE_BUFFER_NOT_USED(a)                   ((void)(a))
+#endif
+#ifndef TX_MESSAGE_BUFFER_SEND_NOTIFY_NOT_USED
+#define TX_MESSAGE_BUFFER_SEND_NOTIFY_NOT_USED(a)       ((void)(a))
+#endif
+
+
+/* Determine if in-line component initialization is supported by the
+   caller.  */
+
+#ifdef TX_INVOKE_INLINE_INITIALIZATION
+
+/* Yes, in-line initialization is supported, remap the message buffer
+   initialization function.  */
+
+#ifndef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+#define _tx_message_buffer_initialize() \
+                    _tx_message_buffer_created_ptr =                   TX_NULL;     \
+                    _tx_message_buffer_created_count =                 TX_EMPTY
+#else
+#define _tx_message_buffer_initialize() \
+                    _tx_message_buffer_created_ptr =                   TX_NULL;     \
+                    _tx_message_buffer_created_count =                 TX_EMPTY;    \
+                    _tx_message_buffer_performance_messages_sent_count =       ((ULONG) 0); \
+                    _tx_message_buffer_performance_messages_received_count =   ((ULONG) 0); \
+                    _tx_message_buffer_performance_empty_suspension_count =    ((ULONG) 0); \
+                    _tx_message_buffer_performance_full_suspension_count =     ((ULONG) 0); \
+                    _tx_message_buffer_performance_full_error_count =          ((ULONG) 0); \
+                    _tx_message_buffer_performance_timeout_count =             ((ULONG) 0)
+#endif
+#define TX_MESSAGE_BUFFER_INIT
+#else
+
+/* No in-line initialization is supported, use standard function call.  */
+VOID        _tx_message_buffer_initialize(VOID);
+#endif
+
+
+/* Define internal message buffer management function prototypes.  */
+
+VOID        _tx_message_buffer_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+ULONG       _tx_message_buffer_record_read(TX_MESSAGE_BUFFER *message_buffer_ptr, UCHAR *destination_ptr);
+VOID        _tx_message_buffer_record_write(TX_MESSAGE_BUFFER *message_buffer_ptr, UCHAR *source_ptr, ULONG size);
+
+
+/* Message buffer management component data declarations follow.  */
+
+/* Determine if the initialization function of this component is including
+   this file.  If so, make the data definitions really happen.  Otherwise,
+   make them extern so other functions in the component can access them.  */
+
+#ifdef TX_MESSAGE_BUFFER_INIT
+#define MESSAGE_BUFFER_DECLARE
+#else
+#define MESSAGE_BUFFER_DECLARE extern
+#endif
+
+
+/* Define the head pointer of the created message buffer list.  */
+
+MESSAGE_BUFFER_DECLARE  TX_MESSAGE_BUFFER *     _tx_message_buffer_created_ptr;
+
+
+/* Define the variable that holds the number of created message buffers. */
+
+MESSAGE_BUFFER_DECLARE  ULONG                   _tx_message_buffer_created_count;
+
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+/* Define the total number of messages sent.  */
+
+MESSAGE_BUFFER_DECLARE  ULONG                   _tx_message_buffer_performance_messages_sent_count;
+
+
+/* Define the total number of messages received.  */
+
+MESSAGE_BUFFER_DECLARE  ULONG                   _tx_message_buffer_performance_messages_received_count;
+
+
+/* Define the total number of message buffer empty suspensions.  */
+
+MESSAGE_BUFFER_DECLARE  ULONG                   _tx_message_buffer_performance_empty_suspension_count;
+
+
+/* Define the total number of message buffer full suspensions.  */
+
+MESSAGE_BUFFER_DECLARE  ULONG                   _tx_message_buffer_performance_full_suspension_count;
+
+
+/* Define the total number of message buffer full errors.  */
+
+MESSAGE_BUFFER_DECLARE  ULONG                   _tx_message_buffer_performance_full_error_count;
+
+
+/* Define the total number of message buffer timeouts.  */
+
+MESSAGE_BUFFER_DECLARE  ULONG                   _tx_message_buffer_performance_timeout_count;
+
+#endif
+
+
+/* Define default post message buffer delete macro to whitespace, if it hasn't been defined previously (typically in tx_port.h).  */
+
+#ifndef TX_MESSAGE_BUFFER_DELETE_PORT_COMPLETION
+#define TX_MESSAGE_BUFFER_DELETE_PORT_COMPLETION(m)
+#endif
+
+
+#endif
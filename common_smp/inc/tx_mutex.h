@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    tx_mutex.h                                          PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -44,6 +44,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added adaptive mutex spin,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -56,6 +58,15 @@
 #define TX_MUTEX_ID                             ((ULONG) 0x4D555445)
 
 
+/* Define the instruction executed in each poll of an adaptive mutex spin, for
+   example an instruction that tells the core it is in a spin loop. Ports can
+   define this in tx_port.h, otherwise nothing is executed.  */
+
+#ifndef TX_MUTEX_SPIN_PAUSE
+#define TX_MUTEX_SPIN_PAUSE
+#endif
+
+
 /* Determine if in-line component initialization is supported by the
    caller.  */
 
@@ -92,6 +103,9 @@ VOID        _tx_mutex_initialize(VOID);
 VOID        _tx_mutex_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
 VOID        _tx_mutex_thread_release(TX_THREAD *thread_ptr);
 VOID        _tx_mutex_priority_change(TX_THREAD *thread_ptr, UINT new_priority);
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+UINT        _tx_mutex_spin(TX_MUTEX *mutex_ptr);
+#endif
 
 
 /* Mutex management component data declarations follow.  */
@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    tx_thread.h                                        PORTABLE SMP     */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -42,6 +42,11 @@
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  09-30-2020     William E. Lamie         Initial Version 6.1           */
+/*  xx-xx-xxxx     Microsoft Corporation    Added thread notification     */
+/*                                            cleanup, added              */
+/*                                            priority-ordered suspension */
+/*                                            list functions, resulting   */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 
@@ -124,6 +129,11 @@
 /* Define internal thread control function prototypes.  */
 
 VOID        _tx_thread_initialize(VOID);
+VOID        _tx_thread_notify_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+VOID        _tx_thread_priority_suspension_insert(TX_THREAD **suspension_list, TX_PRIORITY_SUSPENSION *priority_suspension, TX_THREAD *thread_ptr);
+VOID        _tx_thread_priority_suspension_remove(TX_THREAD *suspension_list, TX_PRIORITY_SUSPENSION *priority_suspension, TX_THREAD *thread_ptr);
+#endif
 VOID        _tx_thread_schedule(VOID);
 VOID        _tx_thread_shell_entry(VOID);
 VOID        _tx_thread_stack_analyze(TX_THREAD *thread_ptr);
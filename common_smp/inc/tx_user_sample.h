@@ -26,7 +26,7 @@
 /*  PORT SPECIFIC C INFORMATION                            RELEASE        */
 /*                                                                        */
 /*    tx_user.h                                           PORTABLE C      */
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*                                                                        */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -62,6 +62,28 @@
 /*                                            optimized the definition of */
 /*                                            TX_TIMER_TICKS_PER_SECOND,  */
 /*                                            resulting in version 6.1.11 */
+/*  xx-xx-xxxx      Microsoft Corporation   Added TLSF second-level index */
+/*                                            count option, added byte    */
+/*                                            pool cache options, added   */
+/*                                            byte pool search restart    */
+/*                                            limit option, added byte    */
+/*                                            pool fragmentation          */
+/*                                            information option, added   */
+/*                                            block pool core cache       */
+/*                                            option, added slab pool     */
+/*                                            options, added lock-free    */
+/*                                            block pool option, added    */
+/*                                            message buffer performance  */
+/*                                            option, added zero-copy     */
+/*                                            reserve, commit, acquire    */
+/*                                            and release services, added */
+/*                                            priority queues, added wait */
+/*                                            sets, added thread          */
+/*                                            notification option, added  */
+/*                                            priority-ordered suspension */
+/*                                            lists option, added         */
+/*                                            adaptive mutex spin option, */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -269,6 +291,13 @@
 #define TX_QUEUE_ENABLE_PERFORMANCE_INFO
 */
 
+/* Determine if message buffer performance gathering is required by the application. When the following is
+   defined, ThreadX gathers various message buffer performance information. */
+
+/*
+#define TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+*/
+
 /* Determine if semaphore performance gathering is required by the application. When the following is
    defined, ThreadX gathers various semaphore performance information. */
 
@@ -302,5 +331,163 @@
 #define TX_BYTE_POOL_DELAY_VALUE              3
 */
 
+/*  Determine if byte pool searches are bounded. When the following is defined, the first-fit
+    searches of one allocation or release, once restarted this many times in total because
+    another thread took over the pool, finish without further restarts. On single-core ports
+    preemption is disabled for the remainder of the searches; on SMP ports the protection is
+    held. An allocation keeps this until it has checked the outcome of its search. The value
+    must be at least 1. */
+
+/*
+#define TX_BYTE_POOL_SEARCH_RESTART_LIMIT     4
+*/
+
+/*  Override the number of second-level size classes of byte pools created with the TLSF
+    policy. Each power-of-two range of block sizes is divided into 2^N classes. Larger
+    values reduce internal fragmentation but increase the size of the index placed at
+    the start of each TLSF pool.  */
+
+/*
+#define TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2 3
+*/
+
+/* Determine if the byte pool size-class cache is required by the application. When the following
+   is defined, blocks released to a pool whose cache has been enabled with tx_byte_pool_cache_enable
+   are kept on per-size-class lists and handed directly to later allocations of the same class
+   without searching the pool. */
+
+/*
+#define TX_BYTE_POOL_ENABLE_CACHE
+*/
+
+/*  Override the number of size classes of the byte pool cache and the size of the smallest
+    class. Class N holds blocks of at least TX_BYTE_POOL_CACHE_MIN_SIZE << N bytes.  */
+
+/*
+#define TX_BYTE_POOL_CACHE_CLASSES            5
+#define TX_BYTE_POOL_CACHE_MIN_SIZE           16
+*/
+
+/* Determine if byte pool fragmentation information is required by the application. When the
+   following is defined, each byte pool keeps the number of free bytes, the largest free block
+   and a histogram of its free block sizes up to date, which tx_byte_pool_fragmentation_info_get
+   returns without walking the pool.  */
+
+/*
+#define TX_BYTE_POOL_ENABLE_FRAGMENTATION_INFO
+*/
+
+/*  Override the number of entries of the byte pool free block size histogram. Entry N counts
+    the free blocks of at least 16 << N bytes, with the last entry counting all larger blocks.  */
+
+/*
+#define TX_BYTE_POOL_FRAGMENTATION_CLASSES    16
+*/
+
+/* Determine if per-core byte pool arenas are required by the application (SMP only). When the
+   following is defined, each core keeps its own lists of blocks of a pool whose arenas have been
+   enabled with tx_byte_pool_arena_enable, so that most allocations and releases of small blocks
+   are completed without taking the global SMP protection.  */
+
+/*
+#define TX_BYTE_POOL_ENABLE_ARENAS
+*/
+
+/*  Override the number of size classes of the per-core arenas, the size of the smallest class
+    and the number of blocks taken from the pool each time an arena class is empty. Class N
+    holds blocks of at least TX_BYTE_POOL_ARENA_MIN_SIZE << N bytes.  */
+
+/*
+#define TX_BYTE_POOL_ARENA_CLASSES            5
+#define TX_BYTE_POOL_ARENA_MIN_SIZE           16
+#define TX_BYTE_POOL_ARENA_REFILL_COUNT       4
+*/
+
+/* Determine if per-core block pool caches are required by the application (SMP only). When the
+   following is defined, each core keeps a small list of free blocks of a pool whose caches have
+   been enabled with tx_block_pool_core_cache_enable. The caches are refilled from and drained to
+   the pool in batches of half the cache depth.  */
+
+/*
+#define TX_BLOCK_POOL_ENABLE_CORE_CACHE
+*/
+
+/* Determine if the lock-free block pool option is required by the application. When the following
+   is defined, tx_block_pool_lock_free_enable switches a pool of up to 65535 blocks to a free list
+   that is changed with a single compare and swap, so blocks are allocated and released without
+   disabling interrupts unless a thread must suspend. Ports should define
+   TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP with an atomic instruction, otherwise the swap is
+   performed with interrupts disabled.  */
+
+/*
+#define TX_BLOCK_POOL_ENABLE_LOCK_FREE
+*/
+
+/* Determine if the zero-copy queue services are required by the application. When the following
+   is defined, tx_queue_send_reserve and tx_queue_receive_acquire return pointers into the message
+   area of a queue, which the caller fills or reads in place before tx_queue_send_commit or
+   tx_queue_receive_release. Otherwise these services return TX_FEATURE_NOT_ENABLED.  */
+
+/*
+#define TX_QUEUE_ENABLE_ZERO_COPY
+*/
+
+/* Determine if priority queues are required by the application. When the following is defined,
+   tx_queue_priority_create creates a queue whose messages are received highest priority first,
+   and tx_queue_priority_send sends a message with a priority. This option must not be used
+   with TX_QUEUE_ENABLE_ZERO_COPY. Otherwise these services return TX_FEATURE_NOT_ENABLED.  */
+
+/*
+#define TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+*/
+
+/* Determine if wait sets are required by the application. When the following is defined,
+   queues, semaphores, and event flags groups can be added to a wait set, and a thread can
+   wait on all of them at once with tx_wait_set_wait. Otherwise the wait set services
+   return TX_FEATURE_NOT_ENABLED.  */
+
+/*
+#define TX_ENABLE_WAIT_SET
+*/
+
+/* Determine if thread notifications are required by the application. When the following is
+   defined, each thread has a notification value that other threads and ISRs update with
+   tx_thread_notify, and that the thread waits for with tx_thread_notify_wait. Otherwise
+   these services return TX_FEATURE_NOT_ENABLED.  */
+
+/*
+#define TX_THREAD_ENABLE_NOTIFICATION
+*/
+
+/* Determine if priority-ordered suspension lists are required by the application. When the
+   following is defined, semaphores created with tx_semaphore_ordered_create and mutexes
+   created with tx_mutex_ordered_create keep their suspended threads sorted by priority,
+   first-in first-out within each priority. Otherwise these services return
+   TX_FEATURE_NOT_ENABLED.  */
+
+/*
+#define TX_ENABLE_PRIORITY_SUSPENSION
+*/
+
+/* Determine if adaptive mutexes are required by the application (SMP only). When the following
+   is defined, a thread that requests a mutex owned by a thread executing on another core polls
+   the mutex before it suspends, up to the spin limit set with tx_mutex_spin_enable. The spin
+   ends early if the owner is preempted or suspended. With TX_MUTEX_ENABLE_PERFORMANCE_INFO,
+   tx_mutex_spin_performance_info_get reports the spins that obtained the mutex and the spins
+   that ended in a suspension.  */
+
+/*
+#define TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+*/
+
+/*  Override the maximum number of size classes of a slab pool and the request size granule
+    of its routing table. The routing table at the start of each slab pool has one byte for
+    each granule up to the block size of the largest class.  */
+
+/*
+#define TX_SLAB_POOL_MAX_CLASSES              8
+#define TX_SLAB_POOL_ROUTE_GRANULE            8
+*/
+
 #endif
 
@@ -38,7 +38,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_block_allocate                                  PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -61,6 +61,10 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_block_pool_lock_free_allocate Allocate from lock-free list      */
+/*    _tx_block_pool_core_cache_allocate                                  */
+/*                                      Allocate from core cache          */
+/*    _tx_block_pool_core_cache_flush   Flush core caches                 */
 /*    _tx_thread_system_suspend         Suspend thread                    */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*                                                                        */
@@ -75,6 +79,11 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added per-core block caches,  */
+/*                                            added lock-free block pool  */
+/*                                            support, added bulk         */
+/*                                            allocation waiters,         */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_block_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option)
@@ -102,6 +111,45 @@ ULONG                       lower_tbu;
 #endif
 
 
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+    /* Determine if the pool uses the lock-free list.  */
+    if (pool_ptr -> tx_block_pool_lock_free_enabled == TX_TRUE)
+    {
+
+        /* Yes, allocate the block from the lock-free list.  */
+        status =  _tx_block_pool_lock_free_allocate(pool_ptr, block_ptr, wait_option);
+    }
+    else
+    {
+#endif
+
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+
+    /* Determine if the core caches of the pool are enabled.  */
+    if (pool_ptr -> tx_block_pool_core_cache_depth != ((UINT) 0))
+    {
+
+        /* Yes, try the cache of the executing core first.  */
+        status =  _tx_block_pool_core_cache_allocate(pool_ptr, block_ptr);
+    }
+    else
+    {
+
+        /* No block from a core cache.  */
+        status =  TX_NO_MEMORY;
+    }
+
+    /* Determine if the block came from the core cache.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Yes, the block was allocated without the global protection.  */
+    }
+    else
+    {
+#endif
+
     /* Disable interrupts to get a block from the pool.  */
     TX_DISABLE
 
@@ -148,6 +196,25 @@ ULONG                       lower_tbu;
     upper_tbu =  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_UPPER_OFFSET));
 #endif
 
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+
+    /* Determine if the pool is empty while its core caches are enabled.  */
+    if (pool_ptr -> tx_block_pool_available == ((UINT) 0))
+    {
+
+        /* Determine if the core caches are enabled.  */
+        if (pool_ptr -> tx_block_pool_core_cache_depth != ((UINT) 0))
+        {
+
+            /* Yes, make released blocks bypass the core caches before the blocks
+               of the caches are returned to the pool.  A cache that is in use is
+               emptied by its user once it sees the bypass flag.  */
+            pool_ptr -> tx_block_pool_core_cache_bypass =  TX_TRUE;
+            (VOID) _tx_block_pool_core_cache_flush(pool_ptr);
+        }
+    }
+#endif
+
     /* Determine if there is an available block.  */
     if (pool_ptr -> tx_block_pool_available != ((UINT) 0))
     {
@@ -171,6 +238,17 @@ ULONG                       lower_tbu;
         temp_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
         *next_block_ptr =  temp_ptr;
 
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+
+        /* Determine if no thread waits for a block.  */
+        if (pool_ptr -> tx_block_pool_suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* Released blocks may be kept in the core caches again.  */
+            pool_ptr -> tx_block_pool_core_cache_bypass =  TX_FALSE;
+        }
+#endif
+
 #ifdef TX_ENABLE_EVENT_TRACE
 
         /* Check that the event time stamp is unchanged.  A different
@@ -252,6 +330,9 @@ ULONG                       lower_tbu;
                 /* Save the return block pointer address as well.  */
                 thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) block_ptr;
 
+                /* Save the number of blocks requested.  */
+                thread_ptr -> tx_thread_suspend_info =  ((ULONG) 1);
+
 #ifndef TX_NOT_INTERRUPTABLE
 
                 /* Increment the suspension sequence number, which is used to identify
@@ -367,6 +448,12 @@ ULONG                       lower_tbu;
             TX_RESTORE
         }
     }
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+    }
+#endif
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+    }
+#endif
 
     /* Return completion status.  */
     return(status);
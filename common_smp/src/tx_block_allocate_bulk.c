@@ -0,0 +1,410 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_allocate_bulk                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates the specified number of blocks from the     */
+/*    specified memory block pool. The blocks that are available are      */
+/*    unlinked from the pool under a single interrupt lockout.            */
+/*                                                                        */
+/*    If not enough blocks are available and the wait option specifies    */
+/*    suspension, the thread keeps the blocks it has and suspends once    */
+/*    for all of the remaining blocks. Released blocks are given to it    */
+/*    in the order of the suspension list, and it is resumed when it has  */
+/*    all of them. The wait option bounds the whole call, not each        */
+/*    block. If the wait ends before all of the blocks are obtained, the  */
+/*    blocks already allocated are returned to the pool. Either all of    */
+/*    the blocks are allocated or none.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pool to allocate blocks from      */
+/*    block_ptrs                        Array of count pointers that      */
+/*                                        receive the blocks              */
+/*    count                             Number of blocks to allocate      */
+/*    wait_option                       Suspension option, which bounds   */
+/*                                        the whole call                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_pop      Take block from lock-free list    */
+/*    _tx_block_release_bulk            Release blocks to the pool        */
+/*    _tx_thread_system_suspend         Suspend thread                    */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*    _tx_block_pool_core_cache_flush   Flush core caches                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_block_allocate_bulk          Error checking function           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_allocate_bulk(TX_BLOCK_POOL *pool_ptr, VOID **block_ptrs, UINT count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                        status;
+UINT                        index;
+UINT                        taken;
+UCHAR                       *work_ptr;
+UCHAR                       *temp_ptr;
+UCHAR                       **next_block_ptr;
+UCHAR                       **return_ptr;
+TX_THREAD                   *thread_ptr;
+UINT                        suspended_count;
+TX_THREAD                   *next_thread;
+TX_THREAD                   *previous_thread;
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+UINT                        set_waiting;
+#endif
+
+
+    /* Disable interrupts to get the blocks from the pool.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_ALLOCATE_BULK, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(block_ptrs), count, wait_option, TX_TRACE_BLOCK_POOL_EVENTS)
+
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+    /* Determine if the pool uses the lock-free list.  */
+    if (pool_ptr -> tx_block_pool_lock_free_enabled == TX_TRUE)
+    {
+
+        /* Determine if the thread can suspend for blocks that are not available.  */
+        if ((wait_option != TX_NO_WAIT) && (_tx_thread_preempt_disable == ((UINT) 0)))
+        {
+
+            /* Yes, set the waiting flag if the list runs empty, so a release that
+               follows gives its block to the suspended threads.  */
+            set_waiting =  TX_TRUE;
+        }
+        else
+        {
+
+            /* No, leave the waiting flag as it is.  */
+            set_waiting =  TX_FALSE;
+        }
+
+        /* Take blocks from the lock-free list until the request is met or the list is empty.  */
+        taken =  ((UINT) 0);
+        do
+        {
+
+            /* Take the block at the head of the lock-free list.  */
+            work_ptr =  _tx_block_pool_lock_free_pop(pool_ptr, set_waiting);
+
+            /* Determine if a block was obtained.  */
+            if (work_ptr != TX_NULL)
+            {
+
+                /* Yes, return the block to the caller.  */
+                return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(&block_ptrs[taken]);
+                *return_ptr =  work_ptr;
+
+                /* Move to the next block.  */
+                taken++;
+            }
+
+        } while ((taken < count) && (work_ptr != TX_NULL));
+    }
+    else
+    {
+#endif
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total allocations counter.  */
+    _tx_block_pool_performance_allocate_count =  _tx_block_pool_performance_allocate_count + ((ULONG) count);
+
+    /* Increment the number of allocations on this pool.  */
+    pool_ptr -> tx_block_pool_performance_allocate_count =  pool_ptr -> tx_block_pool_performance_allocate_count + ((ULONG) count);
+#endif
+
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+
+    /* Determine if the pool is short of blocks while its core caches are enabled.  */
+    if (pool_ptr -> tx_block_pool_available < count)
+    {
+
+        /* Determine if the core caches are enabled.  */
+        if (pool_ptr -> tx_block_pool_core_cache_depth != ((UINT) 0))
+        {
+
+            /* Yes, bypass the core caches and return their blocks to the pool.  */
+            pool_ptr -> tx_block_pool_core_cache_bypass =  TX_TRUE;
+            (VOID) _tx_block_pool_core_cache_flush(pool_ptr);
+        }
+    }
+#endif
+
+    /* Determine how many blocks are taken from the available list now.  */
+    if (pool_ptr -> tx_block_pool_available >= count)
+    {
+
+        /* All of the blocks are available.  */
+        taken =  count;
+    }
+    else if ((wait_option == TX_NO_WAIT) || (_tx_thread_preempt_disable != ((UINT) 0)))
+    {
+
+        /* Not enough blocks and no suspension, so none are taken.  */
+        taken =  ((UINT) 0);
+    }
+    else
+    {
+
+        /* Take the available blocks now.  Blocks are only available when no thread
+           is suspended on the pool, so this thread is the first to wait for more.  */
+        taken =  pool_ptr -> tx_block_pool_available;
+    }
+
+    /* Decrement the available count.  */
+    pool_ptr -> tx_block_pool_available =  pool_ptr -> tx_block_pool_available - taken;
+
+    /* Unlink the blocks from the front of the available list.  */
+    for (index =  ((UINT) 0); index < taken; index++)
+    {
+
+        /* Pickup the current block pointer.  */
+        work_ptr =  pool_ptr -> tx_block_pool_available_list;
+
+        /* Return the block to the caller.  */
+        temp_ptr =    TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+        return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(&block_ptrs[index]);
+        *return_ptr =  temp_ptr;
+
+        /* Modify the available list to point at the next block in the pool. */
+        next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        pool_ptr -> tx_block_pool_available_list =  *next_block_ptr;
+
+        /* Save the pool's address in the block for when it is released!  */
+        temp_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+        *next_block_ptr =  temp_ptr;
+    }
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+    }
+#endif
+
+    /* Determine if all of the blocks were taken.  */
+    if (taken == count)
+    {
+
+        /* Set status to success.  */
+        status =  TX_SUCCESS;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option == TX_NO_WAIT)
+    {
+
+        /* Immediate return, return error completion.  */
+        status =  TX_NO_MEMORY;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Determine if the preempt disable flag is non-zero.  */
+    else if (_tx_thread_preempt_disable != ((UINT) 0))
+    {
+
+        /* Suspension is not allowed if the preempt disable flag is non-zero at this point, return error completion.  */
+        status =  TX_NO_MEMORY;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* Prepare for suspension of this thread.  The thread suspends once for all
+           of the remaining blocks, which are returned to it in the order of the
+           suspension list as they are released.  */
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total suspensions counter.  */
+        _tx_block_pool_performance_suspension_count++;
+
+        /* Increment the number of suspensions on this pool.  */
+        pool_ptr -> tx_block_pool_performance_suspension_count++;
+#endif
+
+        /* Pickup thread pointer.  */
+        TX_THREAD_GET_CURRENT(thread_ptr)
+
+        /* Setup cleanup routine pointer.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_block_pool_cleanup);
+
+        /* Setup cleanup information, i.e. this pool control
+           block.  */
+        thread_ptr -> tx_thread_suspend_control_block =  (VOID *) pool_ptr;
+
+        /* Save the address of the first return pointer that is not filled.  */
+        thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) &block_ptrs[taken];
+
+        /* Save the number of blocks still needed.  */
+        thread_ptr -> tx_thread_suspend_info =  (ULONG) (count - taken);
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+        /* Increment the suspension sequence number, which is used to identify
+           this suspension event.  */
+        thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+        /* Pickup the number of suspended threads.  */
+        suspended_count =  (pool_ptr -> tx_block_pool_suspended_count);
+
+        /* Increment the number of suspended threads.  */
+        (pool_ptr -> tx_block_pool_suspended_count)++;
+
+        /* Setup suspension list.  */
+        if (suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* No other threads are suspended.  Setup the head pointer and
+               just setup this threads pointers to itself.  */
+            pool_ptr -> tx_block_pool_suspension_list =     thread_ptr;
+            thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+            thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+        }
+        else
+        {
+
+            /* This list is not NULL, add current thread to the end. */
+            next_thread =                                   pool_ptr -> tx_block_pool_suspension_list;
+            thread_ptr -> tx_thread_suspended_next =        next_thread;
+            previous_thread =                               next_thread -> tx_thread_suspended_previous;
+            thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+            previous_thread -> tx_thread_suspended_next =   thread_ptr;
+            next_thread -> tx_thread_suspended_previous =   thread_ptr;
+        }
+
+        /* Set the state to suspended.  */
+        thread_ptr -> tx_thread_state =       TX_BLOCK_MEMORY;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Call actual non-interruptable thread suspension routine.  */
+        _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Set the suspending flag.  */
+        thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+        /* Setup the timeout period.  */
+        thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Call actual thread suspension routine.  */
+        _tx_thread_system_suspend(thread_ptr);
+#endif
+
+        /* Pickup the completion status.  */
+        status =  thread_ptr -> tx_thread_suspend_status;
+
+        /* Determine if the blocks obtained so far belong to a pool that still exists.  */
+        if ((status != TX_SUCCESS) && (status != TX_DELETED))
+        {
+
+            /* Yes, the thread still needed the number of blocks left in its suspend
+               information, so the blocks obtained are those before them.  */
+            taken =  count - ((UINT) thread_ptr -> tx_thread_suspend_info);
+        }
+        else
+        {
+
+            /* No blocks are returned to the pool.  */
+            taken =  ((UINT) 0);
+        }
+    }
+
+    /* Determine if the allocation failed.  */
+    if (status != TX_SUCCESS)
+    {
+
+        /* Determine if any blocks were obtained.  */
+        if (taken != ((UINT) 0))
+        {
+
+            /* Yes, return them to the pool.  */
+            (VOID) _tx_block_release_bulk(block_ptrs, taken);
+        }
+
+        /* Default the return pointers to NULL.  */
+        for (index =  ((UINT) 0); index < count; index++)
+        {
+
+            /* Clear this return pointer.  */
+            block_ptrs[index] =  TX_NULL;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
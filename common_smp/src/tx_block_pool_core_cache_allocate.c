@@ -0,0 +1,204 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_allocate                  PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a block from the cache of the executing     */
+/*    core without the global protection. When the cache is empty, it is  */
+/*    refilled with up to half of its depth of blocks from the pool       */
+/*    under a single protection.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pool to allocate block from       */
+/*    block_ptr                         Pointer to place allocated block  */
+/*                                        pointer                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_unlock  Unlock core cache                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_allocate                Allocate block from pool          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+UINT  _tx_block_pool_core_cache_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                        status;
+UINT                        refill;
+UINT                        index;
+TX_BLOCK_POOL_CORE_CACHE    *cache_ptr;
+UCHAR                       *work_ptr;
+UCHAR                       *temp_ptr;
+UCHAR                       *list_ptr;
+UCHAR                       **next_block_ptr;
+UCHAR                       **return_ptr;
+
+
+    /* Default to no block from the core cache.  */
+    status =  TX_NO_MEMORY;
+
+    /* Pickup the cache of the executing core.  */
+    cache_ptr =  &(pool_ptr -> tx_block_pool_core_cache[TX_SMP_CORE_ID]);
+
+    /* Lock the cache.  If a preempted thread of this core holds the lock, the cache
+       is bypassed.  */
+    if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(cache_ptr -> tx_block_pool_core_cache_lock), TX_NULL, pool_ptr -> tx_block_pool_start) == TX_TRUE)
+    {
+
+        /* Pickup the first block of the cache.  */
+        work_ptr =  cache_ptr -> tx_block_pool_core_cache_list;
+
+        /* Determine if the cache has a block.  */
+        if (work_ptr != TX_NULL)
+        {
+
+            /* Yes, remove the block from the cache.  */
+            next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            cache_ptr -> tx_block_pool_core_cache_list =  *next_block_ptr;
+            cache_ptr -> tx_block_pool_core_cache_count--;
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the number of allocations satisfied by the cache.  */
+            cache_ptr -> tx_block_pool_core_cache_performance_hit_count++;
+#endif
+        }
+
+        /* Determine if the cache may be refilled from the pool.  */
+        else if (pool_ptr -> tx_block_pool_core_cache_bypass == TX_FALSE)
+        {
+
+            /* Disable interrupts to take a batch of blocks from the pool.  */
+            TX_DISABLE
+
+            /* Determine if there is an available block.  */
+            if (pool_ptr -> tx_block_pool_available != ((UINT) 0))
+            {
+
+                /* Yes, take the first available block for this request.  */
+                pool_ptr -> tx_block_pool_available--;
+                work_ptr =        pool_ptr -> tx_block_pool_available_list;
+                next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                pool_ptr -> tx_block_pool_available_list =  *next_block_ptr;
+
+                /* Move up to half of the cache depth of further blocks to the cache.  */
+                refill =  (pool_ptr -> tx_block_pool_core_cache_depth + ((UINT) 1)) >> 1;
+                if (refill > pool_ptr -> tx_block_pool_available)
+                {
+
+                    /* Only take the blocks that are available.  */
+                    refill =  pool_ptr -> tx_block_pool_available;
+                }
+                for (index =  ((UINT) 0); index < refill; index++)
+                {
+
+                    /* Move the first available block to the front of the cache.  */
+                    list_ptr =        pool_ptr -> tx_block_pool_available_list;
+                    next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(list_ptr);
+                    pool_ptr -> tx_block_pool_available_list =  *next_block_ptr;
+                    *next_block_ptr =  cache_ptr -> tx_block_pool_core_cache_list;
+                    cache_ptr -> tx_block_pool_core_cache_list =  list_ptr;
+                }
+
+                /* Update the block counts.  */
+                pool_ptr -> tx_block_pool_available =  pool_ptr -> tx_block_pool_available - refill;
+                cache_ptr -> tx_block_pool_core_cache_count =  cache_ptr -> tx_block_pool_core_cache_count + refill;
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of refills of the cache.  */
+                cache_ptr -> tx_block_pool_core_cache_performance_refill_count++;
+#endif
+            }
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
+        {
+
+            /* The pool has been found empty, so its blocks are given out by the pool.  */
+        }
+
+        /* Determine if a block was found.  */
+        if (work_ptr != TX_NULL)
+        {
+
+            /* Save the pool's address in the block for when it is released!  */
+            next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            temp_ptr =        TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+            *next_block_ptr =  temp_ptr;
+
+            /* Return the block to the caller.  */
+            temp_ptr =    TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+            return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+            *return_ptr =  temp_ptr;
+
+            /* Set status to success.  */
+            status =  TX_SUCCESS;
+        }
+
+        /* Unlock the cache.  */
+        _tx_block_pool_core_cache_unlock(pool_ptr, cache_ptr);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
+
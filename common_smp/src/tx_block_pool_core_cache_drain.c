@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_drain                     PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a list of blocks taken from a core cache to   */
+/*    the pool. The blocks are placed in the available list under a       */
+/*    single protection while no thread is suspended on the pool; any     */
+/*    remaining blocks are released one at a time so that they are given  */
+/*    to the suspended threads.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to block pool             */
+/*    block_list                        List of free blocks               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_release                 Release block to pool             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_release Release to core cache             */
+/*    _tx_block_pool_core_cache_unlock  Unlock core cache                 */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+VOID  _tx_block_pool_core_cache_drain(TX_BLOCK_POOL *pool_ptr, UCHAR *block_list)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UCHAR               *list_ptr;
+UCHAR               *next_ptr;
+UCHAR               *temp_ptr;
+UCHAR               **next_block_ptr;
+
+
+    /* Disable interrupts to put the blocks back in the pool.  */
+    TX_DISABLE
+
+    /* Put the blocks back in the available list while no thread waits for a block.  */
+    list_ptr =  block_list;
+    while (list_ptr != TX_NULL)
+    {
+
+        /* Determine if there are any threads suspended on the block pool.  */
+        if (pool_ptr -> tx_block_pool_suspension_list != TX_NULL)
+        {
+
+            /* Yes, stop here.  */
+            break;
+        }
+
+        /* Pickup the next block of the list.  */
+        next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(list_ptr);
+        next_ptr =        *next_block_ptr;
+
+        /* Place the block at the front of the available list.  */
+        *next_block_ptr =  pool_ptr -> tx_block_pool_available_list;
+        pool_ptr -> tx_block_pool_available_list =  list_ptr;
+        pool_ptr -> tx_block_pool_available++;
+
+        /* Move to the next block.  */
+        list_ptr =  next_ptr;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Release the remaining blocks one at a time, which gives them to the
+       suspended threads.  */
+    while (list_ptr != TX_NULL)
+    {
+
+        /* Pickup the next block of the list.  */
+        next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(list_ptr);
+        next_ptr =        *next_block_ptr;
+
+        /* Save the pool's address in the block, as for an allocated block.  */
+        temp_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+        *next_block_ptr =  temp_ptr;
+
+        /* Release the block.  */
+        temp_ptr =  TX_UCHAR_POINTER_ADD(list_ptr, (sizeof(UCHAR *)));
+        (VOID) _tx_block_release(temp_ptr);
+
+        /* Move to the next block.  */
+        list_ptr =  next_ptr;
+    }
+}
+#endif
+
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_enable                    PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the maximum number of free blocks that each      */
+/*    core keeps in its private cache of the block pool. Allocations and  */
+/*    releases on a core are then satisfied from its cache without the    */
+/*    global protection, and the cache is refilled from and drained to    */
+/*    the pool in batches of half its depth.                              */
+/*                                                                        */
+/*    A value of zero disables the core caches. When the depth is         */
+/*    reduced, all blocks held by the caches are returned to the pool.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    depth                             Maximum number of blocks in each  */
+/*                                        core cache, zero disables the   */
+/*                                        caches                          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_flush   Return cached blocks to pool      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_block_pool_core_cache_enable Error checking function           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_pool_core_cache_enable(TX_BLOCK_POOL *pool_ptr, UINT depth)
+{
+
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        previous_depth;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_POOL_CORE_CACHE_ENABLE, pool_ptr, depth, TX_POINTER_TO_ULONG_CONVERT(&depth), 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Save the new cache depth.  This is done first so that no more blocks are
+       released to the caches while they are flushed.  */
+    previous_depth =  pool_ptr -> tx_block_pool_core_cache_depth;
+    pool_ptr -> tx_block_pool_core_cache_depth =  depth;
+
+    /* Determine if the cache depth is being reduced.  */
+    if (depth < previous_depth)
+    {
+
+        /* Yes, return all blocks held by the caches to the pool.  */
+        (VOID) _tx_block_pool_core_cache_flush(pool_ptr);
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return successful status.  */
+    return(TX_SUCCESS);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (depth != ((UINT) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
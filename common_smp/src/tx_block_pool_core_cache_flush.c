@@ -0,0 +1,131 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_flush                     PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the blocks of all core caches of the pool to  */
+/*    its available list. It is called with the global protection held.   */
+/*    Caches that are in use by another thread are skipped; that thread   */
+/*    empties its cache when it unlocks it.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to block pool             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    flushed                           Number of blocks returned         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_allocate                Allocate block from pool          */
+/*    _tx_block_allocate_bulk           Bulk block allocate               */
+/*    _tx_block_pool_core_cache_enable  Set core cache depth              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+UINT  _tx_block_pool_core_cache_flush(TX_BLOCK_POOL *pool_ptr)
+{
+
+UINT                        flushed;
+UINT                        core;
+TX_BLOCK_POOL_CORE_CACHE    *cache_ptr;
+UCHAR                       *list_ptr;
+UCHAR                       *next_ptr;
+UCHAR                       **next_block_ptr;
+
+
+    /* Nothing has been flushed yet.  */
+    flushed =  ((UINT) 0);
+
+    /* Return the blocks of the cache of each core.  */
+    for (core =  ((UINT) 0); core < ((UINT) TX_THREAD_SMP_MAX_CORES); core++)
+    {
+
+        /* Lock the cache.  A cache in use is emptied by its user when it is unlocked.  */
+        cache_ptr =  &(pool_ptr -> tx_block_pool_core_cache[core]);
+        if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(cache_ptr -> tx_block_pool_core_cache_lock), TX_NULL, pool_ptr -> tx_block_pool_start) == TX_TRUE)
+        {
+
+            /* Take all of the blocks of the cache.  */
+            list_ptr =  cache_ptr -> tx_block_pool_core_cache_list;
+            flushed =   flushed + cache_ptr -> tx_block_pool_core_cache_count;
+            pool_ptr -> tx_block_pool_available =  pool_ptr -> tx_block_pool_available + cache_ptr -> tx_block_pool_core_cache_count;
+            cache_ptr -> tx_block_pool_core_cache_list =   TX_NULL;
+            cache_ptr -> tx_block_pool_core_cache_count =  ((UINT) 0);
+
+            /* Unlock the cache.  */
+            (VOID) TX_SMP_POINTER_COMPARE_AND_SWAP(&(cache_ptr -> tx_block_pool_core_cache_lock), pool_ptr -> tx_block_pool_start, TX_NULL);
+
+            /* Put the blocks back in the available list.  */
+            while (list_ptr != TX_NULL)
+            {
+
+                /* Pickup the next block of the cache.  */
+                next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(list_ptr);
+                next_ptr =        *next_block_ptr;
+
+                /* Place the block at the front of the available list.  */
+                *next_block_ptr =  pool_ptr -> tx_block_pool_available_list;
+                pool_ptr -> tx_block_pool_available_list =  list_ptr;
+
+                /* Move to the next block.  */
+                list_ptr =  next_ptr;
+            }
+        }
+    }
+
+    /* Return the number of blocks returned to the pool.  */
+    return(flushed);
+}
+#endif
+
@@ -0,0 +1,202 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_performance_info_get      PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the core cache information of the           */
+/*    specified block pool, added up over all cores.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to block pool control     */
+/*                                        block                           */
+/*    hits                              Destination for number of         */
+/*                                        allocations satisfied by the    */
+/*                                        core caches                     */
+/*    refills                           Destination for number of core    */
+/*                                        cache refills from the pool     */
+/*    drains                            Destination for number of core    */
+/*                                        cache drains to the pool        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_pool_core_cache_performance_info_get(TX_BLOCK_POOL *pool_ptr, ULONG *hits, ULONG *refills, ULONG *drains)
+{
+
+#if defined(TX_BLOCK_POOL_ENABLE_CORE_CACHE) && defined(TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO)
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                        status;
+UINT                        core;
+TX_BLOCK_POOL_CORE_CACHE    *cache_ptr;
+ULONG                       hit_count;
+ULONG                       refill_count;
+ULONG                       drain_count;
+
+
+    /* Determine if this is a legal request.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Block pool pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the pool ID is invalid.  */
+    else if (pool_ptr -> tx_block_pool_id != TX_BLOCK_POOL_ID)
+    {
+
+        /* Block pool pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_POOL_CORE_CACHE_PERFORMANCE_INFO_GET, pool_ptr, 0, 0, 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+        /* Add up the counters of the caches of all cores.  */
+        hit_count =     ((ULONG) 0);
+        refill_count =  ((ULONG) 0);
+        drain_count =   ((ULONG) 0);
+        for (core =  ((UINT) 0); core < ((UINT) TX_THREAD_SMP_MAX_CORES); core++)
+        {
+
+            cache_ptr =     &(pool_ptr -> tx_block_pool_core_cache[core]);
+            hit_count =     hit_count + cache_ptr -> tx_block_pool_core_cache_performance_hit_count;
+            refill_count =  refill_count + cache_ptr -> tx_block_pool_core_cache_performance_refill_count;
+            drain_count =   drain_count + cache_ptr -> tx_block_pool_core_cache_performance_drain_count;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Retrieve the number of allocations satisfied by the core caches.  */
+        if (hits != TX_NULL)
+        {
+
+            *hits =  hit_count;
+        }
+
+        /* Retrieve the number of core cache refills from the pool.  */
+        if (refills != TX_NULL)
+        {
+
+            *refills =  refill_count;
+        }
+
+        /* Retrieve the number of core cache drains to the pool.  */
+        if (drains != TX_NULL)
+        {
+
+            *drains =  drain_count;
+        }
+
+        /* Return completion status.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (hits != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (refills != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (drains != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,184 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_release                   PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a released block in the cache of the           */
+/*    executing core without the global protection. When the cache is     */
+/*    full, half of its depth of blocks is first returned to the pool     */
+/*    under a single protection.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_ptr                         Pointer to memory block           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            TX_TRUE if the cache took the     */
+/*                                        block                           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_drain   Return blocks to pool             */
+/*    _tx_block_pool_core_cache_unlock  Unlock core cache                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_release                 Release block to pool             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+UINT  _tx_block_pool_core_cache_release(VOID *block_ptr)
+{
+
+UINT                        status;
+UINT                        drain;
+UINT                        index;
+TX_BLOCK_POOL               *pool_ptr;
+TX_BLOCK_POOL_CORE_CACHE    *cache_ptr;
+UCHAR                       *work_ptr;
+UCHAR                       *list_ptr;
+UCHAR                       *last_ptr;
+UCHAR                       **next_block_ptr;
+
+
+    /* Default to not released to the core cache.  */
+    status =  TX_FALSE;
+
+    /* Pickup the pool pointer which is just previous to the starting
+       address of the block that the caller sees.  */
+    work_ptr =        TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+    work_ptr =        TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+    next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    pool_ptr =        TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT((*next_block_ptr));
+
+    /* Determine if the block can be held by a core cache.  Otherwise it is released
+       to the pool under the global protection.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Let the pool release handle the block.  */
+        cache_ptr =  TX_NULL;
+    }
+    else if (pool_ptr -> tx_block_pool_core_cache_depth == ((UINT) 0))
+    {
+
+        /* The core caches are disabled.  */
+        cache_ptr =  TX_NULL;
+    }
+    else if (pool_ptr -> tx_block_pool_core_cache_bypass != TX_FALSE)
+    {
+
+        /* A thread has found the pool empty and may wait for this block.  */
+        cache_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Pickup the cache of the executing core.  */
+        cache_ptr =  &(pool_ptr -> tx_block_pool_core_cache[TX_SMP_CORE_ID]);
+    }
+
+    /* Determine if the cache can be locked.  If a preempted thread of this core
+       holds the lock, the cache is bypassed.  */
+    if (cache_ptr != TX_NULL)
+    {
+
+        /* Lock the cache.  */
+        if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(cache_ptr -> tx_block_pool_core_cache_lock), TX_NULL, pool_ptr -> tx_block_pool_start) == TX_TRUE)
+        {
+
+            /* Determine if the cache is full.  */
+            if (cache_ptr -> tx_block_pool_core_cache_count >= pool_ptr -> tx_block_pool_core_cache_depth)
+            {
+
+                /* Yes, remove half of the cache depth of blocks from the front of the cache.  */
+                drain =     (pool_ptr -> tx_block_pool_core_cache_depth + ((UINT) 1)) >> 1;
+                list_ptr =  cache_ptr -> tx_block_pool_core_cache_list;
+                last_ptr =  list_ptr;
+                for (index =  ((UINT) 1); index < drain; index++)
+                {
+
+                    /* Move to the next block.  */
+                    next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(last_ptr);
+                    last_ptr =        *next_block_ptr;
+                }
+                next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(last_ptr);
+                cache_ptr -> tx_block_pool_core_cache_list =  *next_block_ptr;
+                *next_block_ptr =  TX_NULL;
+                cache_ptr -> tx_block_pool_core_cache_count =  cache_ptr -> tx_block_pool_core_cache_count - drain;
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of drains of the cache.  */
+                cache_ptr -> tx_block_pool_core_cache_performance_drain_count++;
+#endif
+
+                /* Return these blocks to the pool.  */
+                _tx_block_pool_core_cache_drain(pool_ptr, list_ptr);
+            }
+
+            /* Place the block at the front of the cache.  */
+            next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *next_block_ptr =  cache_ptr -> tx_block_pool_core_cache_list;
+            cache_ptr -> tx_block_pool_core_cache_list =  work_ptr;
+            cache_ptr -> tx_block_pool_core_cache_count++;
+
+            /* Unlock the cache.  */
+            _tx_block_pool_core_cache_unlock(pool_ptr, cache_ptr);
+
+            /* Indicate that the cache took the block.  */
+            status =  TX_TRUE;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
+
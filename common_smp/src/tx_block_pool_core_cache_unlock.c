@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_unlock                    PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function unlocks a core cache. If a thread has found the pool  */
+/*    empty in the meantime, the blocks of the cache are returned to the  */
+/*    pool, since the flush of the core caches by that thread skips       */
+/*    caches that are in use.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to block pool             */
+/*    cache_ptr                         Pointer to locked core cache      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_drain   Return blocks to pool             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_allocate                                  */
+/*                                      Allocate from core cache          */
+/*    _tx_block_pool_core_cache_release Release to core cache             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+VOID  _tx_block_pool_core_cache_unlock(TX_BLOCK_POOL *pool_ptr, TX_BLOCK_POOL_CORE_CACHE *cache_ptr)
+{
+
+UCHAR                       *list_ptr;
+
+
+    /* Unlock the cache.  */
+    (VOID) TX_SMP_POINTER_COMPARE_AND_SWAP(&(cache_ptr -> tx_block_pool_core_cache_lock), pool_ptr -> tx_block_pool_start, TX_NULL);
+
+    /* Determine if a thread has found the pool empty.  Its flush of the core caches
+       may have missed this cache while it was locked.  */
+    if (pool_ptr -> tx_block_pool_core_cache_bypass != TX_FALSE)
+    {
+
+        /* Lock the cache again to empty it.  */
+        if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(cache_ptr -> tx_block_pool_core_cache_lock), TX_NULL, pool_ptr -> tx_block_pool_start) == TX_TRUE)
+        {
+
+            /* Take all of the blocks of the cache.  */
+            list_ptr =  cache_ptr -> tx_block_pool_core_cache_list;
+            cache_ptr -> tx_block_pool_core_cache_list =   TX_NULL;
+            cache_ptr -> tx_block_pool_core_cache_count =  ((UINT) 0);
+
+            /* Unlock the cache.  */
+            (VOID) TX_SMP_POINTER_COMPARE_AND_SWAP(&(cache_ptr -> tx_block_pool_core_cache_lock), pool_ptr -> tx_block_pool_start, TX_NULL);
+
+            /* Determine if there are blocks to return.  */
+            if (list_ptr != TX_NULL)
+            {
+
+                /* Return the blocks to the pool, or to the waiting threads.  */
+                _tx_block_pool_core_cache_drain(pool_ptr, list_ptr);
+            }
+        }
+    }
+}
+#endif
+
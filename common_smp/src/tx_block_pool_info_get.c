@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_block_pool_info_get                             PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -75,6 +75,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added lock-free block pool    */
+/*                                            support, resulting in       */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_block_pool_info_get(TX_BLOCK_POOL *pool_ptr, CHAR **name, ULONG *available_blocks,
@@ -108,7 +111,24 @@ TX_INTERRUPT_SAVE_AREA
     if (available_blocks != TX_NULL)
     {
 
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+        /* Determine if the pool uses the lock-free list.  */
+        if (pool_ptr -> tx_block_pool_lock_free_enabled == TX_TRUE)
+        {
+
+            /* Yes, retrieve the number of blocks on the lock-free list.  */
+            *available_blocks =  pool_ptr -> tx_block_pool_lock_free_available;
+        }
+        else
+        {
+
+            *available_blocks =  (ULONG) pool_ptr -> tx_block_pool_available;
+        }
+#else
+
         *available_blocks =  (ULONG) pool_ptr -> tx_block_pool_available;
+#endif
     }
 
     /* Retrieve the total number of blocks in the block pool.  */
@@ -0,0 +1,261 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_allocate                   PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a block from a pool that uses the lock-     */
+/*    free list. The block is taken from the list without disabling       */
+/*    interrupts. Only if the list is empty and the caller specifies      */
+/*    suspension are interrupts disabled, the pool marked as having       */
+/*    waiting threads, and the calling thread suspended.                  */
+/*                                                                        */
+/*    Trace and performance information are only recorded when the        */
+/*    calling thread must suspend, to keep interrupts enabled on the      */
+/*    path that finds a block.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to place allocated block  */
+/*                                        pointer                         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_pop      Remove block from lock-free list  */
+/*    _tx_thread_system_suspend         Suspend thread                    */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_allocate                Allocate block from pool          */
+/*    _tx_block_allocate_bulk           Bulk block allocate               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+UINT  _tx_block_pool_lock_free_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                        status;
+TX_THREAD                   *thread_ptr;
+UCHAR                       *work_ptr;
+UCHAR                       **return_ptr;
+UINT                        suspended_count;
+TX_THREAD                   *next_thread;
+TX_THREAD                   *previous_thread;
+
+
+    /* Take the block at the head of the lock-free list, without disabling interrupts.  */
+    work_ptr =  _tx_block_pool_lock_free_pop(pool_ptr, TX_FALSE);
+
+    /* Return the block, or NULL, to the caller.  */
+    return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+    *return_ptr =  work_ptr;
+
+    /* Determine if a block was obtained.  */
+    if (work_ptr != TX_NULL)
+    {
+
+        /* Set status to success.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option == TX_NO_WAIT)
+    {
+
+        /* Immediate return, return error completion.  */
+        status =  TX_NO_MEMORY;
+    }
+    else
+    {
+
+        /* Disable interrupts to prepare for suspension.  */
+        TX_DISABLE
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_ALLOCATE, pool_ptr, 0, wait_option, pool_ptr -> tx_block_pool_lock_free_available, TX_TRACE_BLOCK_POOL_EVENTS)
+
+        /* Try the list again.  If it is still empty, the waiting flag is set in the same
+           operation, so a release that follows gives its block to the suspended threads.  */
+        work_ptr =  _tx_block_pool_lock_free_pop(pool_ptr, TX_TRUE);
+
+        /* Determine if a block was released in the meantime.  */
+        if (work_ptr != TX_NULL)
+        {
+
+            /* Yes, return the block to the caller.  */
+            *return_ptr =  work_ptr;
+
+            /* Set status to success.  */
+            status =  TX_SUCCESS;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        else if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point, return error completion.  */
+            status =  TX_NO_MEMORY;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total suspensions counter.  */
+            _tx_block_pool_performance_suspension_count++;
+
+            /* Increment the number of suspensions on this pool.  */
+            pool_ptr -> tx_block_pool_performance_suspension_count++;
+#endif
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_block_pool_cleanup);
+
+            /* Setup cleanup information, i.e. this pool control
+               block.  */
+            thread_ptr -> tx_thread_suspend_control_block =  (VOID *) pool_ptr;
+
+            /* Save the return block pointer address as well.  */
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) block_ptr;
+
+            /* Save the number of blocks requested.  */
+            thread_ptr -> tx_thread_suspend_info =  ((ULONG) 1);
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Pickup the number of suspended threads.  */
+            suspended_count =  (pool_ptr -> tx_block_pool_suspended_count);
+
+            /* Increment the number of suspended threads.  */
+            (pool_ptr -> tx_block_pool_suspended_count)++;
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                pool_ptr -> tx_block_pool_suspension_list =     thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   pool_ptr -> tx_block_pool_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =       TX_BLOCK_MEMORY;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
+
@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_compare_swap               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function replaces the value at the destination with the new    */
+/*    value if it holds the expected value, as one atomic operation. It   */
+/*    is used for TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP by ports that  */
+/*    do not provide an atomic instruction, in which case the swap is     */
+/*    performed with interrupts disabled.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    destination                       Pointer to the value to swap      */
+/*    expected                          Expected value                    */
+/*    new_value                         New value                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Value was replaced                */
+/*    TX_FALSE                          Destination did not hold the      */
+/*                                        expected value                  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_pop      Remove block from lock-free list  */
+/*    _tx_block_pool_lock_free_release  Release block to lock-free list   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+UINT  _tx_block_pool_lock_free_compare_swap(ULONG *destination, ULONG expected, ULONG new_value)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT    status;
+
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the destination holds the expected value.  */
+    if ((*destination) == expected)
+    {
+
+        /* Yes, replace the value.  */
+        *destination =  new_value;
+
+        /* The swap was performed.  */
+        status =  TX_TRUE;
+    }
+    else
+    {
+
+        /* No, the value was changed by another context.  */
+        status =  TX_FALSE;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the swap status.  */
+    return(status);
+}
+#endif
+
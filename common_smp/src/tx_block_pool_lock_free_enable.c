@@ -0,0 +1,236 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_enable                     PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function switches the specified block pool to the lock-free    */
+/*    list, which lets threads and ISRs allocate and release blocks       */
+/*    without disabling interrupts. The blocks are linked by index, and   */
+/*    the head of the list holds the index of the first block, a waiting  */
+/*    flag and a tag in a single ULONG, so the list is changed with a     */
+/*    single compare and swap of the head.                                */
+/*                                                                        */
+/*    The pool must not be in use by other threads or ISRs while this     */
+/*    service is called, which is typically done right after the pool is  */
+/*    created. The pool keeps the lock-free list until it is deleted.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Pool uses the lock-free list      */
+/*    TX_SIZE_ERROR                     Pool has too many blocks to be    */
+/*                                        indexed                         */
+/*    TX_FEATURE_NOT_ENABLED            Lock-free option not compiled in  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_core_cache_flush   Return cached blocks to pool      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_block_pool_lock_free_enable  Error checking function           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_pool_lock_free_enable(TX_BLOCK_POOL *pool_ptr)
+{
+
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+UCHAR               *work_ptr;
+UCHAR               *next_ptr;
+UCHAR               **next_block_ptr;
+ULONG               *next_index_ptr;
+ULONG               block_size;
+ULONG               index;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_POOL_LOCK_FREE_ENABLE, pool_ptr, pool_ptr -> tx_block_pool_available, TX_POINTER_TO_ULONG_CONVERT(&status), 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Determine if the pool already uses the lock-free list.  */
+    if (pool_ptr -> tx_block_pool_lock_free_enabled == TX_TRUE)
+    {
+
+        /* Nothing more to do.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Determine if the blocks of the pool can be indexed in the head of the list.  */
+    else if (((ULONG) pool_ptr -> tx_block_pool_total) > TX_BLOCK_POOL_LOCK_FREE_INDEX_MASK)
+    {
+
+        /* Too many blocks, return appropriate error code.  */
+        status =  TX_SIZE_ERROR;
+    }
+    else
+    {
+
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+
+        /* Determine if the core caches of the pool are enabled.  */
+        if (pool_ptr -> tx_block_pool_core_cache_depth != ((UINT) 0))
+        {
+
+            /* Yes, disable the core caches and return their blocks to the pool, since
+               the lock-free list replaces them.  */
+            pool_ptr -> tx_block_pool_core_cache_depth =  ((UINT) 0);
+            (VOID) _tx_block_pool_core_cache_flush(pool_ptr);
+        }
+#endif
+
+        /* Calculate the distance between the blocks of the pool.  */
+        block_size =  (pool_ptr -> tx_block_pool_block_size) + (sizeof(UCHAR *));
+
+        /* Convert the available list, which links the blocks by address, into the
+           lock-free list, which links the blocks by index.  The index of a block starts
+           at one, so that zero marks the end of the list.  */
+        work_ptr =  pool_ptr -> tx_block_pool_available_list;
+        if (work_ptr == TX_NULL)
+        {
+
+            /* The list is empty.  */
+            index =  ((ULONG) 0);
+        }
+        else
+        {
+
+            /* Calculate the index of the first block.  */
+            index =  (TX_UCHAR_POINTER_DIF(work_ptr, pool_ptr -> tx_block_pool_start) / block_size) + ((ULONG) 1);
+        }
+
+        /* Setup the head of the list.  Threads that are already suspended are served by
+           the next release.  */
+        pool_ptr -> tx_block_pool_lock_free_head =  index;
+        if (pool_ptr -> tx_block_pool_suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            /* Mark the list as having waiting threads.  */
+            pool_ptr -> tx_block_pool_lock_free_head =  index | TX_BLOCK_POOL_LOCK_FREE_WAITING;
+        }
+
+        /* Walk through the available list.  */
+        while (work_ptr != TX_NULL)
+        {
+
+            /* Pickup the next block before its link is replaced.  */
+            next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            next_ptr =  *next_block_ptr;
+
+            /* Calculate the index of the next block.  */
+            if (next_ptr == TX_NULL)
+            {
+
+                /* End of the list.  */
+                index =  ((ULONG) 0);
+            }
+            else
+            {
+
+                /* Calculate the index of the next block.  */
+                index =  (TX_UCHAR_POINTER_DIF(next_ptr, pool_ptr -> tx_block_pool_start) / block_size) + ((ULONG) 1);
+            }
+
+            /* Link the block by index.  */
+            next_index_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(work_ptr);
+            *next_index_ptr =  index;
+
+            /* Move to the next block.  */
+            work_ptr =  next_ptr;
+        }
+
+        /* Move the available blocks to the lock-free list.  */
+        pool_ptr -> tx_block_pool_lock_free_available =  (ULONG) pool_ptr -> tx_block_pool_available;
+        pool_ptr -> tx_block_pool_available =            ((UINT) 0);
+        pool_ptr -> tx_block_pool_available_list =       TX_NULL;
+
+        /* From now on, the pool uses the lock-free list.  */
+        pool_ptr -> tx_block_pool_lock_free_enabled =  TX_TRUE;
+
+        /* Return successful status.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(status);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
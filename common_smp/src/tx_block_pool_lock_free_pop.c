@@ -0,0 +1,191 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Memory                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_pop                        PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the block at the head of the lock-free list   */
+/*    of the pool with a compare and swap of the tagged head, without     */
+/*    disabling interrupts. The tag in the head is advanced by every      */
+/*    change of the list, so a head that was removed and released again   */
+/*    by another context in the meantime does not satisfy the swap.       */
+/*                                                                        */
+/*    If the list is empty and the caller requests it, the waiting flag   */
+/*    is set in the head with the same swap. The caller must have         */
+/*    interrupts disabled in that case.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    set_waiting                       TX_TRUE to set the waiting flag   */
+/*                                        if the list is empty            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    block                             Pointer to block the caller sees, */
+/*                                        NULL if the list is empty       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_compare_swap                               */
+/*                                      Compare and swap, if the port     */
+/*                                        does not provide an atomic      */
+/*                                        operation                       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_allocate Allocate block from lock-free     */
+/*                                        list                            */
+/*    _tx_block_pool_lock_free_release  Release block to lock-free list   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_ENABLE_LOCK_FREE
+UCHAR  *_tx_block_pool_lock_free_pop(TX_BLOCK_POOL *pool_ptr, UINT set_waiting)
+{
+
+UCHAR               *work_ptr;
+UCHAR               *temp_ptr;
+UCHAR               **next_block_ptr;
+ULONG               *next_index_ptr;
+ULONG               head;
+ULONG               new_head;
+ULONG               index;
+ULONG               available;
+UINT                done;
+
+
+    /* Default to no block.  */
+    work_ptr =  TX_NULL;
+
+    /* Loop until the head of the list is replaced or the list is found empty.  */
+    done =  TX_FALSE;
+    do
+    {
+
+        /* Pickup the head of the list.  */
+        head =   pool_ptr -> tx_block_pool_lock_free_head;
+        index =  head & TX_BLOCK_POOL_LOCK_FREE_INDEX_MASK;
+
+        /* Determine if there is a block on the list.  */
+        if (index != ((ULONG) 0))
+        {
+
+            /* Yes, calculate the address of the block from its index.  */
+            work_ptr =  TX_UCHAR_POINTER_ADD(pool_ptr -> tx_block_pool_start,
+                            ((index - ((ULONG) 1)) * ((pool_ptr -> tx_block_pool_block_size) + (sizeof(UCHAR *)))));
+
+            /* Pickup the index of the next block.  If another context takes this block
+               first, the value read is stale but the tag makes the swap below fail.  */
+            next_index_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(work_ptr);
+            new_head =  ((*next_index_ptr) & TX_BLOCK_POOL_LOCK_FREE_INDEX_MASK) |
+                            (head & TX_BLOCK_POOL_LOCK_FREE_WAITING) | TX_BLOCK_POOL_LOCK_FREE_NEXT_TAG(head);
+
+            /* Attempt to make the next block the head of the list.  */
+            if (TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP(&(pool_ptr -> tx_block_pool_lock_free_head), head, new_head) == TX_TRUE)
+            {
+
+                /* The block is now owned by the caller.  */
+                done =  TX_TRUE;
+            }
+            else
+            {
+
+                /* Another context changed the list, try again.  */
+                work_ptr =  TX_NULL;
+            }
+        }
+
+        /* Determine if the list is to be marked as having waiting threads.  */
+        else if (set_waiting == TX_TRUE)
+        {
+
+            /* Mark the empty list, so the next release hands its block to the waiting threads.  */
+            new_head =  TX_BLOCK_POOL_LOCK_FREE_WAITING | TX_BLOCK_POOL_LOCK_FREE_NEXT_TAG(head);
+
+            /* Attempt to set the waiting flag.  */
+            if (TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP(&(pool_ptr -> tx_block_pool_lock_free_head), head, new_head) == TX_TRUE)
+            {
+
+                /* The list is marked.  */
+                done =  TX_TRUE;
+            }
+        }
+        else
+        {
+
+            /* The list is empty.  */
+            done =  TX_TRUE;
+        }
+
+    } while (done == TX_FALSE);
+
+    /* Determine if a block was removed from the list.  */
+    if (work_ptr != TX_NULL)
+    {
+
+        /* Decrement the number of available blocks.  */
+        do
+        {
+
+            /* Pickup the number of available blocks.  */
+            available =  pool_ptr -> tx_block_pool_lock_free_available;
+
+        } while (TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP(&(pool_ptr -> tx_block_pool_lock_free_available), available, (available - ((ULONG) 1))) != TX_TRUE);
+
+        /* Save the pool's address in the block for when it is released!  */
+        next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        temp_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+        *next_block_ptr =  temp_ptr;
+
+        /* Return the address of the block that the caller sees.  */
+        work_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+    }
+
+    /* Return the block pointer.  */
+    return(work_ptr);
+}
+#endif
+
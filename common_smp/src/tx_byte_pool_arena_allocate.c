@@ -0,0 +1,368 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_arena_allocate                        PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates bytes from the arena of the executing       */
+/*    core. The arena is protected by its own lock, so the global         */
+/*    protection is only taken when the arena must be refilled from the   */
+/*    pool or a block must be stolen from the arena of another core.      */
+/*    Blocks released to the arena by other cores are moved to their      */
+/*    classes first.                                                      */
+/*                                                                        */
+/*    If the arena class of the request is empty, several blocks of the   */
+/*    class are allocated from the pool and the remaining ones are        */
+/*    placed in the arena. If the pool is out of memory, a block is       */
+/*    taken from another arena. If none of the arenas holds a suitable    */
+/*    block, their blocks are returned to the pool and the request is     */
+/*    processed by the pool, suspending the thread if requested. Blocks   */
+/*    released until this request is complete bypass the arenas, so that  */
+/*    they are given to the suspended threads.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    memory_ptr                        Pointer to place allocated bytes  */
+/*                                        pointer                         */
+/*    memory_size                       Number of bytes to allocate       */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_allocate_aligned         Allocate aligned bytes of memory  */
+/*    _tx_byte_pool_arena_class_get     Get arena class of block          */
+/*    _tx_byte_pool_arena_flush         Return arena blocks to pool       */
+/*    _tx_byte_pool_arena_steal         Steal block from byte pool arena  */
+/*    _tx_byte_pool_arena_unlock        Unlock byte pool arena            */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_ARENAS
+UINT  _tx_byte_pool_arena_allocate(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+UINT                core;
+UINT                class_index;
+UINT                block_class;
+UINT                refill;
+UINT                bypass;
+ULONG               class_size;
+TX_BYTE_POOL_ARENA  *arena_ptr;
+UCHAR               *block_ptr;
+UCHAR               *list_ptr;
+UCHAR               *next_block_ptr;
+UCHAR               *work_ptr;
+UCHAR               **link_ptr;
+ALIGN_TYPE          *owner_ptr;
+VOID                *refill_ptr;
+
+
+    /* Default to no memory from the arenas.  */
+    block_ptr =  TX_NULL;
+    status =     TX_NO_MEMORY;
+    bypass =     TX_FALSE;
+
+    /* Determine if the request fits in the largest class.  */
+    if (memory_size <= (TX_BYTE_POOL_ARENA_MIN_SIZE << (TX_BYTE_POOL_ARENA_CLASSES - ((UINT) 1))))
+    {
+
+        /* Find the smallest class that holds the requested size.  */
+        class_index =  ((UINT) 0);
+        class_size =   TX_BYTE_POOL_ARENA_MIN_SIZE;
+        while (class_size < memory_size)
+        {
+
+            /* Move to the next class.  */
+            class_index++;
+            class_size =  class_size << 1;
+        }
+
+        /* Pickup the arena of the executing core.  */
+        core =       TX_SMP_CORE_ID;
+        arena_ptr =  &(pool_ptr -> tx_byte_pool_arena[core]);
+
+        /* Lock the arena.  If a preempted thread of this core holds the lock, the arena
+           is bypassed.  */
+        if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), TX_NULL, pool_ptr -> tx_byte_pool_start) == TX_TRUE)
+        {
+
+            /* Take the blocks released to this arena by other cores.  */
+            do
+            {
+
+                list_ptr =  arena_ptr -> tx_byte_pool_arena_deferred_list;
+
+            } while (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_deferred_list), list_ptr, TX_NULL) == TX_FALSE);
+
+            /* Move each of these blocks to its class.  */
+            while (list_ptr != TX_NULL)
+            {
+
+                /* Pickup the next deferred block.  */
+                work_ptr =        TX_UCHAR_POINTER_ADD(list_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                link_ptr =        TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                next_block_ptr =  *link_ptr;
+
+                /* Link the block to the front of its class.  */
+                block_class =  _tx_byte_pool_arena_class_get(pool_ptr, list_ptr, &owner_ptr);
+                *link_ptr =    arena_ptr -> tx_byte_pool_arena_list[block_class];
+                arena_ptr -> tx_byte_pool_arena_list[block_class] =  list_ptr;
+                arena_ptr -> tx_byte_pool_arena_count[block_class]++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of blocks released to this arena by other cores.  */
+                arena_ptr -> tx_byte_pool_arena_performance_remote_release_count++;
+#endif
+
+                /* Move to the next deferred block.  */
+                list_ptr =  next_block_ptr;
+            }
+
+            /* Pickup the first block of the class.  */
+            block_ptr =  arena_ptr -> tx_byte_pool_arena_list[class_index];
+
+            /* Determine if the class has a block.  */
+            if (block_ptr != TX_NULL)
+            {
+
+                /* Yes, remove the block from the class.  */
+                work_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                arena_ptr -> tx_byte_pool_arena_list[class_index] =  *link_ptr;
+                arena_ptr -> tx_byte_pool_arena_count[class_index]--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of allocations satisfied by this arena.  */
+                arena_ptr -> tx_byte_pool_arena_performance_hit_count++;
+#endif
+            }
+
+            /* Unlock the arena.  */
+            _tx_byte_pool_arena_unlock(pool_ptr, arena_ptr);
+        }
+
+        /* Determine if the arena was empty.  */
+        if (block_ptr == TX_NULL)
+        {
+
+            /* Yes, refill the arena from the pool.  Each block has room for the owner word
+               after the memory of its class, and the first block satisfies this request.  */
+            list_ptr =  TX_NULL;
+            refill =    ((UINT) 0);
+            while (refill < TX_BYTE_POOL_ARENA_REFILL_COUNT)
+            {
+
+                /* Allocate a block from the pool without suspension.  */
+                status =  _tx_byte_allocate_aligned(pool_ptr, &refill_ptr, (class_size + (sizeof(ALIGN_TYPE))), ((ULONG) 0), TX_NO_WAIT);
+                if (status == TX_SUCCESS)
+                {
+
+                    /* Pickup the block header.  */
+                    work_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(refill_ptr);
+                    work_ptr =  TX_UCHAR_POINTER_SUB(work_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+
+                    /* Determine if this is the block for this request.  */
+                    if (block_ptr == TX_NULL)
+                    {
+
+                        /* Yes, save the block.  */
+                        block_ptr =  work_ptr;
+                    }
+                    else
+                    {
+
+                        /* No, link the block to the list of blocks for the arena.  */
+                        link_ptr =   TX_VOID_TO_INDIRECT_UCHAR_POINTER_CONVERT(refill_ptr);
+                        *link_ptr =  list_ptr;
+                        list_ptr =   work_ptr;
+                    }
+
+                    /* Move to the next block.  */
+                    refill++;
+                }
+                else
+                {
+
+                    /* The pool is out of memory, stop the refill.  */
+                    refill =  TX_BYTE_POOL_ARENA_REFILL_COUNT;
+                }
+            }
+
+            /* Determine if there are blocks for the arena.  */
+            if (list_ptr != TX_NULL)
+            {
+
+                /* Lock the arena.  */
+                if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), TX_NULL, pool_ptr -> tx_byte_pool_start) == TX_TRUE)
+                {
+
+                    /* Move each block to its class.  */
+                    while (list_ptr != TX_NULL)
+                    {
+
+                        /* Pickup the next block.  */
+                        work_ptr =        TX_UCHAR_POINTER_ADD(list_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                        link_ptr =        TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                        next_block_ptr =  *link_ptr;
+
+                        /* Mark this core as the owner and link the block to the front of its class.  */
+                        block_class =  _tx_byte_pool_arena_class_get(pool_ptr, list_ptr, &owner_ptr);
+                        *owner_ptr =   (ALIGN_TYPE) core;
+                        *link_ptr =    arena_ptr -> tx_byte_pool_arena_list[block_class];
+                        arena_ptr -> tx_byte_pool_arena_list[block_class] =  list_ptr;
+                        arena_ptr -> tx_byte_pool_arena_count[block_class]++;
+
+                        /* Move to the next block.  */
+                        list_ptr =  next_block_ptr;
+                    }
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                    /* Increment the number of refills of this arena.  */
+                    arena_ptr -> tx_byte_pool_arena_performance_refill_count++;
+#endif
+
+                    /* Unlock the arena.  */
+                    _tx_byte_pool_arena_unlock(pool_ptr, arena_ptr);
+                }
+                else
+                {
+
+                    /* The arena is in use by a preempted thread, return the blocks to the pool.  */
+                    while (list_ptr != TX_NULL)
+                    {
+
+                        /* Pickup the next block.  */
+                        work_ptr =        TX_UCHAR_POINTER_ADD(list_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                        link_ptr =        TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                        next_block_ptr =  *link_ptr;
+
+                        /* Release the block.  */
+                        (VOID) _tx_byte_release(work_ptr);
+
+                        /* Move to the next block.  */
+                        list_ptr =  next_block_ptr;
+                    }
+                }
+            }
+        }
+
+        /* Determine if the pool is out of memory.  */
+        if (block_ptr == TX_NULL)
+        {
+
+            /* Yes, take a block from the arena of another core.  If none of the arenas holds
+               a block of the class, return all blocks held by the arenas to the pool so that
+               they can be merged.  Released blocks bypass the arenas from before the flush
+               until this allocation is complete, so that a block released while this thread
+               is about to suspend reaches the suspension list.  */
+            TX_DISABLE
+            block_ptr =  _tx_byte_pool_arena_steal(pool_ptr, core, class_index);
+            if (block_ptr == TX_NULL)
+            {
+
+                pool_ptr -> tx_byte_pool_arena_bypass++;
+                bypass =  TX_TRUE;
+                (VOID) _tx_byte_pool_arena_flush(pool_ptr);
+            }
+            TX_RESTORE
+        }
+
+        /* Determine if a block was found.  */
+        if (block_ptr != TX_NULL)
+        {
+
+            /* Mark the executing core as the owner of the block.  */
+            (VOID) _tx_byte_pool_arena_class_get(pool_ptr, block_ptr, &owner_ptr);
+            *owner_ptr =  (ALIGN_TYPE) core;
+
+            /* Return the memory of the block.  */
+            work_ptr =     TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+            *memory_ptr =  (VOID *) work_ptr;
+
+            /* Set the status to success.  */
+            status =  TX_SUCCESS;
+        }
+    }
+
+    /* Determine if the arenas could not satisfy the request.  */
+    if (block_ptr == TX_NULL)
+    {
+
+        /* Allocate the memory from the pool, suspending if requested.  */
+        status =  _tx_byte_allocate_aligned(pool_ptr, memory_ptr, memory_size, ((ULONG) 0), wait_option);
+
+        /* Determine if released blocks bypass the arenas for this allocation.  */
+        if ((bypass == TX_TRUE) && (status != TX_DELETED))
+        {
+
+            /* Yes, the allocation is complete. Any thread still waiting keeps
+               the released blocks from the arenas through the suspended count.  */
+            TX_DISABLE
+            pool_ptr -> tx_byte_pool_arena_bypass--;
+            TX_RESTORE
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
+
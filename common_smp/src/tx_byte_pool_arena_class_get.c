@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_arena_class_get                       PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the arena class of an allocated block, which  */
+/*    is the largest class whose size fits in the block's memory in       */
+/*    front of its last word. The last word holds the index of the core   */
+/*    that owns the block while it is allocated from an arena, and its    */
+/*    address is returned as well.                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to allocated block        */
+/*    owner_ptr                         Destination for the address of the*/
+/*                                        owner word                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    class_index                       Class of the block, or            */
+/*                                        TX_BYTE_POOL_ARENA_CLASSES if   */
+/*                                        the block does not fit any class*/
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_arena_allocate      Allocate from byte pool arena     */
+/*    _tx_byte_pool_arena_release       Release to byte pool arena        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_ARENAS
+UINT  _tx_byte_pool_arena_class_get(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr, ALIGN_TYPE **owner_ptr)
+{
+
+UINT            class_index;
+UCHAR           *end_ptr;
+UCHAR           **block_link_ptr;
+ULONG           block_size;
+ULONG           class_size;
+
+
+    /* Pickup the end of the block's memory, which is the start of the next block.  */
+    block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    end_ptr =         *block_link_ptr;
+
+    /* Determine if the pool uses boundary tags.  */
+    if (pool_ptr -> tx_byte_pool_policy != TX_BYTE_POOL_FIRST_FIT)
+    {
+
+        /* Yes, the memory ends at the boundary tag that precedes the next block.  */
+        end_ptr =  TX_UCHAR_POINTER_SUB(end_ptr, (sizeof(UCHAR *)));
+    }
+
+    /* The owning core is held in the last word of the block's memory.  */
+    end_ptr =     TX_UCHAR_POINTER_SUB(end_ptr, (sizeof(ALIGN_TYPE)));
+    *owner_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(end_ptr);
+
+    /* Calculate the number of usable bytes in front of the owner word.  */
+    block_size =  TX_UCHAR_POINTER_DIF(end_ptr, block_ptr);
+    block_size =  block_size - ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
+
+    /* Default to a block that does not fit any class.  */
+    class_index =  TX_BYTE_POOL_ARENA_CLASSES;
+
+    /* Determine if the block fits one of the classes.  */
+    if (block_size >= TX_BYTE_POOL_ARENA_MIN_SIZE)
+    {
+
+        if (block_size < (TX_BYTE_POOL_ARENA_MIN_SIZE << TX_BYTE_POOL_ARENA_CLASSES))
+        {
+
+            /* Find the largest class whose size the block can hold.  */
+            class_index =  ((UINT) 0);
+            class_size =   TX_BYTE_POOL_ARENA_MIN_SIZE << 1;
+            while (class_size <= block_size)
+            {
+
+                /* Move to the next class.  */
+                class_index++;
+                class_size =  class_size << 1;
+            }
+        }
+    }
+
+    /* Return the class of the block.  */
+    return(class_index);
+}
+#endif
+
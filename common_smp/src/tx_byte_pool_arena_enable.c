@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_arena_enable                          PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the maximum number of blocks that the per-core   */
+/*    arenas of the byte pool hold in each size class. Allocations of     */
+/*    blocks that fit a class are then satisfied from the arena of the    */
+/*    executing core without the global protection, and released blocks   */
+/*    are returned to the arena of the core that allocated them.          */
+/*                                                                        */
+/*    A value of zero disables the arenas. When the number is reduced,    */
+/*    all blocks held by the arenas are returned to the pool. Arenas      */
+/*    should be enabled or disabled while no other core is using the      */
+/*    pool.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    blocks_per_class                  Maximum number of blocks in each  */
+/*                                        class of an arena, zero disables*/
+/*                                        the arenas                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_arena_flush         Return arena blocks to pool       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_byte_pool_arena_enable       Error checking function           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_arena_enable(TX_BYTE_POOL *pool_ptr, UINT blocks_per_class)
+{
+
+#ifdef TX_BYTE_POOL_ENABLE_ARENAS
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        previous_depth;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_POOL_ARENA_ENABLE, pool_ptr, blocks_per_class, TX_POINTER_TO_ULONG_CONVERT(&blocks_per_class), 0, TX_TRACE_BYTE_POOL_EVENTS)
+
+    /* Save the new arena depth.  This is done first so that no more blocks are
+       released to the arenas while they are flushed.  */
+    previous_depth =  pool_ptr -> tx_byte_pool_arena_depth;
+    pool_ptr -> tx_byte_pool_arena_depth =  blocks_per_class;
+
+    /* Determine if the arena depth is being reduced.  */
+    if (blocks_per_class < previous_depth)
+    {
+
+        /* Yes, return all blocks held by the arenas to the pool.  */
+        (VOID) _tx_byte_pool_arena_flush(pool_ptr);
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return successful status.  */
+    return(TX_SUCCESS);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (blocks_per_class != ((UINT) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
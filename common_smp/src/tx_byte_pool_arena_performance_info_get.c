@@ -0,0 +1,222 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_arena_performance_info_get            PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the per-core arena information of the       */
+/*    specified byte pool, added up over all cores.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to byte pool control block*/
+/*    hits                              Destination for number of         */
+/*                                        allocations satisfied by the    */
+/*                                        arenas                          */
+/*    refills                           Destination for number of arena   */
+/*                                        refills from the pool           */
+/*    steals                            Destination for number of blocks  */
+/*                                        taken from the arena of another */
+/*                                        core                            */
+/*    remote_releases                   Destination for number of blocks  */
+/*                                        released to the arena of another*/
+/*                                        core                            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_arena_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *hits, ULONG *refills,
+                                                ULONG *steals, ULONG *remote_releases)
+{
+
+#if defined(TX_BYTE_POOL_ENABLE_ARENAS) && defined(TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO)
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+UINT                core;
+TX_BYTE_POOL_ARENA  *arena_ptr;
+ULONG               hit_count;
+ULONG               refill_count;
+ULONG               steal_count;
+ULONG               remote_release_count;
+
+
+    /* Determine if this is a legal request.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Byte pool pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the pool ID is invalid.  */
+    else if (pool_ptr -> tx_byte_pool_id != TX_BYTE_POOL_ID)
+    {
+
+        /* Byte pool pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_POOL_ARENA_PERFORMANCE_INFO_GET, pool_ptr, 0, 0, 0, TX_TRACE_BYTE_POOL_EVENTS)
+
+        /* Add up the counters of the arenas of all cores.  */
+        hit_count =             ((ULONG) 0);
+        refill_count =          ((ULONG) 0);
+        steal_count =           ((ULONG) 0);
+        remote_release_count =  ((ULONG) 0);
+        for (core =  ((UINT) 0); core < ((UINT) TX_THREAD_SMP_MAX_CORES); core++)
+        {
+
+            arena_ptr =             &(pool_ptr -> tx_byte_pool_arena[core]);
+            hit_count =             hit_count + arena_ptr -> tx_byte_pool_arena_performance_hit_count;
+            refill_count =          refill_count + arena_ptr -> tx_byte_pool_arena_performance_refill_count;
+            steal_count =           steal_count + arena_ptr -> tx_byte_pool_arena_performance_steal_count;
+            remote_release_count =  remote_release_count + arena_ptr -> tx_byte_pool_arena_performance_remote_release_count;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Retrieve the number of allocations satisfied by the arenas.  */
+        if (hits != TX_NULL)
+        {
+
+            *hits =  hit_count;
+        }
+
+        /* Retrieve the number of arena refills from the pool.  */
+        if (refills != TX_NULL)
+        {
+
+            *refills =  refill_count;
+        }
+
+        /* Retrieve the number of blocks taken from the arena of another core.  */
+        if (steals != TX_NULL)
+        {
+
+            *steals =  steal_count;
+        }
+
+        /* Retrieve the number of blocks released to the arena of another core.  */
+        if (remote_releases != TX_NULL)
+        {
+
+            *remote_releases =  remote_release_count;
+        }
+
+        /* Return completion status.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (hits != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (refills != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (steals != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (remote_releases != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
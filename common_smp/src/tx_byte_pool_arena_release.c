@@ -0,0 +1,249 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_arena_release                         PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function attempts to release a block to the per-core arena     */
+/*    that owns it, without the global protection. A block owned by the   */
+/*    executing core is placed on its class in the arena if the class     */
+/*    has room. A block owned by another core is placed on the deferred   */
+/*    list of that core's arena with a compare and swap, so that the      */
+/*    arena lock is never taken by another core.                          */
+/*                                                                        */
+/*    If the pool has no arenas, threads are waiting for memory or have   */
+/*    found the pool empty, or the block does not fit a class, the block  */
+/*    is not released and the caller releases it to the pool.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    memory_ptr                        Pointer to allocated memory       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Block was released to an arena    */
+/*    TX_FALSE                          Block must be released to the pool*/
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_arena_class_get     Get arena class of block          */
+/*    _tx_byte_pool_arena_unlock        Unlock byte pool arena            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_ARENAS
+UINT  _tx_byte_pool_arena_release(VOID *memory_ptr)
+{
+
+UINT                status;
+UINT                core;
+UINT                owner_core;
+UINT                class_index;
+TX_BYTE_POOL        *pool_ptr;
+TX_BYTE_POOL_ARENA  *arena_ptr;
+UCHAR               *block_ptr;
+UCHAR               *work_ptr;
+UCHAR               *head_ptr;
+UCHAR               **link_ptr;
+ALIGN_TYPE          *free_ptr;
+ALIGN_TYPE          *owner_ptr;
+TX_BYTE_POOL        **byte_pool_ptr;
+
+
+    /* Default to not released to an arena.  */
+    status =  TX_FALSE;
+
+    /* Set the pool pointer to NULL.  */
+    pool_ptr =  TX_NULL;
+
+    /* Determine if the memory pointer is valid.  */
+    block_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(memory_ptr);
+    if (block_ptr != TX_NULL)
+    {
+
+        /* Back off the memory pointer to pickup its header.  */
+        block_ptr =  TX_UCHAR_POINTER_SUB(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+
+        /* Determine if the block is allocated.  */
+        work_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+        free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+        if ((*free_ptr) != TX_BYTE_BLOCK_FREE)
+        {
+
+            /* Pickup the pool pointer.  */
+            byte_pool_ptr =  TX_UCHAR_TO_INDIRECT_BYTE_POOL_POINTER(work_ptr);
+            pool_ptr =       *byte_pool_ptr;
+        }
+    }
+
+    /* Determine if the block can be held by an arena.  Otherwise it is released to the
+       pool under the global protection.  */
+    class_index =  TX_BYTE_POOL_ARENA_CLASSES;
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Determine if the pool is valid, has arenas and no threads are waiting for memory.  */
+        if (pool_ptr -> tx_byte_pool_id != TX_BYTE_POOL_ID)
+        {
+
+            /* Let the pool release report the error.  */
+            pool_ptr =  TX_NULL;
+        }
+        else if (pool_ptr -> tx_byte_pool_arena_depth == ((UINT) 0))
+        {
+
+            /* The arenas are disabled.  */
+            pool_ptr =  TX_NULL;
+        }
+        else if (pool_ptr -> tx_byte_pool_suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            /* The memory must be given to the waiting threads.  */
+            pool_ptr =  TX_NULL;
+        }
+        else if (pool_ptr -> tx_byte_pool_arena_bypass != ((UINT) 0))
+        {
+
+            /* A thread has found the pool empty and may wait for this memory.  */
+            pool_ptr =  TX_NULL;
+        }
+        else
+        {
+
+            /* Pickup the class of the block and the address of its owner word.  */
+            class_index =  _tx_byte_pool_arena_class_get(pool_ptr, block_ptr, &owner_ptr);
+        }
+    }
+
+    /* Determine if the block fits one of the classes.  */
+    if (class_index < TX_BYTE_POOL_ARENA_CLASSES)
+    {
+
+        /* Pickup the executing core and the core that owns the block.  */
+        core =        TX_SMP_CORE_ID;
+        owner_core =  (UINT) (*owner_ptr);
+
+        /* A block that was not allocated from an arena belongs to the executing core.  */
+        if (owner_core >= ((UINT) TX_THREAD_SMP_MAX_CORES))
+        {
+
+            owner_core =  core;
+        }
+
+        /* Pickup the arena of the owning core.  */
+        arena_ptr =  &(pool_ptr -> tx_byte_pool_arena[owner_core]);
+
+        /* The link to the next block is held in the first word of the block's memory.  */
+        work_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+        link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+
+        /* Determine if the block belongs to the executing core.  */
+        if (owner_core == core)
+        {
+
+            /* Yes, lock the arena.  If a preempted thread of this core holds the lock,
+               the block is released to the pool instead.  */
+            if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), TX_NULL, pool_ptr -> tx_byte_pool_start) == TX_TRUE)
+            {
+
+                /* Determine if the class has room for another block.  */
+                if (arena_ptr -> tx_byte_pool_arena_count[class_index] < pool_ptr -> tx_byte_pool_arena_depth)
+                {
+
+                    /* Yes, link the block to the front of the class.  */
+                    *link_ptr =  arena_ptr -> tx_byte_pool_arena_list[class_index];
+                    arena_ptr -> tx_byte_pool_arena_list[class_index] =  block_ptr;
+                    arena_ptr -> tx_byte_pool_arena_count[class_index]++;
+
+                    /* The block is now held by the arena.  */
+                    status =  TX_TRUE;
+                }
+
+                /* Unlock the arena.  */
+                _tx_byte_pool_arena_unlock(pool_ptr, arena_ptr);
+            }
+        }
+        else
+        {
+
+            /* No, place the block on the deferred list of the owning arena. The owning core
+               moves it to its class on the next allocation from the arena.  */
+            do
+            {
+
+                /* Link the block in front of the current list.  */
+                head_ptr =   arena_ptr -> tx_byte_pool_arena_deferred_list;
+                *link_ptr =  head_ptr;
+
+            } while (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_deferred_list), head_ptr, block_ptr) == TX_FALSE);
+
+            /* The block is now held by the arena.  */
+            status =  TX_TRUE;
+
+            /* Determine if a thread has found the pool empty since the check above.
+               Its flush of the arenas may have run before the block was placed.  */
+            if (pool_ptr -> tx_byte_pool_arena_bypass != ((UINT) 0))
+            {
+
+                /* Empty the arena, unless it is in use. In that case it is emptied
+                   when it is unlocked.  */
+                if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), TX_NULL, pool_ptr -> tx_byte_pool_start) == TX_TRUE)
+                {
+
+                    _tx_byte_pool_arena_unlock(pool_ptr, arena_ptr);
+                }
+            }
+        }
+    }
+
+    /* Return the released status.  */
+    return(status);
+}
+#endif
+
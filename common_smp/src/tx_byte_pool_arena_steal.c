@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_arena_steal                           PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function takes a block of the requested class, or of a larger  */
+/*    class, from the arena of another core. It is used when the arena    */
+/*    of the executing core is empty and the pool cannot supply the       */
+/*    memory. Arenas that are in use by their own core are skipped.       */
+/*                                                                        */
+/*    This function must be called with interrupts disabled, so that      */
+/*    only one core steals blocks at a time.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    core                              Executing core                    */
+/*    class_index                       Smallest class that holds the     */
+/*                                        request                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    block_ptr                         Pointer to stolen block or NULL   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_arena_allocate      Allocate from byte pool arena     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_ARENAS
+UCHAR  *_tx_byte_pool_arena_steal(TX_BYTE_POOL *pool_ptr, UINT core, UINT class_index)
+{
+
+UINT                victim_core;
+UINT                victim_class;
+UINT                cores_checked;
+TX_BYTE_POOL_ARENA  *arena_ptr;
+UCHAR               *block_ptr;
+UCHAR               *work_ptr;
+UCHAR               **link_ptr;
+
+
+    /* Default to no block found.  */
+    block_ptr =  TX_NULL;
+
+    /* Start with the arena of the next core.  */
+    victim_core =    core;
+    cores_checked =  ((UINT) 1);
+    while (cores_checked < ((UINT) TX_THREAD_SMP_MAX_CORES))
+    {
+
+        /* Move to the next core.  */
+        victim_core++;
+        if (victim_core >= ((UINT) TX_THREAD_SMP_MAX_CORES))
+        {
+
+            victim_core =  ((UINT) 0);
+        }
+        cores_checked++;
+
+        /* Lock the arena of this core. An arena that is in use is skipped.  */
+        arena_ptr =  &(pool_ptr -> tx_byte_pool_arena[victim_core]);
+        if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), TX_NULL, pool_ptr -> tx_byte_pool_start) == TX_TRUE)
+        {
+
+            /* Look for a block in the requested class or a larger one.  */
+            victim_class =  class_index;
+            while (victim_class < TX_BYTE_POOL_ARENA_CLASSES)
+            {
+
+                /* Pickup the first block of the class.  */
+                block_ptr =  arena_ptr -> tx_byte_pool_arena_list[victim_class];
+                if (block_ptr != TX_NULL)
+                {
+
+                    /* Remove the block from the class.  */
+                    work_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                    link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                    arena_ptr -> tx_byte_pool_arena_list[victim_class] =  *link_ptr;
+                    arena_ptr -> tx_byte_pool_arena_count[victim_class]--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                    /* Increment the number of blocks taken from this arena.  */
+                    arena_ptr -> tx_byte_pool_arena_performance_steal_count++;
+#endif
+
+                    /* Stop looking.  */
+                    victim_class =   TX_BYTE_POOL_ARENA_CLASSES;
+                    cores_checked =  ((UINT) TX_THREAD_SMP_MAX_CORES);
+                }
+                else
+                {
+
+                    /* Move to the next class.  */
+                    victim_class++;
+                }
+            }
+
+            /* Unlock the arena.  */
+            (VOID) TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), pool_ptr -> tx_byte_pool_start, TX_NULL);
+        }
+    }
+
+    /* Return the stolen block.  */
+    return(block_ptr);
+}
+#endif
+
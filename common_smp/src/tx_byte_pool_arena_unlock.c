@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_arena_unlock                          PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function unlocks a per-core arena of the byte pool. If a       */
+/*    thread has found the pool empty in the meantime, the blocks of the  */
+/*    arena, including the blocks on its deferred list, are returned to   */
+/*    the pool, since the flush of the arenas by that thread skips        */
+/*    arenas that are in use.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    arena_ptr                         Pointer to locked arena           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_arena_allocate      Allocate from byte pool arena     */
+/*    _tx_byte_pool_arena_release       Return block to per-core arena    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_ARENAS
+VOID  _tx_byte_pool_arena_unlock(TX_BYTE_POOL *pool_ptr, TX_BYTE_POOL_ARENA *arena_ptr)
+{
+
+UINT                class_index;
+UCHAR               *release_list;
+UCHAR               *block_ptr;
+UCHAR               *next_block_ptr;
+UCHAR               *work_ptr;
+UCHAR               **link_ptr;
+
+
+    /* Unlock the arena.  */
+    (VOID) TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), pool_ptr -> tx_byte_pool_start, TX_NULL);
+
+    /* Determine if a thread has found the pool empty.  Its flush of the arenas may
+       have missed this arena while it was locked.  */
+    if (pool_ptr -> tx_byte_pool_arena_bypass != ((UINT) 0))
+    {
+
+        /* Lock the arena again to empty it.  */
+        if (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), TX_NULL, pool_ptr -> tx_byte_pool_start) == TX_TRUE)
+        {
+
+            /* Take the blocks released to this arena by other cores.  */
+            do
+            {
+
+                release_list =  arena_ptr -> tx_byte_pool_arena_deferred_list;
+
+            } while (TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_deferred_list), release_list, TX_NULL) == TX_FALSE);
+
+            /* Move the blocks of each class to the release list.  */
+            for (class_index =  ((UINT) 0); class_index < TX_BYTE_POOL_ARENA_CLASSES; class_index++)
+            {
+
+                block_ptr =  arena_ptr -> tx_byte_pool_arena_list[class_index];
+                while (block_ptr != TX_NULL)
+                {
+
+                    /* Pickup the next block of the class and link the block to the release list.  */
+                    work_ptr =        TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                    link_ptr =        TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                    next_block_ptr =  *link_ptr;
+                    *link_ptr =       release_list;
+                    release_list =    block_ptr;
+                    block_ptr =       next_block_ptr;
+                }
+
+                /* The class is now empty.  */
+                arena_ptr -> tx_byte_pool_arena_list[class_index] =   TX_NULL;
+                arena_ptr -> tx_byte_pool_arena_count[class_index] =  ((UINT) 0);
+            }
+
+            /* Unlock the arena.  */
+            (VOID) TX_SMP_POINTER_COMPARE_AND_SWAP(&(arena_ptr -> tx_byte_pool_arena_lock), pool_ptr -> tx_byte_pool_start, TX_NULL);
+
+            /* Return each block to the pool, or to the waiting threads.  */
+            block_ptr =  release_list;
+            while (block_ptr != TX_NULL)
+            {
+
+                /* Pickup the next block before the block is released.  */
+                work_ptr =        TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                link_ptr =        TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                next_block_ptr =  *link_ptr;
+
+                /* Release the block.  */
+                (VOID) _tx_byte_release(work_ptr);
+
+                /* Move to the next block.  */
+                block_ptr =  next_block_ptr;
+            }
+        }
+    }
+}
+#endif
+
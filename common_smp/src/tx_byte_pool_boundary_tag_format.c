@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_boundary_tag_format                   PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds the blocks of a byte pool that uses boundary   */
+/*    tags, i.e. a pointer to the physically previous block in front of   */
+/*    each block header. Initially, the specified area of the pool        */
+/*    contains one large free block followed by the small allocated       */
+/*    block at the end of the pool that is there just for the algorithm.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    area_ptr                          Start of the area to format       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_create_ex           Create byte pool with policy      */
+/*    _tx_byte_pool_tlsf_create         Build TLSF pool memory area       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_boundary_tag_format(TX_BYTE_POOL *pool_ptr, UCHAR *area_ptr)
+{
+
+UCHAR               *work_ptr;
+UCHAR               *block_ptr;
+UCHAR               *end_ptr;
+UCHAR               **block_link_ptr;
+ALIGN_TYPE          *free_ptr;
+
+
+    /* Each block is preceded by a pointer to the physically previous block, followed by a
+       "next" pointer that points to the next block in the pool and an ALIGN_TYPE field that
+       contains either the constant TX_BYTE_BLOCK_FREE (if the block is free) or a pointer to
+       the owning pool (if the block is allocated). The block pointer itself points at the
+       "next" pointer so that the layout seen by the application matches the first-fit format.  */
+
+    /* Setup the large available block at the start of the area.  It has no previous block.  */
+    block_link_ptr =       TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(area_ptr);
+    *block_link_ptr =      TX_NULL;
+    block_ptr =            TX_UCHAR_POINTER_ADD(area_ptr, (sizeof(UCHAR *)));
+
+    /* Calculate the end of the pool's memory area and build the pre-allocated block.  */
+    end_ptr =              TX_UCHAR_POINTER_ADD(pool_ptr -> tx_byte_pool_start, pool_ptr -> tx_byte_pool_size);
+    end_ptr =              TX_UCHAR_POINTER_SUB(end_ptr, (sizeof(ALIGN_TYPE)));
+    work_ptr =             TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+    block_link_ptr =       TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(end_ptr);
+    *block_link_ptr =      work_ptr;
+    end_ptr =              TX_UCHAR_POINTER_SUB(end_ptr, (sizeof(UCHAR *)));
+    block_link_ptr =       TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(end_ptr);
+    *block_link_ptr =      block_ptr;
+    work_ptr =             TX_UCHAR_POINTER_SUB(end_ptr, (sizeof(UCHAR *)));
+    block_link_ptr =       TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *block_link_ptr =      block_ptr;
+
+    /* Link the available block to the pre-allocated block and mark it free.  */
+    block_link_ptr =       TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    *block_link_ptr =      end_ptr;
+    work_ptr =             TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+    free_ptr =             TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    *free_ptr =            TX_BYTE_BLOCK_FREE;
+
+    /* Setup memory list to the beginning as well as the search pointer.  */
+    pool_ptr -> tx_byte_pool_list =    block_ptr;
+    pool_ptr -> tx_byte_pool_search =  block_ptr;
+
+    /* Initially, the pool will have two blocks.  Be sure to count the available
+       block's header in the available bytes count.  */
+    pool_ptr -> tx_byte_pool_available =   TX_UCHAR_POINTER_DIF(end_ptr, block_ptr);
+    pool_ptr -> tx_byte_pool_fragments =   ((UINT) 2);
+}
+
@@ -0,0 +1,131 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_boundary_tag_split                    PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function splits a block of a pool that uses boundary tags,     */
+/*    i.e. the TLSF and coalescing first-fit policies, at the specified   */
+/*    offset. The new block starts out free and its boundary tags are     */
+/*    linked to the original block and to the block that follows. The     */
+/*    caller is responsible for placing the new block in a free index,    */
+/*    if the pool has one.                                                */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled or with the pool owned by the caller.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to block to split         */
+/*    offset                            Offset of the new block           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    UCHAR *                           Pointer to the new block          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_coalesce_search     Search coalescing pool for memory */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_boundary_tag_split(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr, ULONG offset)
+{
+
+UCHAR           *split_ptr;
+UCHAR           *next_ptr;
+UCHAR           *work_ptr;
+UCHAR           **this_block_link_ptr;
+UCHAR           **next_block_link_ptr;
+ALIGN_TYPE      *free_ptr;
+
+
+    /* Pickup the block that follows the block to split.  */
+    this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    next_ptr =             *this_block_link_ptr;
+
+    /* Calculate the address of the new block.  */
+    split_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, offset);
+
+    /* Setup the new block, which starts out free.  */
+    next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(split_ptr);
+    *next_block_link_ptr =  next_ptr;
+    work_ptr =              TX_UCHAR_POINTER_SUB(split_ptr, (sizeof(UCHAR *)));
+    next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *next_block_link_ptr =  block_ptr;
+    work_ptr =              TX_UCHAR_POINTER_ADD(split_ptr, (sizeof(UCHAR *)));
+    free_ptr =              TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    *free_ptr =             TX_BYTE_BLOCK_FREE;
+
+    /* Update the previous block pointer of the following block.  */
+    work_ptr =              TX_UCHAR_POINTER_SUB(next_ptr, (sizeof(UCHAR *)));
+    next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *next_block_link_ptr =  split_ptr;
+
+    /* Update the original block to end at the new block.  */
+    *this_block_link_ptr =  split_ptr;
+
+    /* Increase the total fragment counter.  */
+    pool_ptr -> tx_byte_pool_fragments++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total split counter.  */
+    _tx_byte_pool_performance_split_count++;
+
+    /* Increment the number of blocks split on this pool.  */
+    pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+
+    /* Return the new block.  */
+    return(split_ptr);
+}
+
@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_cache_enable                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the number of released blocks the byte pool may  */
+/*    hold in each class of its size-class cache. Allocations that fit a  */
+/*    class holding a block are satisfied without searching the pool. A   */
+/*    value of zero disables the cache. Whenever the depth is reduced,    */
+/*    all cached blocks are returned to the pool.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    blocks_per_class                  Maximum number of cached blocks in*/
+/*                                        each class, zero disables the   */
+/*                                        cache                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_cache_flush         Return cached blocks to the pool  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_cache_enable(TX_BYTE_POOL *pool_ptr, UINT blocks_per_class)
+{
+
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_POOL_CACHE_ENABLE, pool_ptr, blocks_per_class, TX_POINTER_TO_ULONG_CONVERT(&blocks_per_class), 0, TX_TRACE_BYTE_POOL_EVENTS)
+
+    /* Determine if the cache depth is being reduced.  */
+    if (blocks_per_class < pool_ptr -> tx_byte_pool_cache_depth)
+    {
+
+        /* Yes, return all cached blocks to the pool.  */
+        (VOID) _tx_byte_pool_cache_flush(pool_ptr);
+    }
+
+    /* Save the new cache depth.  */
+    pool_ptr -> tx_byte_pool_cache_depth =  blocks_per_class;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return successful status.  */
+    return(TX_SUCCESS);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (blocks_per_class != ((UINT) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,155 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_cache_get                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function attempts to satisfy an allocation request from the    */
+/*    size-class cache of the byte pool. If the request fits in one of    */
+/*    the cache classes and that class holds a block, the block is        */
+/*    removed from the class and returned. Otherwise, the requested size  */
+/*    is rounded up to the size of its class so that the block            */
+/*    eventually allocated from the pool can be cached when it is         */
+/*    released.                                                           */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    memory_size_ptr                   Pointer to the requested number of*/
+/*                                        bytes                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    memory_ptr                        Pointer to cached memory or NULL  */
+/*                                        if the cache could not satisfy  */
+/*                                        the request                     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+UCHAR  *_tx_byte_pool_cache_get(TX_BYTE_POOL *pool_ptr, ULONG *memory_size_ptr)
+{
+
+UCHAR           *memory_ptr;
+UCHAR           *block_ptr;
+UCHAR           *work_ptr;
+UCHAR           **cache_link_ptr;
+ULONG           class_size;
+UINT            class_index;
+
+
+    /* Default to no memory from the cache.  */
+    memory_ptr =  TX_NULL;
+
+    /* Determine if the cache is enabled and the request fits in the largest class.  */
+    if (pool_ptr -> tx_byte_pool_cache_depth != ((UINT) 0))
+    {
+
+        if ((*memory_size_ptr) <= (TX_BYTE_POOL_CACHE_MIN_SIZE << (TX_BYTE_POOL_CACHE_CLASSES - ((UINT) 1))))
+        {
+
+            /* Find the smallest class that holds the requested size.  */
+            class_index =  ((UINT) 0);
+            class_size =   TX_BYTE_POOL_CACHE_MIN_SIZE;
+            while (class_size < (*memory_size_ptr))
+            {
+
+                /* Move to the next class.  */
+                class_index++;
+                class_size =  class_size << 1;
+            }
+
+            /* Pickup the first block of the class.  */
+            block_ptr =  pool_ptr -> tx_byte_pool_cache_list[class_index];
+
+            /* Determine if the class has a block.  */
+            if (block_ptr != TX_NULL)
+            {
+
+                /* Yes, remove the block from the class. The link to the next cached
+                   block is held in the first word of the block's memory.  */
+                memory_ptr =      TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                cache_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(memory_ptr);
+                work_ptr =        *cache_link_ptr;
+                pool_ptr -> tx_byte_pool_cache_list[class_index] =  work_ptr;
+                pool_ptr -> tx_byte_pool_cache_count[class_index]--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of cache hits on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_cache_hit_count++;
+#endif
+            }
+            else
+            {
+
+                /* No, round the request up to the class size so the block can
+                   be cached when it is released.  */
+                *memory_size_ptr =  class_size;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of cache misses on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_cache_miss_count++;
+#endif
+            }
+        }
+    }
+
+    /* Return the cached memory pointer.  */
+    return(memory_ptr);
+}
+#endif
+
@@ -0,0 +1,192 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+#include "tx_trace.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_cache_performance_info_get            PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the size-class cache performance            */
+/*    information of the specified byte pool.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to byte pool control block*/
+/*    hits                              Destination for number of         */
+/*                                        allocations satisfied by the    */
+/*                                        cache                           */
+/*    misses                            Destination for number of         */
+/*                                        cacheable allocations that      */
+/*                                        searched the pool               */
+/*    cached_blocks                     Destination for number of blocks  */
+/*                                        currently held in the cache     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_cache_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *hits, ULONG *misses, ULONG *cached_blocks)
+{
+
+#if defined(TX_BYTE_POOL_ENABLE_CACHE) && defined(TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO)
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+UINT        class_index;
+ULONG       count;
+
+
+    /* Determine if this is a legal request.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Byte pool pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the pool ID is invalid.  */
+    else if (pool_ptr -> tx_byte_pool_id != TX_BYTE_POOL_ID)
+    {
+
+        /* Byte pool pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_POOL_CACHE_PERFORMANCE_INFO_GET, pool_ptr, 0, 0, 0, TX_TRACE_BYTE_POOL_EVENTS)
+
+        /* Retrieve the number of cache hits on this byte pool.  */
+        if (hits != TX_NULL)
+        {
+
+            *hits =  pool_ptr -> tx_byte_pool_performance_cache_hit_count;
+        }
+
+        /* Retrieve the number of cache misses on this byte pool.  */
+        if (misses != TX_NULL)
+        {
+
+            *misses =  pool_ptr -> tx_byte_pool_performance_cache_miss_count;
+        }
+
+        /* Retrieve the number of blocks held in the cache.  */
+        if (cached_blocks != TX_NULL)
+        {
+
+            count =  ((ULONG) 0);
+            for (class_index =  ((UINT) 0); class_index < TX_BYTE_POOL_CACHE_CLASSES; class_index++)
+            {
+
+                count =  count + ((ULONG) pool_ptr -> tx_byte_pool_cache_count[class_index]);
+            }
+            *cached_blocks =  count;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return completion status.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (hits != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (misses != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (cached_blocks != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
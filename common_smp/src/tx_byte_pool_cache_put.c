@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_cache_put                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function attempts to place a released block in the size-class  */
+/*    cache of the byte pool instead of returning it to the pool. The     */
+/*    block is placed in the largest class whose size it can hold.        */
+/*    Cached blocks remain allocated from the pool's point of view, so    */
+/*    the physical block list is not modified. Blocks are not cached      */
+/*    while threads are suspended on the pool, since those threads are    */
+/*    waiting for released memory.                                        */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the header of the      */
+/*                                        released block                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            TX_TRUE if the block was cached,  */
+/*                                        TX_FALSE otherwise              */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes back to the pool    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_CACHE
+UINT  _tx_byte_pool_cache_put(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UINT            status;
+UCHAR           *work_ptr;
+UCHAR           **block_link_ptr;
+UCHAR           **cache_link_ptr;
+ULONG           block_size;
+ULONG           class_size;
+UINT            class_index;
+
+
+    /* Default to not cached.  */
+    status =  TX_FALSE;
+
+    /* Determine if the cache is enabled and no threads are waiting for memory.  */
+    if (pool_ptr -> tx_byte_pool_cache_depth != ((UINT) 0))
+    {
+
+        if (pool_ptr -> tx_byte_pool_suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* Calculate the number of usable bytes in the block.  */
+            block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+            work_ptr =        *block_link_ptr;
+            block_size =      TX_UCHAR_POINTER_DIF(work_ptr, block_ptr);
+            if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT)
+            {
+
+                /* Remove the size of the block header.  */
+                block_size =  block_size - ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
+            }
+            else
+            {
+
+                /* Remove the size of the block header, including the boundary tag
+                   that precedes the next block.  */
+                block_size =  block_size - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+            }
+
+            /* Determine if the block fits one of the classes.  */
+            if (block_size >= TX_BYTE_POOL_CACHE_MIN_SIZE)
+            {
+
+                if (block_size < (TX_BYTE_POOL_CACHE_MIN_SIZE << TX_BYTE_POOL_CACHE_CLASSES))
+                {
+
+                    /* Find the largest class whose size the block can hold.  */
+                    class_index =  ((UINT) 0);
+                    class_size =   TX_BYTE_POOL_CACHE_MIN_SIZE << 1;
+                    while (class_size <= block_size)
+                    {
+
+                        /* Move to the next class.  */
+                        class_index++;
+                        class_size =  class_size << 1;
+                    }
+
+                    /* Determine if the class has room for another block.  */
+                    if (pool_ptr -> tx_byte_pool_cache_count[class_index] < pool_ptr -> tx_byte_pool_cache_depth)
+                    {
+
+                        /* Yes, link the block to the front of the class.  */
+                        work_ptr =         TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                        cache_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                        *cache_link_ptr =  pool_ptr -> tx_byte_pool_cache_list[class_index];
+                        pool_ptr -> tx_byte_pool_cache_list[class_index] =  block_ptr;
+                        pool_ptr -> tx_byte_pool_cache_count[class_index]++;
+
+                        /* The block is now cached.  */
+                        status =  TX_TRUE;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Return the cached status.  */
+    return(status);
+}
+#endif
+
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_byte_pool_cleanup                               PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -59,6 +59,8 @@
 /*                                                                        */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_byte_pool_waiter_remove       Remove thread from size-class     */
+/*                                        list                            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -73,6 +75,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added size-class waiter       */
+/*                                            lists, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_byte_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence)
@@ -161,6 +166,9 @@ TX_THREAD           *previous_thread;
                             }
                         }
 
+                        /* Remove the thread from the list of the size class of its request.  */
+                        _tx_byte_pool_waiter_remove(pool_ptr, thread_ptr);
+
                         /* Now we need to determine if this cleanup is from a terminate, timeout,
                            or from a wait abort.  */
                         if (thread_ptr -> tx_thread_state == TX_BYTE_MEMORY)
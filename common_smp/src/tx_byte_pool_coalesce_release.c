@@ -0,0 +1,199 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_coalesce_release                      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a block to a byte pool that uses the          */
+/*    coalescing first-fit policy. The boundary tags in front of each     */
+/*    block are used to merge the block with its physical neighbors in    */
+/*    constant time if they are free, so free blocks are never adjacent   */
+/*    and the number of fragments in the pool stays small.                */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to block to release       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    block_ptr                         Pointer to the resulting free     */
+/*                                        block                           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_coalesce_release(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR               *next_ptr;
+UCHAR               *previous_ptr;
+UCHAR               *work_ptr;
+UCHAR               **this_block_link_ptr;
+UCHAR               **next_block_link_ptr;
+ALIGN_TYPE          *free_ptr;
+
+
+    /* Mark the block as free.  */
+    work_ptr =   TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+    free_ptr =   TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    *free_ptr =  TX_BYTE_BLOCK_FREE;
+
+    /* Update the number of available bytes in the pool.  */
+    this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    next_ptr =             *this_block_link_ptr;
+    pool_ptr -> tx_byte_pool_available =
+        pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_ptr, block_ptr);
+
+    /* Determine if the following block is free.  The block at the end of the pool
+       is always allocated, so this never wraps.  */
+    work_ptr =  TX_UCHAR_POINTER_ADD(next_ptr, (sizeof(UCHAR *)));
+    free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+    {
+
+        /* Yes, see if the search pointer is affected.  */
+        if (pool_ptr -> tx_byte_pool_search == next_ptr)
+        {
+
+            /* Yes, move the search pointer to the merged block.  */
+            pool_ptr -> tx_byte_pool_search =  block_ptr;
+        }
+
+        /* Remove the following block from the fragmentation information.  */
+        TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, next_ptr)
+
+        /* Merge the following block into this block.  */
+        next_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
+        next_ptr =             *next_block_link_ptr;
+        *this_block_link_ptr = next_ptr;
+
+        /* Update the previous block pointer of the following block.  */
+        work_ptr =              TX_UCHAR_POINTER_SUB(next_ptr, (sizeof(UCHAR *)));
+        next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *next_block_link_ptr =  block_ptr;
+
+        /* Reduce the fragment total.  */
+        pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total merge counter.  */
+        _tx_byte_pool_performance_merge_count++;
+
+        /* Increment the number of blocks merged on this pool.  */
+        pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+    }
+
+    /* Pickup the previous block.  */
+    work_ptr =             TX_UCHAR_POINTER_SUB(block_ptr, (sizeof(UCHAR *)));
+    next_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    previous_ptr =         *next_block_link_ptr;
+
+    /* Determine if there is a previous block.  */
+    if (previous_ptr != TX_NULL)
+    {
+
+        /* Determine if the previous block is free.  */
+        work_ptr =  TX_UCHAR_POINTER_ADD(previous_ptr, (sizeof(UCHAR *)));
+        free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+        if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+        {
+
+            /* Remove the previous block from the fragmentation information.  */
+            TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, previous_ptr)
+
+            /* Yes, merge this block into the previous block.  */
+            next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(previous_ptr);
+            *next_block_link_ptr =  next_ptr;
+
+            /* Update the previous block pointer of the following block.  */
+            work_ptr =              TX_UCHAR_POINTER_SUB(next_ptr, (sizeof(UCHAR *)));
+            next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *next_block_link_ptr =  previous_ptr;
+
+            /* The merged block starts at the previous block.  */
+            block_ptr =  previous_ptr;
+
+            /* Reduce the fragment total.  */
+            pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total merge counter.  */
+            _tx_byte_pool_performance_merge_count++;
+
+            /* Increment the number of blocks merged on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+        }
+    }
+
+    /* Add the resulting free block to the fragmentation information.  */
+    TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, block_ptr)
+
+    /* Determine if the free block is prior to current search pointer.  */
+    if (block_ptr < (pool_ptr -> tx_byte_pool_search))
+    {
+
+        /* Yes, update the search pointer to the released block.  */
+        pool_ptr -> tx_byte_pool_search =  block_ptr;
+    }
+
+    /* Return the resulting free block.  */
+    return(block_ptr);
+}
+
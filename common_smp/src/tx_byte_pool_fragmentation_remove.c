@@ -0,0 +1,156 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_fragmentation_remove                  PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a free block from the free block size         */
+/*    histogram, the number of free bytes and the largest free block of   */
+/*    the byte pool. It is called before a free block is allocated, and   */
+/*    before the size of a free block changes in a split or merge.        */
+/*                                                                        */
+/*    Once the last free block of the largest size is removed, the        */
+/*    largest free block is lowered to the smallest size of the largest   */
+/*    non-empty size class, which is examined in a bounded number of      */
+/*    steps.                                                              */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled or with the pool owned by the caller.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to free block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_coalesce_release    Release block to coalescing pool  */
+/*    _tx_byte_pool_coalesce_search     Search coalescing pool for memory */
+/*    _tx_byte_pool_search              Search byte pool for memory       */
+/*    _tx_byte_pool_tlsf_block_remove   Remove block from TLSF index      */
+/*    _tx_byte_reallocate               Reallocate bytes of memory        */
+/*    _tx_byte_reallocate               Reallocate bytes of memory        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BYTE_POOL_ENABLE_FRAGMENTATION_INFO
+VOID  _tx_byte_pool_fragmentation_remove(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR       **block_link_ptr;
+ULONG       block_size;
+ULONG       size_bits;
+UINT        size_class;
+
+
+    /* Calculate the number of bytes in the free block.  */
+    block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    block_size =      TX_UCHAR_POINTER_DIF(*block_link_ptr, block_ptr);
+    if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT)
+    {
+
+        /* Blocks have a "next" pointer and an owner field.  */
+        block_size =  block_size - ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
+    }
+    else
+    {
+
+        /* Blocks also have a pointer to the previous block.  */
+        block_size =  block_size - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+    }
+
+    /* Remove the block from its size class.  */
+    TX_BYTE_POOL_FRAGMENTATION_CLASS_CALCULATE(block_size, size_bits, size_class)
+    pool_ptr -> tx_byte_pool_fragmentation_histogram[size_class]--;
+
+    /* Remove the bytes of the block from the free bytes.  */
+    pool_ptr -> tx_byte_pool_fragmentation_free_bytes =  pool_ptr -> tx_byte_pool_fragmentation_free_bytes - block_size;
+
+    /* Determine if this is one of the free blocks of the largest size.  */
+    if ((block_size == pool_ptr -> tx_byte_pool_fragmentation_largest) &&
+        (pool_ptr -> tx_byte_pool_fragmentation_largest_count != ((ULONG) 0)))
+    {
+
+        /* Yes, one less free block of the largest size.  */
+        pool_ptr -> tx_byte_pool_fragmentation_largest_count--;
+    }
+
+    /* Determine if the size of the largest free block is no longer known.  */
+    if (pool_ptr -> tx_byte_pool_fragmentation_largest_count == ((ULONG) 0))
+    {
+
+        /* Lower the size to the smallest size of the largest non-empty class, which
+           is the largest size known to be available.  */
+        pool_ptr -> tx_byte_pool_fragmentation_largest =  ((ULONG) 0);
+        size_class =  TX_BYTE_POOL_FRAGMENTATION_CLASSES;
+        while (size_class > ((UINT) 1))
+        {
+
+            /* Move to the next smaller class.  */
+            size_class--;
+
+            /* Determine if there are free blocks in this class.  */
+            if (pool_ptr -> tx_byte_pool_fragmentation_histogram[size_class] != ((ULONG) 0))
+            {
+
+                /* Yes, this is the largest non-empty class.  */
+                pool_ptr -> tx_byte_pool_fragmentation_largest =  ((ULONG) 1) << (size_class + TX_BYTE_POOL_FRAGMENTATION_CLASS_SHIFT);
+
+                /* Stop looking.  */
+                size_class =  ((UINT) 1);
+            }
+        }
+    }
+}
+#endif
+
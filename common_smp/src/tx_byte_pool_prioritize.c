@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_byte_pool_prioritize                           PORTABLE C       */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -45,7 +45,8 @@
 /*                                                                        */
 /*    This function places the highest priority suspended thread at the   */
 /*    front of the suspension list.  All other threads remain in the same */
-/*    FIFO suspension order.                                              */
+/*    FIFO suspension order.  The thread is also placed at the front of   */
+/*    the list of the size class of its request.                          */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -58,6 +59,9 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_byte_pool_waiter_insert       Add thread to size-class list     */
+/*    _tx_byte_pool_waiter_remove       Remove thread from size-class     */
+/*                                        list                            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -70,6 +74,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added size-class waiter       */
+/*                                            lists, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_byte_pool_prioritize(TX_BYTE_POOL *pool_ptr)
@@ -84,6 +91,8 @@ UINT            suspended_count;
 TX_THREAD       *next_thread;
 TX_THREAD       *previous_thread;
 UINT            list_changed;
+ULONG           size_bit;
+UINT            size_class;
 
 
     /* Disable interrupts.  */
@@ -120,6 +129,15 @@ UINT            list_changed;
 
             /* Yes, move the list head to the next thread.  */
             pool_ptr -> tx_byte_pool_suspension_list =  next_thread;
+
+            /* Move the thread to the front of the list of its size class.  */
+            _tx_byte_pool_waiter_remove(pool_ptr, next_thread);
+            _tx_byte_pool_waiter_insert(pool_ptr, next_thread);
+            TX_BYTE_POOL_SIZE_BIT_CALCULATE(next_thread -> tx_thread_suspend_info, size_bit, size_class)
+            pool_ptr -> tx_byte_pool_suspended_class_list[size_class] =  next_thread;
+
+            /* Stamp the thread ahead of the previous list head.  */
+            next_thread -> tx_thread_suspended_class_stamp =  head_ptr -> tx_thread_suspended_class_stamp - ((ULONG) 1);
         }
 
         /* Restore interrupts.  */
@@ -236,6 +254,15 @@ UINT            list_changed;
 
             /* Move the list head pointer to the highest priority suspended thread.  */
             pool_ptr -> tx_byte_pool_suspension_list =  priority_thread_ptr;
+
+            /* Move the thread to the front of the list of its size class.  */
+            _tx_byte_pool_waiter_remove(pool_ptr, priority_thread_ptr);
+            _tx_byte_pool_waiter_insert(pool_ptr, priority_thread_ptr);
+            TX_BYTE_POOL_SIZE_BIT_CALCULATE(priority_thread_ptr -> tx_thread_suspend_info, size_bit, size_class)
+            pool_ptr -> tx_byte_pool_suspended_class_list[size_class] =  priority_thread_ptr;
+
+            /* Stamp the thread ahead of the previous list head.  */
+            priority_thread_ptr -> tx_thread_suspended_class_stamp =  head_ptr -> tx_thread_suspended_class_stamp - ((ULONG) 1);
         }
 
         /* Restore interrupts.  */
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_byte_pool_search                               PORTABLE SMP     */
-/*                                                           6.1.7        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -46,16 +46,28 @@
 /*    the requested number of bytes.  Merging of adjacent free blocks     */
 /*    takes place during the search and a split of the block that         */
 /*    satisfies the request may occur before this function returns.       */
+/*    If an alignment is specified, the leading space needed to align the */
+/*    memory is split off and left in the pool as a free block.           */
 /*                                                                        */
 /*    It is assumed that this function is called with interrupts enabled  */
 /*    and with the tx_pool_owner field set to the thread performing the   */
 /*    search.  Also note that the search can occur during allocation and  */
 /*    release of a memory block.                                          */
 /*                                                                        */
+/*    If TX_BYTE_POOL_SEARCH_RESTART_LIMIT is defined, the restarts are   */
+/*    counted across all searches of one allocation or release. Once the  */
+/*    count reaches the limit, the protection is held for the remainder   */
+/*    of the search.                                                      */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    pool_ptr                          Pointer to pool control block     */
 /*    memory_size                       Number of bytes required          */
+/*    alignment                         Required alignment of the memory, */
+/*                                        zero for the default alignment  */
+/*    restart_count_ptr                 Pointer to the number of restarts */
+/*                                        of the earlier searches of the  */
+/*                                        caller, updated on return       */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -81,9 +93,15 @@
 /*                                            calculation, and reduced    */
 /*                                            number of search resets,    */
 /*                                            resulting in version 6.1.7  */
+/*  xx-xx-xxxx      Microsoft Corporation   Added bounded search restart  */
+/*                                            limit and search counters,  */
+/*                                            added aligned allocation,   */
+/*                                            added fragmentation         */
+/*                                            information, resulting in   */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
-UCHAR  *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size)
+UCHAR  *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment, UINT *restart_count_ptr)
 {
 
 TX_INTERRUPT_SAVE_AREA
@@ -93,11 +111,18 @@ UCHAR           *next_ptr;
 UCHAR           **this_block_link_ptr;
 UCHAR           **next_block_link_ptr;
 ULONG           available_bytes;
+ULONG           aligned_offset =  ((ULONG) 0);
 UINT            examine_blocks;
 UINT            first_free_block_found =  TX_FALSE;
 TX_THREAD       *thread_ptr;
 ALIGN_TYPE      *free_ptr;
 UCHAR           *work_ptr;
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+UINT            restart_count =  ((UINT) 0);
+#endif
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+ULONG           blocks_examined =  ((ULONG) 0);
+#endif
 volatile ULONG  delay_count;
 ULONG           total_theoretical_available;
 #ifdef TX_BYTE_POOL_MULTIPLE_BLOCK_SEARCH
@@ -105,6 +130,12 @@ UINT            blocks_searched =  ((UINT) 0);
 #endif
 
 
+#ifndef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+    /* The number of restarts is only kept when the searches are bounded.  */
+    TX_PARAMETER_NOT_USED(restart_count_ptr);
+#endif
+
     /* Disable interrupts.  */
     TX_DISABLE
 
@@ -129,6 +160,14 @@ UINT            blocks_searched =  ((UINT) 0);
         /* Setup ownership of the byte pool.  */
         pool_ptr -> tx_byte_pool_owner =  thread_ptr;
 
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+        /* Pickup the number of restarts of the earlier searches of the caller, so that
+           the limit applies to the whole allocation or release.  If it has been reached,
+           the protection is held for the entire search.  */
+        restart_count =  *restart_count_ptr;
+#endif
+
         /* Walk through the memory pool in search for a large enough block.  */
         current_ptr =      pool_ptr -> tx_byte_pool_search;
         examine_blocks =   pool_ptr -> tx_byte_pool_fragments + ((UINT) 1);
@@ -144,6 +183,9 @@ UINT            blocks_searched =  ((UINT) 0);
 
             /* Increment the number of fragments searched on this pool.  */
             pool_ptr -> tx_byte_pool_performance_search_count++;
+
+            /* Increment the number of blocks examined by this search.  */
+            blocks_examined++;
 #endif
 
             /* Check to see if this block is free.  */
@@ -173,9 +215,16 @@ UINT            blocks_searched =  ((UINT) 0);
                 available_bytes =   TX_UCHAR_POINTER_DIF(next_ptr, current_ptr);
                 available_bytes =   available_bytes - ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
 
+                /* Determine how far into this block the memory must start to meet the alignment.  */
+                if (alignment != ((ULONG) 0))
+                {
+
+                    TX_BYTE_POOL_ALIGNED_OFFSET_CALCULATE(current_ptr, alignment, ((ULONG) TX_BYTE_BLOCK_MIN), aligned_offset)
+                }
+
                 /* If this is large enough, we are done because our first-fit algorithm
                    has been satisfied!  */
-                if (available_bytes >= memory_size)
+                if (available_bytes >= (memory_size + aligned_offset))
                 {
                     /* Get out of the search loop!  */
                     break;
@@ -195,8 +244,11 @@ UINT            blocks_searched =  ((UINT) 0);
 
                         /* Yes, neighbor block can be merged!  This is quickly accomplished
                            by updating the current block with the next blocks pointer.  */
+                        TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, current_ptr)
+                        TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, next_ptr)
                         next_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
                         *this_block_link_ptr =  *next_block_link_ptr;
+                        TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, current_ptr)
 
                         /* Reduce the fragment total.  We don't need to increase the bytes
                            available because all free headers are also included in the available
@@ -237,6 +289,9 @@ UINT            blocks_searched =  ((UINT) 0);
 
                             /* Increment the number of fragments searched on this pool.  */
                             pool_ptr -> tx_byte_pool_performance_search_count++;
+
+                            /* Increment the number of blocks examined by this search.  */
+                            blocks_examined++;
 #endif
                         }
                     }
@@ -257,6 +312,14 @@ UINT            blocks_searched =  ((UINT) 0);
                 examine_blocks--;
             }
 
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+            /* Determine if the search has been restarted too many times.  If so, the protection
+               is held for the remainder of the search so that no other thread can take over the
+               pool, and each remaining block is examined at most once.  */
+            if (restart_count < ((UINT) TX_BYTE_POOL_SEARCH_RESTART_LIMIT))
+            {
+#endif
 #ifdef TX_BYTE_POOL_MULTIPLE_BLOCK_SEARCH
 
             /* When this is enabled, multiple blocks are searched while holding the protection.  */
@@ -285,6 +348,9 @@ UINT            blocks_searched =  ((UINT) 0);
 
             /* Disable interrupts.  */
             TX_DISABLE
+#endif
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+            }
 #endif
             /* Determine if anything has changed in terms of pool ownership.  */
             if (pool_ptr -> tx_byte_pool_owner != thread_ptr)
@@ -309,14 +375,70 @@ UINT            blocks_searched =  ((UINT) 0);
 
                 /* Setup our ownership again.  */
                 pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the number of search restarts on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_search_restart_count++;
+#endif
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+                /* Increment the number of restarts of this search.  */
+                restart_count++;
+#endif
             }
         } while(examine_blocks != ((UINT) 0));
 
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Update the maximum number of blocks examined by a single search of this pool.  */
+        if (blocks_examined > pool_ptr -> tx_byte_pool_performance_search_max_count)
+        {
+
+            pool_ptr -> tx_byte_pool_performance_search_max_count =  blocks_examined;
+        }
+#endif
+
         /* Determine if a block was found.  If so, determine if it needs to be
            split.  */
         if (available_bytes != ((ULONG) 0))
         {
 
+            /* Remove the block from the fragmentation information.  */
+            TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, current_ptr)
+
+            /* Determine if the memory must start further into the block to meet the alignment.  */
+            if (aligned_offset != ((ULONG) 0))
+            {
+
+                /* Yes, split the leading space off as a free block.  */
+                next_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, aligned_offset);
+
+                /* Setup the new block, which is the block to allocate.  */
+                next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
+                this_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+                *next_block_link_ptr =  *this_block_link_ptr;
+                *this_block_link_ptr =  next_ptr;
+                TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, current_ptr)
+
+                /* Increase the total fragment counter.  */
+                pool_ptr -> tx_byte_pool_fragments++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total split counter.  */
+                _tx_byte_pool_performance_split_count++;
+
+                /* Increment the number of blocks split on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+
+                /* The leading block remains free, continue with the aligned block.  */
+                current_ptr =      next_ptr;
+                available_bytes =  available_bytes - aligned_offset;
+            }
+
             /* Determine if we need to split this block.  */
             if ((available_bytes - memory_size) >= ((ULONG) TX_BYTE_BLOCK_MIN))
             {
@@ -337,6 +459,7 @@ UINT            blocks_searched =  ((UINT) 0);
 
                 /* Update the current pointer to point at the newly created block.  */
                 *this_block_link_ptr =  next_ptr;
+                TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, next_ptr)
 
                 /* Set available equal to memory size for subsequent calculation.  */
                 available_bytes =  memory_size;
@@ -384,6 +507,12 @@ UINT            blocks_searched =  ((UINT) 0);
             /* Set current pointer to NULL to indicate nothing was found.  */
             current_ptr =  TX_NULL;
         }
+
+#ifdef TX_BYTE_POOL_SEARCH_RESTART_LIMIT
+
+        /* Return the number of restarts to the caller.  */
+        *restart_count_ptr =  restart_count;
+#endif
     }
 
     /* Return the search pointer.  */
@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_block_insert                     PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a free block at the front of the TLSF free     */
+/*    list that matches its size and marks the list as non-empty in the   */
+/*    first and second-level bitmaps.                                     */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to free block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_mapping        Calculate TLSF size class         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_create         Build TLSF pool memory area       */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
+/*    _tx_byte_pool_tlsf_release        Release TLSF block                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_block_insert(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+TX_BYTE_POOL_TLSF_INDEX *tlsf_ptr;
+UCHAR                   *work_ptr;
+UCHAR                   *head_ptr;
+UCHAR                   **block_link_ptr;
+ULONG                   block_size;
+UINT                    fl;
+UINT                    sl;
+UINT                    list_index;
+
+
+    /* Add the block to the fragmentation information.  */
+    TX_BYTE_POOL_FRAGMENTATION_INSERT(pool_ptr, block_ptr)
+
+    /* Pickup the TLSF index.  */
+    tlsf_ptr =  pool_ptr -> tx_byte_pool_tlsf;
+
+    /* Calculate the number of bytes available in this block.  */
+    block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    block_size =      TX_UCHAR_POINTER_DIF(*block_link_ptr, block_ptr);
+    block_size =      block_size - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+
+    /* Find the list for this block.  */
+    _tx_byte_pool_tlsf_mapping(block_size, &fl, &sl);
+    list_index =  (fl * TX_BYTE_POOL_TLSF_SL_INDEX_COUNT) + sl;
+    head_ptr =    tlsf_ptr -> tx_byte_pool_tlsf_free_list[list_index];
+
+    /* The free list links are kept in the memory area of the free block.  Setup the
+       next free pointer to the current head of the list.  */
+    work_ptr =         TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+    block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *block_link_ptr =  head_ptr;
+
+    /* Setup the previous free pointer.  */
+    work_ptr =         TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+    block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *block_link_ptr =  TX_NULL;
+
+    /* Determine if the list is empty.  */
+    if (head_ptr != TX_NULL)
+    {
+
+        /* Update the previous free pointer of the old head.  */
+        work_ptr =         TX_UCHAR_POINTER_ADD(head_ptr, (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))) + (sizeof(UCHAR *))));
+        block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *block_link_ptr =  block_ptr;
+    }
+
+    /* Place the block at the front of the list.  */
+    tlsf_ptr -> tx_byte_pool_tlsf_free_list[list_index] =  block_ptr;
+
+    /* Mark the list as non-empty.  */
+    tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap =      tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap | (((ULONG) 1) << fl);
+    tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[fl] =  tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[fl] | (((ULONG) 1) << sl);
+}
+
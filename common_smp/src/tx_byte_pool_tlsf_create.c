@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_create                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds the memory area of a byte pool that uses the   */
+/*    two-level segregated fit (TLSF) policy. The TLSF index is placed    */
+/*    at the start of the pool area, followed by one large free block     */
+/*    and the small allocated block at the end of the pool that is there  */
+/*    just for the algorithm.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_boundary_tag_format Build blocks with boundary tags   */
+/*    _tx_byte_pool_tlsf_block_insert   Insert block into TLSF index      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_create_ex           Create byte pool with policy      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_create(TX_BYTE_POOL *pool_ptr)
+{
+
+TX_BYTE_POOL_TLSF_INDEX *tlsf_ptr;
+UCHAR                   *work_ptr;
+UCHAR                   **free_list;
+ULONG                   *sl_bitmap;
+ULONG                   size_bits;
+ULONG                   index_size;
+UINT                    fl_count;
+UINT                    msb;
+UINT                    i;
+
+
+    /* Determine the number of first-level ranges needed to index the largest
+       possible block in this pool.  */
+    if (pool_ptr -> tx_byte_pool_size < TX_BYTE_POOL_TLSF_SMALL_BLOCK_SIZE)
+    {
+
+        /* Only the range of small blocks is required.  */
+        fl_count =  ((UINT) 1);
+    }
+    else
+    {
+
+        /* Calculate the range of the pool size.  */
+        size_bits =  pool_ptr -> tx_byte_pool_size;
+        TX_HIGHEST_SET_BIT_CALCULATE(size_bits, msb)
+        fl_count =  (msb - TX_BYTE_POOL_TLSF_FL_INDEX_SHIFT) + ((UINT) 2);
+    }
+
+    /* Calculate the size of the TLSF index, which consists of the index structure
+       followed by the free list heads and the second-level bitmaps.  */
+    index_size =  (ULONG) (sizeof(TX_BYTE_POOL_TLSF_INDEX));
+    index_size =  index_size + (((ULONG) fl_count) * (((ULONG) TX_BYTE_POOL_TLSF_SL_INDEX_COUNT) * (sizeof(UCHAR *))));
+    index_size =  index_size + (((ULONG) fl_count) * (sizeof(ULONG)));
+
+    /* Round the index size up to something that is evenly divisible by an ALIGN_TYPE.  */
+    index_size = (((index_size + (sizeof(ALIGN_TYPE)))-((ALIGN_TYPE) 1))/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+    /* Setup the TLSF index at the start of the pool.  */
+    work_ptr =   pool_ptr -> tx_byte_pool_start;
+    tlsf_ptr =   TX_UCHAR_TO_BYTE_POOL_TLSF_POINTER_CONVERT(work_ptr);
+    work_ptr =   TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(TX_BYTE_POOL_TLSF_INDEX)));
+    free_list =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    work_ptr =   TX_UCHAR_POINTER_ADD(work_ptr, (((ULONG) fl_count) * (((ULONG) TX_BYTE_POOL_TLSF_SL_INDEX_COUNT) * (sizeof(UCHAR *)))));
+    sl_bitmap =  TX_UCHAR_TO_ULONG_POINTER_CONVERT(work_ptr);
+
+    tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap =  ((ULONG) 0);
+    tlsf_ptr -> tx_byte_pool_tlsf_fl_count =   fl_count;
+    tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap =  sl_bitmap;
+    tlsf_ptr -> tx_byte_pool_tlsf_free_list =  free_list;
+
+    /* Clear all the second-level bitmaps and free lists.  */
+    for (i = ((UINT) 0); i < fl_count; i++)
+    {
+
+        sl_bitmap[i] =  ((ULONG) 0);
+    }
+    for (i = ((UINT) 0); i < (fl_count * TX_BYTE_POOL_TLSF_SL_INDEX_COUNT); i++)
+    {
+
+        free_list[i] =  TX_NULL;
+    }
+
+    /* Save the TLSF index in the pool control block.  */
+    pool_ptr -> tx_byte_pool_tlsf =  tlsf_ptr;
+
+    /* Build the blocks of the pool after the index.  */
+    work_ptr =  TX_UCHAR_POINTER_ADD(pool_ptr -> tx_byte_pool_start, index_size);
+    _tx_byte_pool_boundary_tag_format(pool_ptr, work_ptr);
+
+    /* Place the available block in the TLSF index.  */
+    _tx_byte_pool_tlsf_block_insert(pool_ptr, pool_ptr -> tx_byte_pool_list);
+}
+
@@ -0,0 +1,179 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_release                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a block to a byte pool that uses the two-     */
+/*    level segregated fit (TLSF) policy. The block is immediately        */
+/*    merged with its physical neighbors if they are free, and the        */
+/*    resulting block is placed in the TLSF index.                        */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to block to release       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    block_ptr                         Pointer to the resulting free     */
+/*                                        block                           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_block_insert   Insert block into TLSF index      */
+/*    _tx_byte_pool_tlsf_block_remove   Remove block from TLSF index      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_tlsf_release(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR               *next_ptr;
+UCHAR               *previous_ptr;
+UCHAR               *work_ptr;
+UCHAR               **this_block_link_ptr;
+UCHAR               **next_block_link_ptr;
+ALIGN_TYPE          *free_ptr;
+
+
+    /* Mark the block as free.  */
+    work_ptr =   TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+    free_ptr =   TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    *free_ptr =  TX_BYTE_BLOCK_FREE;
+
+    /* Update the number of available bytes in the pool.  */
+    this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    next_ptr =             *this_block_link_ptr;
+    pool_ptr -> tx_byte_pool_available =
+        pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_ptr, block_ptr);
+
+    /* Determine if the following block is free.  The block at the end of the pool
+       is always allocated, so this never wraps.  */
+    work_ptr =  TX_UCHAR_POINTER_ADD(next_ptr, (sizeof(UCHAR *)));
+    free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+    {
+
+        /* Yes, remove it from the TLSF index and merge it into this block.  */
+        _tx_byte_pool_tlsf_block_remove(pool_ptr, next_ptr);
+        next_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
+        next_ptr =             *next_block_link_ptr;
+        *this_block_link_ptr = next_ptr;
+
+        /* Update the previous block pointer of the following block.  */
+        work_ptr =              TX_UCHAR_POINTER_SUB(next_ptr, (sizeof(UCHAR *)));
+        next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *next_block_link_ptr =  block_ptr;
+
+        /* Reduce the fragment total.  */
+        pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total merge counter.  */
+        _tx_byte_pool_performance_merge_count++;
+
+        /* Increment the number of blocks merged on this pool.  */
+        pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+    }
+
+    /* Pickup the previous block.  */
+    work_ptr =             TX_UCHAR_POINTER_SUB(block_ptr, (sizeof(UCHAR *)));
+    next_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    previous_ptr =         *next_block_link_ptr;
+
+    /* Determine if there is a previous block.  */
+    if (previous_ptr != TX_NULL)
+    {
+
+        /* Determine if the previous block is free.  */
+        work_ptr =  TX_UCHAR_POINTER_ADD(previous_ptr, (sizeof(UCHAR *)));
+        free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+        if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+        {
+
+            /* Yes, remove it from the TLSF index and merge this block into it.  */
+            _tx_byte_pool_tlsf_block_remove(pool_ptr, previous_ptr);
+            next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(previous_ptr);
+            *next_block_link_ptr =  next_ptr;
+
+            /* Update the previous block pointer of the following block.  */
+            work_ptr =              TX_UCHAR_POINTER_SUB(next_ptr, (sizeof(UCHAR *)));
+            next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *next_block_link_ptr =  previous_ptr;
+
+            /* The merged block starts at the previous block.  */
+            block_ptr =  previous_ptr;
+
+            /* Reduce the fragment total.  */
+            pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total merge counter.  */
+            _tx_byte_pool_performance_merge_count++;
+
+            /* Increment the number of blocks merged on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+        }
+    }
+
+    /* Place the free block in the TLSF index.  */
+    _tx_byte_pool_tlsf_block_insert(pool_ptr, block_ptr);
+
+    /* Return the resulting free block.  */
+    return(block_ptr);
+}
+
@@ -0,0 +1,344 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_search                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function searches a byte pool that uses the two-level          */
+/*    segregated fit (TLSF) policy for a memory block to satisfy the      */
+/*    requested number of bytes. The request is rounded up to the next    */
+/*    size class so that any block on the first non-empty list found in   */
+/*    the bitmaps is large enough. If no such list exists, the head of    */
+/*    the list of the exact size class is examined. A split of the block  */
+/*    that satisfies the request may occur before this function returns.  */
+/*                                                                        */
+/*    If an alignment is specified, the search looks for a block that can */
+/*    hold the request at any alignment offset. The leading space needed  */
+/*    to align the memory is then split off and returned to the index.    */
+/*                                                                        */
+/*    Since the search examines a fixed number of lists, it is performed  */
+/*    with interrupts disabled and completes in bounded time regardless   */
+/*    of the number of fragments in the pool.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    memory_size                       Number of bytes required          */
+/*    alignment                         Required alignment of the memory, */
+/*                                        zero for the default alignment  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    UCHAR *                           Pointer to the allocated memory,  */
+/*                                        if successful.  Otherwise, a    */
+/*                                        NULL is returned                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_boundary_tag_split  Split block of boundary tag pool  */
+/*    _tx_byte_pool_tlsf_block_insert   Insert block into TLSF index      */
+/*    _tx_byte_pool_tlsf_block_remove   Remove block from TLSF index      */
+/*    _tx_byte_pool_tlsf_mapping        Calculate TLSF size class         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_tlsf_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BYTE_POOL_TLSF_INDEX *tlsf_ptr;
+TX_THREAD               *thread_ptr;
+UCHAR                   *current_ptr;
+UCHAR                   *next_ptr;
+UCHAR                   *split_ptr;
+UCHAR                   *work_ptr;
+UCHAR                   **this_block_link_ptr;
+UCHAR                   **next_block_link_ptr;
+ALIGN_TYPE              *free_ptr;
+ULONG                   fit_size;
+ULONG                   search_size;
+ULONG                   size_bits;
+ULONG                   available_bytes;
+ULONG                   aligned_offset;
+ULONG                   sl_map;
+ULONG                   fl_map;
+UINT                    msb;
+UINT                    fl;
+UINT                    sl;
+
+
+    /* Each free block must be able to hold its free list links.  */
+    if (memory_size < ((sizeof(UCHAR *)) + (sizeof(UCHAR *))))
+    {
+
+        /* Increase the request to the minimum block size.  */
+        memory_size =  (ULONG) ((sizeof(UCHAR *)) + (sizeof(UCHAR *)));
+    }
+
+    /* Determine the size of the block that satisfies the request.  */
+    fit_size =  memory_size;
+    if (alignment != ((ULONG) 0))
+    {
+
+        /* An aligned request must also fit the largest leading space that can be needed
+           to align the memory.  */
+        fit_size =  memory_size + (alignment + (((ULONG) TX_BYTE_BLOCK_MIN) + TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD));
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Setup ownership of the byte pool.  */
+    pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+    /* Pickup the TLSF index.  */
+    tlsf_ptr =  pool_ptr -> tx_byte_pool_tlsf;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total fragment search counter.  */
+    _tx_byte_pool_performance_search_count++;
+
+    /* Increment the number of fragments searched on this pool.  */
+    pool_ptr -> tx_byte_pool_performance_search_count++;
+
+    /* A TLSF search examines a single free list and is never restarted.  */
+    if (pool_ptr -> tx_byte_pool_performance_search_max_count == ((ULONG) 0))
+    {
+
+        pool_ptr -> tx_byte_pool_performance_search_max_count =  ((ULONG) 1);
+    }
+#endif
+
+    /* Default the current pointer to NULL.  */
+    current_ptr =  TX_NULL;
+
+    /* First, determine if there are enough bytes in the pool.  */
+    if (fit_size < pool_ptr -> tx_byte_pool_available)
+    {
+
+        /* Round the request up to the next size class, so that every block in the class
+           found is large enough.  */
+        if (fit_size < TX_BYTE_POOL_TLSF_SMALL_BLOCK_SIZE)
+        {
+
+            /* Small size classes all have the same width.  */
+            search_size =  fit_size + ((((ULONG) 1) << (TX_BYTE_POOL_TLSF_FL_INDEX_SHIFT - TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2)) - ((ULONG) 1));
+        }
+        else
+        {
+
+            /* The width of the size class depends on the first-level range.  */
+            size_bits =  fit_size;
+            TX_HIGHEST_SET_BIT_CALCULATE(size_bits, msb)
+            search_size =  fit_size + ((((ULONG) 1) << (msb - TX_BYTE_POOL_TLSF_SL_INDEX_COUNT_LOG2)) - ((ULONG) 1));
+        }
+
+        /* Find the size class of the rounded request.  */
+        _tx_byte_pool_tlsf_mapping(search_size, &fl, &sl);
+
+        /* Determine if the size class is within the ranges of this pool.  */
+        if (fl < tlsf_ptr -> tx_byte_pool_tlsf_fl_count)
+        {
+
+            /* Look for a non-empty list in the same range, at or above the size class.  */
+            sl_map =  tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[fl] & ((~((ULONG) 0)) << sl);
+            if (sl_map == ((ULONG) 0))
+            {
+
+                /* None, look for a non-empty list in a larger range.  */
+                fl_map =  tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap & ((~((ULONG) 0)) << (fl + ((UINT) 1)));
+                if (fl_map != ((ULONG) 0))
+                {
+
+                    /* Pickup the lowest larger range with free blocks.  */
+                    fl_map =  fl_map & ((~fl_map) + ((ULONG) 1));
+                    TX_HIGHEST_SET_BIT_CALCULATE(fl_map, fl)
+                    sl_map =  tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[fl];
+                }
+            }
+
+            /* Determine if a non-empty list was found.  */
+            if (sl_map != ((ULONG) 0))
+            {
+
+                /* Pickup the first block of the smallest suitable list.  */
+                sl_map =       sl_map & ((~sl_map) + ((ULONG) 1));
+                TX_HIGHEST_SET_BIT_CALCULATE(sl_map, sl)
+                current_ptr =  tlsf_ptr -> tx_byte_pool_tlsf_free_list[(fl * TX_BYTE_POOL_TLSF_SL_INDEX_COUNT) + sl];
+            }
+        }
+
+        /* Determine if a block was found.  */
+        if (current_ptr == TX_NULL)
+        {
+
+            /* No, the first block of the exact size class might still be large enough.  */
+            _tx_byte_pool_tlsf_mapping(fit_size, &fl, &sl);
+            if (fl < tlsf_ptr -> tx_byte_pool_tlsf_fl_count)
+            {
+
+                /* Pickup the head of the list.  */
+                current_ptr =  tlsf_ptr -> tx_byte_pool_tlsf_free_list[(fl * TX_BYTE_POOL_TLSF_SL_INDEX_COUNT) + sl];
+                if (current_ptr != TX_NULL)
+                {
+
+                    /* Calculate the number of bytes available in this block.  */
+                    this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+                    available_bytes =      TX_UCHAR_POINTER_DIF(*this_block_link_ptr, current_ptr);
+                    available_bytes =      available_bytes - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+
+                    /* Determine if the block is too small.  */
+                    if (available_bytes < fit_size)
+                    {
+
+                        /* Yes, no block is available.  */
+                        current_ptr =  TX_NULL;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Determine if a block was found.  */
+    if (current_ptr != TX_NULL)
+    {
+
+        /* Remove the block from the TLSF index.  */
+        _tx_byte_pool_tlsf_block_remove(pool_ptr, current_ptr);
+
+        /* Determine if the memory must start further into the block to meet the alignment.  */
+        if (alignment != ((ULONG) 0))
+        {
+
+            TX_BYTE_POOL_ALIGNED_OFFSET_CALCULATE(current_ptr, alignment, (((ULONG) TX_BYTE_BLOCK_MIN) + TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD), aligned_offset)
+            if (aligned_offset != ((ULONG) 0))
+            {
+
+                /* Yes, split the leading space off as a free block, return it to the TLSF index
+                   and continue with the aligned block.  */
+                split_ptr =    _tx_byte_pool_boundary_tag_split(pool_ptr, current_ptr, aligned_offset);
+                _tx_byte_pool_tlsf_block_insert(pool_ptr, current_ptr);
+                current_ptr =  split_ptr;
+            }
+        }
+
+        /* Calculate the number of bytes available in this block.  */
+        this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+        next_ptr =             *this_block_link_ptr;
+        available_bytes =      TX_UCHAR_POINTER_DIF(next_ptr, current_ptr);
+        available_bytes =      available_bytes - TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+
+        /* Determine if we need to split this block.  */
+        if ((available_bytes - memory_size) >= (((ULONG) TX_BYTE_BLOCK_MIN) + TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD))
+        {
+
+            /* Split the block.  */
+            split_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, (memory_size + TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD));
+
+            /* Setup the new free block.  */
+            next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(split_ptr);
+            *next_block_link_ptr =  next_ptr;
+            work_ptr =              TX_UCHAR_POINTER_SUB(split_ptr, (sizeof(UCHAR *)));
+            next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *next_block_link_ptr =  current_ptr;
+            work_ptr =              TX_UCHAR_POINTER_ADD(split_ptr, (sizeof(UCHAR *)));
+            free_ptr =              TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+            *free_ptr =             TX_BYTE_BLOCK_FREE;
+
+            /* Update the previous block pointer of the following block.  */
+            work_ptr =              TX_UCHAR_POINTER_SUB(next_ptr, (sizeof(UCHAR *)));
+            next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *next_block_link_ptr =  split_ptr;
+
+            /* Update the current pointer to point at the newly created block.  */
+            *this_block_link_ptr =  split_ptr;
+
+            /* Place the new free block in the TLSF index.  */
+            _tx_byte_pool_tlsf_block_insert(pool_ptr, split_ptr);
+
+            /* Increase the total fragment counter.  */
+            pool_ptr -> tx_byte_pool_fragments++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total split counter.  */
+            _tx_byte_pool_performance_split_count++;
+
+            /* Increment the number of blocks split on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+        }
+
+        /* In any case, mark the current block as allocated.  */
+        work_ptr =              TX_UCHAR_POINTER_ADD(current_ptr, (sizeof(UCHAR *)));
+        this_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        *this_block_link_ptr =  TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+
+        /* Reduce the number of available bytes in the pool.  */
+        this_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+        pool_ptr -> tx_byte_pool_available =  pool_ptr -> tx_byte_pool_available - TX_UCHAR_POINTER_DIF(*this_block_link_ptr, current_ptr);
+
+        /* Adjust the pointer for the application.  */
+        current_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)))));
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the search pointer.  */
+    return(current_ptr);
+}
+
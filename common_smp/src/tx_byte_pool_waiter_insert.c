@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_waiter_insert                         PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a thread that is being suspended on the byte     */
+/*    pool to the end of the list of the size class of its request, and   */
+/*    adds the class to the suspended size map of the pool. The thread    */
+/*    is stamped with its order in the suspension list of the pool. The   */
+/*    size of the request must already be saved in the thread.            */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    thread_ptr                        Pointer to suspending thread      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate_aligned         Allocate aligned bytes of memory  */
+/*    _tx_byte_pool_prioritize          Prioritize the byte pool          */
+/*                                        suspension list                 */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_waiter_insert(TX_BYTE_POOL *pool_ptr, TX_THREAD *thread_ptr)
+{
+
+TX_THREAD       *head_ptr;
+TX_THREAD       *previous_thread;
+ULONG           size_bit;
+UINT            size_class;
+
+
+    /* Pickup the size class of the request.  */
+    TX_BYTE_POOL_SIZE_BIT_CALCULATE(thread_ptr -> tx_thread_suspend_info, size_bit, size_class)
+
+    /* Stamp the thread with its order in the suspension list.  */
+    thread_ptr -> tx_thread_suspended_class_stamp =  pool_ptr -> tx_byte_pool_suspended_class_stamp;
+    pool_ptr -> tx_byte_pool_suspended_class_stamp++;
+
+    /* Determine if other threads are suspended with a request of this class.  */
+    if ((pool_ptr -> tx_byte_pool_suspended_size_map & size_bit) == ((ULONG) 0))
+    {
+
+        /* No, setup the list of the class with just this thread.  */
+        pool_ptr -> tx_byte_pool_suspended_class_list[size_class] =  thread_ptr;
+        thread_ptr -> tx_thread_suspended_class_next =              thread_ptr;
+        thread_ptr -> tx_thread_suspended_class_previous =          thread_ptr;
+
+        /* Add the class to the suspended size map.  */
+        pool_ptr -> tx_byte_pool_suspended_size_map =  pool_ptr -> tx_byte_pool_suspended_size_map | size_bit;
+    }
+    else
+    {
+
+        /* Yes, add this thread to the end of the list of the class.  */
+        head_ptr =                                              pool_ptr -> tx_byte_pool_suspended_class_list[size_class];
+        previous_thread =                                       head_ptr -> tx_thread_suspended_class_previous;
+        thread_ptr -> tx_thread_suspended_class_next =          head_ptr;
+        thread_ptr -> tx_thread_suspended_class_previous =      previous_thread;
+        previous_thread -> tx_thread_suspended_class_next =     thread_ptr;
+        head_ptr -> tx_thread_suspended_class_previous =        thread_ptr;
+    }
+}
+
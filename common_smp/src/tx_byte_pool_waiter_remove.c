@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_waiter_remove                         PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a suspended thread from the list of the size  */
+/*    class of its request. The class is removed from the suspended size  */
+/*    map of the pool when its last thread is removed.                    */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    thread_ptr                        Pointer to suspended thread       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_cleanup             Byte pool suspension cleanup      */
+/*    _tx_byte_pool_prioritize          Prioritize the byte pool          */
+/*                                        suspension list                 */
+/*    _tx_byte_release                  Release bytes back to the pool    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_waiter_remove(TX_BYTE_POOL *pool_ptr, TX_THREAD *thread_ptr)
+{
+
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+ULONG           size_bit;
+UINT            size_class;
+
+
+    /* Pickup the size class of the request.  */
+    TX_BYTE_POOL_SIZE_BIT_CALCULATE(thread_ptr -> tx_thread_suspend_info, size_bit, size_class)
+
+    /* Pickup the adjacent threads of the class.  */
+    next_thread =  thread_ptr -> tx_thread_suspended_class_next;
+
+    /* See if this is the only thread of the class.  */
+    if (next_thread == thread_ptr)
+    {
+
+        /* Yes, remove the class from the suspended size map.  */
+        pool_ptr -> tx_byte_pool_suspended_size_map =  pool_ptr -> tx_byte_pool_suspended_size_map & (~size_bit);
+    }
+    else
+    {
+
+        /* No, update the links of the adjacent threads.  */
+        previous_thread =                                       thread_ptr -> tx_thread_suspended_class_previous;
+        next_thread -> tx_thread_suspended_class_previous =     previous_thread;
+        previous_thread -> tx_thread_suspended_class_next =     next_thread;
+
+        /* Determine if the head of the class list needs to be updated.  */
+        if (pool_ptr -> tx_byte_pool_suspended_class_list[size_class] == thread_ptr)
+        {
+
+            /* Update the head of the class list.  */
+            pool_ptr -> tx_byte_pool_suspended_class_list[size_class] =  next_thread;
+        }
+    }
+}
+
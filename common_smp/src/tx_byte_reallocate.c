@@ -0,0 +1,400 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_reallocate                                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function changes the size of a block of memory allocated from  */
+/*    a byte pool. The block is grown in place when the blocks that       */
+/*    follow it are free and large enough, and shrunk in place by         */
+/*    releasing its end. Only if the block cannot grow in place is a new  */
+/*    block with the default alignment allocated, the contents copied     */
+/*    and the original block released.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    memory_ptr                        Pointer to the allocated memory   */
+/*                                        pointer, updated if the memory  */
+/*                                        moves                           */
+/*    memory_size                       New number of bytes               */
+/*    wait_option                       Suspension option if the memory   */
+/*                                        moves                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*    _tx_byte_pool_boundary_tag_split  Split block of boundary tag pool  */
+/*    _tx_byte_pool_tlsf_block_remove   Remove block from TLSF index      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_reallocate(VOID **memory_ptr, ULONG memory_size, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+TX_BYTE_POOL        *pool_ptr;
+TX_THREAD           *thread_ptr;
+UCHAR               *block_ptr;
+UCHAR               *next_ptr;
+UCHAR               *end_ptr;
+UCHAR               *split_ptr;
+UCHAR               *work_ptr;
+UCHAR               **block_link_ptr;
+UCHAR               **next_block_link_ptr;
+ALIGN_TYPE          *free_ptr;
+TX_BYTE_POOL        **byte_pool_ptr;
+ALIGN_TYPE          *source_ptr;
+ALIGN_TYPE          *destination_ptr;
+VOID                *new_memory_ptr;
+ULONG               header_size;
+ULONG               split_size;
+ULONG               current_size;
+ULONG               copy_count;
+
+
+    /* Round the memory size up to the next size that is evenly divisible by
+       an ALIGN_TYPE (this is typically a 32-bit ULONG).  This guarantees proper alignment.  */
+    memory_size = (((memory_size + (sizeof(ALIGN_TYPE)))-((ALIGN_TYPE) 1))/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+    /* Default to successful status.  */
+    status =  TX_SUCCESS;
+
+    /* Set the pool pointer to NULL.  */
+    pool_ptr =  TX_NULL;
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Back off the memory pointer to pickup its header.  */
+    work_ptr =   TX_VOID_TO_UCHAR_POINTER_CONVERT(*memory_ptr);
+    block_ptr =  TX_UCHAR_POINTER_SUB(work_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+
+    /* Determine if the block is allocated.  */
+    work_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+    free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+    if ((*free_ptr) != TX_BYTE_BLOCK_FREE)
+    {
+
+        /* Pickup the pool pointer.  */
+        byte_pool_ptr =  TX_UCHAR_TO_INDIRECT_BYTE_POOL_POINTER(work_ptr);
+        pool_ptr =       *byte_pool_ptr;
+
+        /* See if we have a valid pool.  */
+        if (pool_ptr != TX_NULL)
+        {
+
+            /* Check the pool ID.  */
+            if (pool_ptr -> tx_byte_pool_id != TX_BYTE_POOL_ID)
+            {
+
+                /* Reset the pool pointer to NULL.  */
+                pool_ptr =  TX_NULL;
+            }
+        }
+    }
+
+    /* Determine if the pointer is valid.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return pointer error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_REALLOCATE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(*memory_ptr), memory_size, wait_option, TX_TRACE_BYTE_POOL_EVENTS)
+
+        /* Pickup thread pointer.  */
+        TX_THREAD_GET_CURRENT(thread_ptr)
+
+        /* Indicate that this thread is the current owner, which restarts any search
+           that is in progress.  */
+        pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+        /* Determine the block format of the pool.  */
+        if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT)
+        {
+
+            /* Blocks have a "next" pointer and an owner field.  */
+            header_size =  (ULONG) ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
+            split_size =   ((ULONG) TX_BYTE_BLOCK_MIN);
+        }
+        else
+        {
+
+            /* Blocks also have a pointer to the previous block.  */
+            header_size =  TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+            split_size =   ((ULONG) TX_BYTE_BLOCK_MIN) + TX_BYTE_POOL_BOUNDARY_TAG_OVERHEAD;
+        }
+
+        /* Determine if the pool uses the TLSF policy.  */
+        if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_TLSF)
+        {
+
+            /* Each free block must be able to hold its free list links.  */
+            if (memory_size < ((sizeof(UCHAR *)) + (sizeof(UCHAR *))))
+            {
+
+                /* Increase the request to the minimum block size.  */
+                memory_size =  (ULONG) ((sizeof(UCHAR *)) + (sizeof(UCHAR *)));
+            }
+        }
+
+        /* Calculate the number of bytes in the block.  */
+        block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+        next_ptr =        *block_link_ptr;
+        current_size =    TX_UCHAR_POINTER_DIF(next_ptr, block_ptr) - header_size;
+
+        /* Find the end of the free blocks that follow the block, up to the point the
+           request fits.  The block at the end of the pool is always allocated.  */
+        end_ptr =  next_ptr;
+        while ((TX_UCHAR_POINTER_DIF(end_ptr, block_ptr) - header_size) < memory_size)
+        {
+
+            /* Determine if the following block is free.  */
+            work_ptr =  TX_UCHAR_POINTER_ADD(end_ptr, (sizeof(UCHAR *)));
+            free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+            if ((*free_ptr) != TX_BYTE_BLOCK_FREE)
+            {
+
+                /* No, the block cannot grow any further.  */
+                break;
+            }
+
+            /* Move past the free block.  */
+            next_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(end_ptr);
+            end_ptr =              *next_block_link_ptr;
+        }
+
+        /* Determine if the request can be satisfied in place.  */
+        if ((TX_UCHAR_POINTER_DIF(end_ptr, block_ptr) - header_size) >= memory_size)
+        {
+
+            /* Yes, merge the free blocks that follow into the block.  */
+            while (next_ptr != end_ptr)
+            {
+
+                /* Pickup the block after the free block.  */
+                next_block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
+                work_ptr =             *next_block_link_ptr;
+
+                /* Determine if the free block is in the TLSF index.  */
+                if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_TLSF)
+                {
+
+                    /* Yes, remove the free block from the TLSF index.  */
+                    _tx_byte_pool_tlsf_block_remove(pool_ptr, next_ptr);
+                }
+                else
+                {
+
+                    /* No, remove the free block from the fragmentation information.  */
+                    TX_BYTE_POOL_FRAGMENTATION_REMOVE(pool_ptr, next_ptr)
+                }
+
+                /* The free block is no longer available.  */
+                pool_ptr -> tx_byte_pool_available =  pool_ptr -> tx_byte_pool_available - TX_UCHAR_POINTER_DIF(work_ptr, next_ptr);
+
+                /* Reduce the fragment total.  */
+                pool_ptr -> tx_byte_pool_fragments--;
+
+                /* See if the search pointer is affected.  */
+                if (pool_ptr -> tx_byte_pool_search == next_ptr)
+                {
+
+                    /* Yes, move the search pointer past the merged blocks.  */
+                    pool_ptr -> tx_byte_pool_search =  end_ptr;
+                }
+
+                /* Move to the next block.  */
+                next_ptr =  work_ptr;
+            }
+
+            /* Link the block to the end of the merged blocks.  */
+            *block_link_ptr =  end_ptr;
+
+            /* Determine if the pool uses boundary tags.  */
+            if (pool_ptr -> tx_byte_pool_policy != TX_BYTE_POOL_FIRST_FIT)
+            {
+
+                /* Yes, update the previous block pointer of the following block.  */
+                work_ptr =              TX_UCHAR_POINTER_SUB(end_ptr, (sizeof(UCHAR *)));
+                next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                *next_block_link_ptr =  block_ptr;
+            }
+
+            /* Calculate the new number of bytes in the block.  */
+            current_size =  TX_UCHAR_POINTER_DIF(end_ptr, block_ptr) - header_size;
+
+            /* Determine if the end of the block is large enough to be split off.  */
+            split_ptr =  TX_NULL;
+            if ((current_size - memory_size) >= split_size)
+            {
+
+                /* Determine the block format of the pool.  */
+                if (pool_ptr -> tx_byte_pool_policy == TX_BYTE_POOL_FIRST_FIT)
+                {
+
+                    /* Split the block.  */
+                    split_ptr =             TX_UCHAR_POINTER_ADD(block_ptr, (memory_size + header_size));
+                    next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(split_ptr);
+                    *next_block_link_ptr =  end_ptr;
+                    *block_link_ptr =       split_ptr;
+
+                    /* Increase the total fragment counter.  */
+                    pool_ptr -> tx_byte_pool_fragments++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                    /* Increment the total split counter.  */
+                    _tx_byte_pool_performance_split_count++;
+
+                    /* Increment the number of blocks split on this pool.  */
+                    pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+                }
+                else
+                {
+
+                    /* Split the block and link the boundary tags.  */
+                    split_ptr =  _tx_byte_pool_boundary_tag_split(pool_ptr, block_ptr, (memory_size + header_size));
+                }
+
+                /* The end of the block stays allocated until it is released below.  */
+                work_ptr =        TX_UCHAR_POINTER_ADD(split_ptr, (sizeof(UCHAR *)));
+                byte_pool_ptr =   TX_UCHAR_TO_INDIRECT_BYTE_POOL_POINTER(work_ptr);
+                *byte_pool_ptr =  pool_ptr;
+            }
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the number of reallocations done in place on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_reallocate_in_place_count++;
+#endif
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Determine if the end of the block was split off.  */
+            if (split_ptr != TX_NULL)
+            {
+
+                /* Release the end of the block, which merges it with a free block that
+                   follows and resumes any threads that it satisfies.  */
+                work_ptr =  TX_UCHAR_POINTER_ADD(split_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                status =    _tx_byte_release(TX_UCHAR_TO_VOID_POINTER_CONVERT(work_ptr));
+            }
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* The block cannot grow in place, allocate a new block from the pool.  */
+            status =  _tx_byte_allocate(pool_ptr, &new_memory_ptr, memory_size, wait_option);
+
+            /* Determine if the new block was allocated.  */
+            if (status == TX_SUCCESS)
+            {
+
+                /* Copy the contents of the block, which is smaller than the new block.  */
+                work_ptr =         TX_VOID_TO_UCHAR_POINTER_CONVERT(*memory_ptr);
+                source_ptr =       TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+                work_ptr =         TX_VOID_TO_UCHAR_POINTER_CONVERT(new_memory_ptr);
+                destination_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+                copy_count =       current_size / ((ULONG) (sizeof(ALIGN_TYPE)));
+                while (copy_count != ((ULONG) 0))
+                {
+
+                    *destination_ptr =  *source_ptr;
+                    destination_ptr++;
+                    source_ptr++;
+                    copy_count--;
+                }
+
+                /* Release the original block.  */
+                status =  _tx_byte_release(*memory_ptr);
+
+                /* Return the new block.  */
+                *memory_ptr =  new_memory_ptr;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+                /* Increment the number of reallocations that moved the memory on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_reallocate_moved_count++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#endif
+            }
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -29,6 +29,7 @@
 #include "tx_trace.h"
 #include "tx_thread.h"
 #include "tx_event_flags.h"
+#include "tx_wait_set.h"
 
 
 /**************************************************************************/
@@ -36,7 +37,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_event_flags_set                                 PORTABLE C      */
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -63,6 +64,7 @@
 /*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_wait_set_signal               Signal wait set member            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -79,6 +81,8 @@
 /*                                            added corrected preemption  */
 /*                                            check logic, resulting in   */
 /*                                            version 6.1.11              */
+/*  xx-xx-xxxx      Microsoft Corporation   Added wait sets, resulting in */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_event_flags_set(TX_EVENT_FLAGS_GROUP *group_ptr, ULONG flags_to_set, UINT set_option)
@@ -610,6 +614,17 @@ VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_
         }
 #endif
 
+#ifdef TX_ENABLE_WAIT_SET
+
+        /* Determine if the event flags group is a member of a wait set.  */
+        if (group_ptr -> tx_event_flags_group_wait_set_member.tx_wait_set_member_set != TX_NULL)
+        {
+
+            /* Yes, resume a thread waiting on the wait set if the event flags group is still ready.  */
+            _tx_wait_set_signal(&(group_ptr -> tx_event_flags_group_wait_set_member));
+        }
+#endif
+
         /* Determine if a check for preemption is necessary.  */
         if (preempt_check == TX_TRUE)
         {
@@ -42,6 +42,10 @@
 #include "tx_mutex.h"
 #include "tx_block_pool.h"
 #include "tx_byte_pool.h"
+#include "tx_slab_pool.h"
+#include "tx_message_buffer.h"
+#include "tx_wait_set.h"
+#include "tx_spsc_ring.h"
 
 
 /* Define the unused memory pointer.  The value of the first available
@@ -57,7 +61,7 @@ VOID     *_tx_initialize_unused_memory;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_initialize_high_level                           PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -91,8 +95,17 @@ VOID     *_tx_initialize_unused_memory;
 /*                                        component                       */
 /*    _tx_byte_pool_initialize          Initialize the byte pool control  */
 /*                                        component                       */
+/*    _tx_slab_pool_initialize          Initialize the slab pool control  */
+/*                                        component                       */
+/*    _tx_message_buffer_initialize     Initialize the message buffer     */
+/*                                        control component               */
 /*    _tx_mutex_initialize              Initialize the mutex control      */
 /*                                        component                       */
+/*    _tx_wait_set_initialize           Initialize the wait set control   */
+/*                                        component                       */
+/*    _tx_spsc_ring_initialize          Initialize the single-producer    */
+/*                                        single-consumer ring control    */
+/*                                        component                       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -108,6 +121,13 @@ VOID     *_tx_initialize_unused_memory;
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added slab pool               */
+/*                                            initialization, added       */
+/*                                            message buffer              */
+/*                                            initialization, added wait  */
+/*                                            sets, added single-producer */
+/*                                            single-consumer rings,      */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID    _tx_initialize_high_level(VOID)
@@ -145,8 +165,20 @@ VOID    _tx_initialize_high_level(VOID)
     /* Call the byte pool initialization function.  */
     _tx_byte_pool_initialize();
 
+    /* Call the slab pool initialization function.  */
+    _tx_slab_pool_initialize();
+
+    /* Call the message buffer initialization function.  */
+    _tx_message_buffer_initialize();
+
     /* Call the mutex initialization function.  */
     _tx_mutex_initialize();
+
+    /* Call the wait set initialization function.  */
+    _tx_wait_set_initialize();
+
+    /* Call the single-producer single-consumer ring initialization function.  */
+    _tx_spsc_ring_initialize();
 #endif
 }
 
@@ -0,0 +1,201 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_delete                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified message buffer. All threads     */
+/*    suspended on the message buffer are resumed with the TX_DELETED     */
+/*    status code.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_message_buffer_delete(TX_MESSAGE_BUFFER *message_buffer_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD           *thread_ptr;
+TX_THREAD           *next_thread;
+UINT                suspended_count;
+TX_MESSAGE_BUFFER   *next_message_buffer;
+TX_MESSAGE_BUFFER   *previous_message_buffer;
+
+
+    /* Disable interrupts to remove the message buffer from the created list.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_MESSAGE_BUFFER_DELETE, message_buffer_ptr, TX_POINTER_TO_ULONG_CONVERT(&thread_ptr), 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* If trace is enabled, unregister this object.  */
+    TX_TRACE_OBJECT_UNREGISTER(message_buffer_ptr)
+
+    /* Clear the message buffer ID to make it invalid.  */
+    message_buffer_ptr -> tx_message_buffer_id =  TX_CLEAR_ID;
+
+    /* Decrement the number of created message buffers.  */
+    _tx_message_buffer_created_count--;
+
+    /* See if the message buffer is the only one on the list.  */
+    if (_tx_message_buffer_created_count == TX_EMPTY)
+    {
+
+        /* Only created message buffer, just set the created list to NULL.  */
+        _tx_message_buffer_created_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        next_message_buffer =                                        message_buffer_ptr -> tx_message_buffer_created_next;
+        previous_message_buffer =                                    message_buffer_ptr -> tx_message_buffer_created_previous;
+        next_message_buffer -> tx_message_buffer_created_previous =  previous_message_buffer;
+        previous_message_buffer -> tx_message_buffer_created_next =  next_message_buffer;
+
+        /* See if we have to update the created list head pointer.  */
+        if (_tx_message_buffer_created_ptr == message_buffer_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            _tx_message_buffer_created_ptr =  next_message_buffer;
+        }
+    }
+
+    /* Temporarily disable preemption.  */
+    _tx_thread_preempt_disable++;
+
+    /* Pickup the suspension information.  */
+    thread_ptr =                                               message_buffer_ptr -> tx_message_buffer_suspension_list;
+    message_buffer_ptr -> tx_message_buffer_suspension_list =  TX_NULL;
+    suspended_count =                                          message_buffer_ptr -> tx_message_buffer_suspended_count;
+    message_buffer_ptr -> tx_message_buffer_suspended_count =  TX_NO_SUSPENSIONS;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Walk through the message buffer list to resume any and all threads suspended
+       on this message buffer.  */
+    while (suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Decrement the suspension count.  */
+        suspended_count--;
+
+        /* Lockout interrupts.  */
+        TX_DISABLE
+
+        /* Clear the cleanup pointer, this prevents the timeout from doing
+           anything.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Set the return status in the thread to TX_DELETED.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_DELETED;
+
+        /* Move the thread pointer ahead.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption again.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+
+        /* Move to next thread.  */
+        thread_ptr =  next_thread;
+    }
+
+    /* Execute Port-Specific completion processing. If needed, it is typically defined in tx_port.h.  */
+    TX_MESSAGE_BUFFER_DELETE_PORT_COMPLETION(message_buffer_ptr)
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Release previous preempt disable.  */
+    _tx_thread_preempt_disable--;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Check for preemption.  */
+    _tx_thread_system_preempt_check();
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
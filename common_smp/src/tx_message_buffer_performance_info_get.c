@@ -0,0 +1,224 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_message_buffer.h"
+#include "tx_trace.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_performance_info_get             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves performance information from the specified  */
+/*    message buffer.                                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    messages_sent                     Destination for messages sent     */
+/*    messages_received                 Destination for messages received */
+/*    empty_suspensions                 Destination for number of empty   */
+/*                                        message buffer suspensions      */
+/*    full_suspensions                  Destination for number of full    */
+/*                                        message buffer suspensions      */
+/*    full_errors                       Destination for number of full    */
+/*                                        errors on message buffer        */
+/*    timeouts                          Destination for number of         */
+/*                                        timeouts on message buffer      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_message_buffer_performance_info_get(TX_MESSAGE_BUFFER *message_buffer_ptr, ULONG *messages_sent, ULONG *messages_received,
+                    ULONG *empty_suspensions, ULONG *full_suspensions, ULONG *full_errors, ULONG *timeouts)
+{
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+TX_INTERRUPT_SAVE_AREA
+UINT                    status;
+
+
+    /* Determine if this is a legal request.  */
+    if (message_buffer_ptr == TX_NULL)
+    {
+
+        /* Message buffer pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the message buffer ID is invalid.  */
+    else if (message_buffer_ptr -> tx_message_buffer_id != TX_MESSAGE_BUFFER_ID)
+    {
+
+        /* Message buffer pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_MESSAGE_BUFFER_PERFORMANCE_INFO_GET, message_buffer_ptr, 0, 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+        /* Retrieve all the pertinent information and return it in the supplied
+           destinations.  */
+
+        /* Retrieve the number of messages sent to this message buffer.  */
+        if (messages_sent != TX_NULL)
+        {
+
+            *messages_sent =  message_buffer_ptr -> tx_message_buffer_performance_messages_sent_count;
+        }
+
+        /* Retrieve the number of messages received from this message buffer.  */
+        if (messages_received != TX_NULL)
+        {
+
+            *messages_received =  message_buffer_ptr -> tx_message_buffer_performance_messages_received_count;
+        }
+
+        /* Retrieve the number of empty message buffer suspensions on this message buffer.  */
+        if (empty_suspensions != TX_NULL)
+        {
+
+            *empty_suspensions =  message_buffer_ptr -> tx_message_buffer_performance_empty_suspension_count;
+        }
+
+        /* Retrieve the number of full message buffer suspensions on this message buffer.  */
+        if (full_suspensions != TX_NULL)
+        {
+
+            *full_suspensions =  message_buffer_ptr -> tx_message_buffer_performance_full_suspension_count;
+        }
+
+        /* Retrieve the number of full errors (no suspension!) on this message buffer.  */
+        if (full_errors != TX_NULL)
+        {
+
+            *full_errors =  message_buffer_ptr -> tx_message_buffer_performance_full_error_count;
+        }
+
+        /* Retrieve the number of timeouts on this message buffer.  */
+        if (timeouts != TX_NULL)
+        {
+
+            *timeouts =  message_buffer_ptr -> tx_message_buffer_performance_timeout_count;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return completion status.  */
+        status =  TX_SUCCESS;
+    }
+#else
+UINT                    status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (message_buffer_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (messages_sent != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (messages_received != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (empty_suspensions != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (full_suspensions != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (full_errors != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (timeouts != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,445 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_trace.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_receive                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives the message at the front of the message      */
+/*    buffer, if it fits in the destination. If it does not fit, the      */
+/*    message is left in the message buffer and its size is returned      */
+/*    with the TX_SIZE_ERROR status. Threads suspended waiting for room   */
+/*    are given the room that is freed, in suspension order. If the       */
+/*    message buffer is empty, this function returns an error or          */
+/*    suspends the calling thread, as specified by the wait option.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    destination_ptr                   Pointer to message destination    */
+/*    destination_size                  Size of the destination in bytes  */
+/*    actual_size                       Destination for the size of the   */
+/*                                        message                         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_message_buffer_record_read    Remove message from message       */
+/*                                        buffer                          */
+/*    _tx_message_buffer_record_write   Place message in message buffer   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_message_buffer_receive(TX_MESSAGE_BUFFER *message_buffer_ptr, VOID *destination_ptr,
+                    ULONG destination_size, ULONG *actual_size, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD           *thread_ptr;
+TX_THREAD           *resume_list;
+TX_THREAD           *resume_last;
+TX_THREAD           *next_thread;
+TX_THREAD           *previous_thread;
+ULONG               *length_ptr;
+ULONG               message_size;
+UINT                suspended_count;
+UINT                status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts to receive message from message buffer.  */
+    TX_DISABLE
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total messages received counter.  */
+    _tx_message_buffer_performance_messages_received_count++;
+
+    /* Increment the number of messages received from this message buffer.  */
+    message_buffer_ptr -> tx_message_buffer_performance_messages_received_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_MESSAGE_BUFFER_RECEIVE, message_buffer_ptr, TX_POINTER_TO_ULONG_CONVERT(destination_ptr), wait_option, message_buffer_ptr -> tx_message_buffer_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+    /* Pickup the thread suspension count.  */
+    suspended_count =  message_buffer_ptr -> tx_message_buffer_suspended_count;
+
+    /* Determine if there is anything in the message buffer.  */
+    if (message_buffer_ptr -> tx_message_buffer_enqueued != TX_NO_MESSAGES)
+    {
+
+        /* Pickup the size of the message at the front of the message buffer.  */
+        length_ptr =    TX_UCHAR_TO_ULONG_POINTER_CONVERT(message_buffer_ptr -> tx_message_buffer_read);
+        message_size =  *length_ptr;
+
+        /* Determine if the message fits in the destination.  */
+        if (message_size > destination_size)
+        {
+
+            /* No, leave the message in the message buffer.  */
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Return the size needed to receive the message.  */
+            *actual_size =  message_size;
+
+            /* Return error completion.  */
+            status =  TX_SIZE_ERROR;
+        }
+        else
+        {
+
+            /* Remove the message from the message buffer.  */
+            message_size =  _tx_message_buffer_record_read(message_buffer_ptr, TX_VOID_TO_UCHAR_POINTER_CONVERT(destination_ptr));
+
+            /* Start with no threads to resume.  */
+            resume_list =  TX_NULL;
+            resume_last =  TX_NULL;
+
+            /* Place the messages of the suspended senders in the message buffer, in
+               suspension order, while they fit.  */
+            while (suspended_count != TX_NO_SUSPENSIONS)
+            {
+
+                /* Pickup the head of the suspension list.  */
+                thread_ptr =  message_buffer_ptr -> tx_message_buffer_suspension_list;
+
+                /* Determine if the message of this sender fits.  */
+                if (message_buffer_ptr -> tx_message_buffer_available < TX_MESSAGE_BUFFER_RECORD_SIZE(thread_ptr -> tx_thread_suspend_info))
+                {
+
+                    /* No, the sender must keep waiting and so must the senders after it.  */
+                    break;
+                }
+
+                /* See if this is the only suspended thread on the list.  */
+                suspended_count--;
+                if (suspended_count == TX_NO_SUSPENSIONS)
+                {
+
+                    /* Yes, the only suspended thread.  */
+
+                    /* Update the head pointer.  */
+                    message_buffer_ptr -> tx_message_buffer_suspension_list =  TX_NULL;
+                }
+                else
+                {
+
+                    /* At least one more thread is on the same suspension list.  */
+
+                    /* Update the list head pointer.  */
+                    next_thread =                                               thread_ptr -> tx_thread_suspended_next;
+                    message_buffer_ptr -> tx_message_buffer_suspension_list =  next_thread;
+
+                    /* Update the links of the adjacent threads.  */
+                    previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                    next_thread -> tx_thread_suspended_previous =   previous_thread;
+                    previous_thread -> tx_thread_suspended_next =   next_thread;
+                }
+
+                /* Decrement the suspension count.  */
+                message_buffer_ptr -> tx_message_buffer_suspended_count =  suspended_count;
+
+                /* Clear cleanup routine to avoid timeout.  */
+                thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                /* Place the message of the sender in the message buffer.  */
+                _tx_message_buffer_record_write(message_buffer_ptr, TX_VOID_TO_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info), thread_ptr -> tx_thread_suspend_info);
+
+                /* Put return status into the thread control block.  */
+                thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+                /* Append the thread to the list of threads to resume, which keeps
+                   the order in which the threads were suspended.  */
+                thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+                if (resume_list == TX_NULL)
+                {
+
+                    /* First thread to resume.  */
+                    resume_list =  thread_ptr;
+                }
+                else
+                {
+
+                    /* Link the thread after the last one.  */
+                    resume_last -> tx_thread_suspended_next =  thread_ptr;
+                }
+                resume_last =  thread_ptr;
+            }
+
+            /* Determine if any senders were given room.  */
+            if (resume_list != TX_NULL)
+            {
+
+                /* Disable preemption until all of the threads are resumed.  */
+                _tx_thread_preempt_disable++;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Walk through the list of threads to resume.  */
+                thread_ptr =  resume_list;
+                while (thread_ptr != TX_NULL)
+                {
+
+                    /* Get next pointer first.  */
+                    next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                    /* Resume the thread!  */
+                    _tx_thread_system_ni_resume(thread_ptr);
+
+                    /* Move next thread to current.  */
+                    thread_ptr =  next_thread;
+                }
+#else
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Walk through the list of threads to resume.  */
+                thread_ptr =  resume_list;
+                while (thread_ptr != TX_NULL)
+                {
+
+                    /* Get next pointer first.  */
+                    next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                    /* Disable interrupts.  */
+                    TX_DISABLE
+
+                    /* Disable preemption again.  */
+                    _tx_thread_preempt_disable++;
+
+                    /* Restore interrupt posture.  */
+                    TX_RESTORE
+
+                    /* Resume the thread.  */
+                    _tx_thread_system_resume(thread_ptr);
+
+                    /* Move next thread to current.  */
+                    thread_ptr =  next_thread;
+                }
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+#endif
+
+                /* Release thread preemption disable.  */
+                _tx_thread_preempt_disable--;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Check for preemption.  */
+                _tx_thread_system_preempt_check();
+            }
+            else
+            {
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
+
+            /* Return the size of the message.  */
+            *actual_size =  message_size;
+        }
+    }
+
+    /* At this point, the message buffer is empty. Determine if suspension is requested.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            *actual_size =  ((ULONG) 0);
+            status =  TX_QUEUE_EMPTY;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total message buffer empty suspensions counter.  */
+            _tx_message_buffer_performance_empty_suspension_count++;
+
+            /* Increment the number of empty suspensions on this message buffer.  */
+            message_buffer_ptr -> tx_message_buffer_performance_empty_suspension_count++;
+#endif
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_message_buffer_cleanup);
+
+            /* Setup cleanup information, i.e. this message buffer control
+               block, the destination pointer and its size.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) message_buffer_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) destination_ptr;
+            thread_ptr -> tx_thread_suspend_info =             destination_size;
+            thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                message_buffer_ptr -> tx_message_buffer_suspension_list =  thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =                   thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =               thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   message_buffer_ptr -> tx_message_buffer_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            message_buffer_ptr -> tx_message_buffer_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+
+            /* Determine if a message was given to this thread.  */
+            if ((status == TX_SUCCESS) || (status == TX_SIZE_ERROR))
+            {
+
+                /* Yes, return the size of the message, which the sender placed in the
+                   thread control block.  */
+                *actual_size =  thread_ptr -> tx_thread_suspend_info;
+            }
+            else
+            {
+
+                /* No message was received.  */
+                *actual_size =  ((ULONG) 0);
+            }
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* No message was received.  */
+        *actual_size =  ((ULONG) 0);
+
+        /* Return an empty error.  */
+        status =  TX_QUEUE_EMPTY;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
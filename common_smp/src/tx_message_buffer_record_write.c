@@ -0,0 +1,150 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_record_write                     PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a message at the write pointer of the message  */
+/*    buffer and updates the message buffer counts. The caller must have  */
+/*    verified that there is room for the message and must have           */
+/*    interrupts disabled.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    source_ptr                        Pointer to message source         */
+/*    size                              Size of the message in bytes      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_message_buffer_send           Send message to message buffer    */
+/*    _tx_message_buffer_receive        Receive message from message      */
+/*                                        buffer                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_message_buffer_record_write(TX_MESSAGE_BUFFER *message_buffer_ptr, UCHAR *source_ptr, ULONG size)
+{
+
+UCHAR       *source;
+UCHAR       *destination;
+ULONG       *length_ptr;
+ULONG       record_size;
+ULONG       copy_size;
+ULONG       offset;
+
+
+    /* Calculate the number of bytes the message uses in the ring.  */
+    record_size =  TX_MESSAGE_BUFFER_RECORD_SIZE(size);
+
+    /* Store the length of the message.  The length is aligned and never wraps around
+       the end of the ring.  */
+    destination =   message_buffer_ptr -> tx_message_buffer_write;
+    length_ptr =    TX_UCHAR_TO_ULONG_POINTER_CONVERT(destination);
+    *length_ptr =   size;
+    destination =   TX_UCHAR_POINTER_ADD(destination, (sizeof(ULONG)));
+
+    /* Determine if the length is at the end of the ring.  */
+    if (destination == message_buffer_ptr -> tx_message_buffer_end)
+    {
+
+        /* Yes, the message starts at the beginning of the ring.  */
+        destination =  message_buffer_ptr -> tx_message_buffer_start;
+    }
+
+    /* Calculate the number of bytes up to the end of the ring.  */
+    offset =  TX_UCHAR_POINTER_DIF(message_buffer_ptr -> tx_message_buffer_end, destination);
+
+    /* Copy the part of the message that fits before the end of the ring.  Note that the
+       source and destination pointers are incremented by the macro.  */
+    source =  source_ptr;
+    if (size > offset)
+    {
+
+        /* The message wraps around the end of the ring.  */
+        copy_size =  offset;
+    }
+    else
+    {
+
+        /* The whole message fits before the end of the ring.  */
+        copy_size =  size;
+    }
+    TX_MESSAGE_BUFFER_COPY(source, destination, copy_size)
+
+    /* Determine if there is more of the message to copy.  */
+    if (size > offset)
+    {
+
+        /* Copy the rest of the message to the beginning of the ring.  */
+        destination =  message_buffer_ptr -> tx_message_buffer_start;
+        copy_size =    size - offset;
+        TX_MESSAGE_BUFFER_COPY(source, destination, copy_size)
+    }
+
+    /* Advance the write pointer past the padded message.  */
+    offset =  TX_UCHAR_POINTER_DIF(message_buffer_ptr -> tx_message_buffer_write, message_buffer_ptr -> tx_message_buffer_start);
+    offset =  offset + record_size;
+    if (offset >= message_buffer_ptr -> tx_message_buffer_size)
+    {
+
+        /* Wrap around to the beginning.  */
+        offset =  offset - message_buffer_ptr -> tx_message_buffer_size;
+    }
+    message_buffer_ptr -> tx_message_buffer_write =  TX_UCHAR_POINTER_ADD(message_buffer_ptr -> tx_message_buffer_start, offset);
+
+    /* Update the number of bytes available and the number of messages.  */
+    message_buffer_ptr -> tx_message_buffer_available =  message_buffer_ptr -> tx_message_buffer_available - record_size;
+    message_buffer_ptr -> tx_message_buffer_enqueued++;
+}
+
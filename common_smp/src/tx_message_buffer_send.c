@@ -0,0 +1,490 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_trace.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_message_buffer_send                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a message of the specified size in the         */
+/*    message buffer. If the message buffer is empty and threads are      */
+/*    suspended waiting for a message, the message is copied directly to  */
+/*    the destination of the first suspended thread it fits. If there is  */
+/*    not enough room in the message buffer, this function returns an     */
+/*    error or suspends the calling thread, as specified by the wait      */
+/*    option.                                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    source_ptr                        Pointer to message source         */
+/*    size                              Size of the message in bytes      */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_message_buffer_record_write   Place message in message buffer   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_message_buffer_send(TX_MESSAGE_BUFFER *message_buffer_ptr, VOID *source_ptr, ULONG size,
+                    ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD           *thread_ptr;
+TX_THREAD           *resume_list;
+TX_THREAD           *resume_last;
+TX_THREAD           *next_thread;
+TX_THREAD           *previous_thread;
+UCHAR               *source;
+UCHAR               *destination;
+ULONG               copy_size;
+UINT                suspended_count;
+UINT                sent;
+UINT                status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID                (*message_buffer_send_notify)(struct TX_MESSAGE_BUFFER_STRUCT *notify_message_buffer_ptr);
+#endif
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Start with no threads to resume.  */
+    resume_list =  TX_NULL;
+    resume_last =  TX_NULL;
+
+    /* Disable interrupts to place message in the message buffer.  */
+    TX_DISABLE
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total messages sent counter.  */
+    _tx_message_buffer_performance_messages_sent_count++;
+
+    /* Increment the number of messages sent to this message buffer.  */
+    message_buffer_ptr -> tx_message_buffer_performance_messages_sent_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_MESSAGE_BUFFER_SEND, message_buffer_ptr, TX_POINTER_TO_ULONG_CONVERT(source_ptr), size, wait_option, TX_TRACE_QUEUE_EVENTS)
+
+    /* Pickup the thread suspension count.  */
+    suspended_count =  message_buffer_ptr -> tx_message_buffer_suspended_count;
+
+    /* The message has not been sent yet.  */
+    sent =  TX_FALSE;
+
+    /* Determine if the message buffer is empty.  If so, any suspended threads are
+       waiting to receive a message.  Otherwise, they are waiting to send one.  */
+    if (message_buffer_ptr -> tx_message_buffer_enqueued == TX_NO_MESSAGES)
+    {
+
+        /* Give the message directly to the suspended receivers in suspension order.  A
+           receiver whose destination is too small for the message is resumed with the
+           TX_SIZE_ERROR status, as it would be if the message were in the message buffer.  */
+        while ((suspended_count != TX_NO_SUSPENSIONS) && (sent == TX_FALSE))
+        {
+
+            /* Pickup the head of the suspension list.  */
+            thread_ptr =  message_buffer_ptr -> tx_message_buffer_suspension_list;
+
+            /* See if this is the only suspended thread on the list.  */
+            suspended_count--;
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                message_buffer_ptr -> tx_message_buffer_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                                               thread_ptr -> tx_thread_suspended_next;
+                message_buffer_ptr -> tx_message_buffer_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =   previous_thread;
+                previous_thread -> tx_thread_suspended_next =   next_thread;
+            }
+
+            /* Decrement the suspension count.  */
+            message_buffer_ptr -> tx_message_buffer_suspended_count =  suspended_count;
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Determine if the message fits in the destination of the receiver.  */
+            if (size <= thread_ptr -> tx_thread_suspend_info)
+            {
+
+                /* Setup source and destination pointers.  */
+                source =       TX_VOID_TO_UCHAR_POINTER_CONVERT(source_ptr);
+                destination =  TX_VOID_TO_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                copy_size =    size;
+
+                /* Copy message. Note that the source and destination pointers are
+                   incremented by the macro.  */
+                TX_MESSAGE_BUFFER_COPY(source, destination, copy_size)
+
+                /* Put return status into the thread control block.  */
+                thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+                /* The message is sent.  */
+                sent =  TX_TRUE;
+            }
+            else
+            {
+
+                /* Put return status into the thread control block.  */
+                thread_ptr -> tx_thread_suspend_status =  TX_SIZE_ERROR;
+            }
+
+            /* Return the size of the message to the receiver.  */
+            thread_ptr -> tx_thread_suspend_info =  size;
+
+            /* Append the thread to the list of threads to resume, which keeps
+               the order in which the threads were suspended.  */
+            thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+            if (resume_list == TX_NULL)
+            {
+
+                /* First thread to resume.  */
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the thread after the last one.  */
+                resume_last -> tx_thread_suspended_next =  thread_ptr;
+            }
+            resume_last =  thread_ptr;
+        }
+    }
+
+    /* Determine if the message must be placed in the message buffer.  Suspended senders
+       are ahead of this message, so it is only placed if there are none.  */
+    if (sent == TX_FALSE)
+    {
+
+        /* Is there room for the message and no suspended sender?  */
+        if ((suspended_count == TX_NO_SUSPENSIONS) &&
+            (message_buffer_ptr -> tx_message_buffer_available >= TX_MESSAGE_BUFFER_RECORD_SIZE(size)))
+        {
+
+            /* Yes, place the message in the message buffer.  */
+            _tx_message_buffer_record_write(message_buffer_ptr, TX_VOID_TO_UCHAR_POINTER_CONVERT(source_ptr), size);
+
+            /* The message is sent.  */
+            sent =  TX_TRUE;
+        }
+    }
+
+    /* Determine if the message was sent.  */
+    if (sent == TX_TRUE)
+    {
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Pickup the notify callback routine for this message buffer.  */
+        message_buffer_send_notify =  message_buffer_ptr -> tx_message_buffer_send_notify;
+#endif
+
+        /* Determine if any threads were given a message.  */
+        if (resume_list != TX_NULL)
+        {
+
+            /* Disable preemption until all of the threads are resumed.  */
+            _tx_thread_preempt_disable++;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Walk through the list of threads to resume.  */
+            thread_ptr =  resume_list;
+            while (thread_ptr != TX_NULL)
+            {
+
+                /* Get next pointer first.  */
+                next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                /* Resume the thread!  */
+                _tx_thread_system_ni_resume(thread_ptr);
+
+                /* Move next thread to current.  */
+                thread_ptr =  next_thread;
+            }
+#else
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Walk through the list of threads to resume.  */
+            thread_ptr =  resume_list;
+            while (thread_ptr != TX_NULL)
+            {
+
+                /* Get next pointer first.  */
+                next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+                /* Disable preemption again.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupt posture.  */
+                TX_RESTORE
+
+                /* Resume the thread.  */
+                _tx_thread_system_resume(thread_ptr);
+
+                /* Move next thread to current.  */
+                thread_ptr =  next_thread;
+            }
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+#endif
+
+            /* Release thread preemption disable.  */
+            _tx_thread_preempt_disable--;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Check for preemption.  */
+            _tx_thread_system_preempt_check();
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if a notify callback is required.  */
+        if (message_buffer_send_notify != TX_NULL)
+        {
+
+            /* Call application message buffer send notification.  */
+            (message_buffer_send_notify)(message_buffer_ptr);
+        }
+#endif
+    }
+
+    /* At this point, the message buffer is full. Determine if suspension is requested.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_QUEUE_FULL;
+        }
+        else
+        {
+
+            /* Yes, prepare for suspension of this thread.  */
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total number of message buffer full suspensions.  */
+            _tx_message_buffer_performance_full_suspension_count++;
+
+            /* Increment the number of full suspensions on this message buffer.  */
+            message_buffer_ptr -> tx_message_buffer_performance_full_suspension_count++;
+#endif
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_message_buffer_cleanup);
+
+            /* Setup cleanup information, i.e. this message buffer control
+               block, the source pointer and its size.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) message_buffer_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) source_ptr;
+            thread_ptr -> tx_thread_suspend_info =             size;
+            thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                message_buffer_ptr -> tx_message_buffer_suspension_list =  thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =                   thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =               thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   message_buffer_ptr -> tx_message_buffer_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            message_buffer_ptr -> tx_message_buffer_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Pickup the notify callback routine for this message buffer.  */
+            message_buffer_send_notify =  message_buffer_ptr -> tx_message_buffer_send_notify;
+#endif
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Determine if a notify callback is required.  */
+            if (thread_ptr -> tx_thread_suspend_status == TX_SUCCESS)
+            {
+
+                /* Determine if there is a notify callback.  */
+                if (message_buffer_send_notify != TX_NULL)
+                {
+
+                    /* Call application message buffer send notification.  */
+                    (message_buffer_send_notify)(message_buffer_ptr);
+                }
+            }
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Otherwise, just return a message buffer full error to the caller.  */
+
+#ifdef TX_MESSAGE_BUFFER_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the number of full non-suspensions on this message buffer.  */
+        message_buffer_ptr -> tx_message_buffer_performance_full_error_count++;
+
+        /* Increment the total number of full non-suspensions.  */
+        _tx_message_buffer_performance_full_error_count++;
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return error completion.  */
+        status =  TX_QUEUE_FULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_mutex_get                                       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -60,6 +60,8 @@
 /*    _tx_thread_system_suspend         Suspend thread service            */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*    _tx_mutex_priority_change         Inherit thread priority           */
+/*    _tx_mutex_spin                    Spin on mutex owned by thread on  */
+/*                                        another core                    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -72,6 +74,10 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added priority-ordered        */
+/*                                            suspension lists, added     */
+/*                                            adaptive spin, resulting in */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option)
@@ -86,7 +92,33 @@ TX_THREAD       *mutex_owner;
 TX_THREAD       *next_thread;
 TX_THREAD       *previous_thread;
 UINT            status;
+#if defined(TX_MUTEX_ENABLE_ADAPTIVE_SPIN) && defined(TX_MUTEX_ENABLE_PERFORMANCE_INFO)
+UINT            spin_status;
+#endif
+
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+#ifdef TX_MUTEX_ENABLE_PERFORMANCE_INFO
+
+    /* Default to no spin on the mutex.  */
+    spin_status =  TX_FALSE;
+#endif
+
+    /* Determine if the caller is willing to wait for the mutex.  */
+    if (wait_option != TX_NO_WAIT)
+    {
+
+#ifdef TX_MUTEX_ENABLE_PERFORMANCE_INFO
 
+        /* Spin while the mutex is owned by a thread executing on another core,
+           and remember if the mutex was polled.  */
+        spin_status =  _tx_mutex_spin(mutex_ptr);
+#else
+
+        /* Spin while the mutex is owned by a thread executing on another core.  */
+        (VOID) _tx_mutex_spin(mutex_ptr);
+#endif
+    }
+#endif
 
     /* Disable interrupts to get an instance from the mutex.  */
     TX_DISABLE
@@ -119,6 +151,17 @@ UINT            status;
         /* Remember that the calling thread owns the mutex.  */
         mutex_ptr -> tx_mutex_owner =  thread_ptr;
 
+#if defined(TX_MUTEX_ENABLE_ADAPTIVE_SPIN) && defined(TX_MUTEX_ENABLE_PERFORMANCE_INFO)
+
+        /* Determine if the mutex was obtained after a spin.  */
+        if (spin_status == TX_TRUE)
+        {
+
+            /* Increment the number of spins that obtained this mutex.  */
+            mutex_ptr -> tx_mutex_performance_spin_success_count++;
+        }
+#endif
+
         /* Determine if the thread pointer is valid.  */
         if (thread_ptr != TX_NULL)
         {
@@ -221,6 +264,17 @@ UINT            status;
                 /* Increment the number of suspensions on this mutex.  */
                 mutex_ptr -> tx_mutex_performance_suspension_count++;
 
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+
+                /* Determine if the thread spun on the mutex before this suspension.  */
+                if (spin_status == TX_TRUE)
+                {
+
+                    /* Increment the number of spins that ended in a suspension on this mutex.  */
+                    mutex_ptr -> tx_mutex_performance_spin_fail_count++;
+                }
+#endif
+
                 /* Determine if a priority inversion is present.  */
                 if (thread_ptr -> tx_thread_priority < mutex_owner -> tx_thread_priority)
                 {
@@ -258,8 +312,23 @@ UINT            status;
                 thread_ptr -> tx_thread_suspension_sequence++;
 #endif
 
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+                /* Determine if the suspension list is kept in priority order.  */
+                if (mutex_ptr -> tx_mutex_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+                {
+
+                    /* Place the thread in priority order.  */
+                    _tx_thread_priority_suspension_insert(&(mutex_ptr -> tx_mutex_suspension_list), &(mutex_ptr -> tx_mutex_priority_suspension), thread_ptr);
+                }
+
+                /* Setup suspension list.  */
+                else if (mutex_ptr -> tx_mutex_suspended_count == TX_NO_SUSPENSIONS)
+#else
+
                 /* Setup suspension list.  */
                 if (mutex_ptr -> tx_mutex_suspended_count == TX_NO_SUSPENSIONS)
+#endif
                 {
 
                     /* No other threads are suspended.  Setup the head pointer and
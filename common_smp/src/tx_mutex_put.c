@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_mutex_put                                       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -75,6 +75,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added priority-ordered        */
+/*                                            suspension lists, resulting */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_mutex_put(TX_MUTEX *mutex_ptr)
@@ -471,6 +474,17 @@ UINT            inheritance_priority;
 
                             /* Remove the suspended thread from the list.  */
 
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+                            /* Determine if the suspension list is kept in priority order.  */
+                            if (mutex_ptr -> tx_mutex_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+                            {
+
+                                /* Update the priority order for the removal of the thread.  */
+                                _tx_thread_priority_suspension_remove(mutex_ptr -> tx_mutex_suspension_list, &(mutex_ptr -> tx_mutex_priority_suspension), thread_ptr);
+                            }
+#endif
+
                             /* Decrement the suspension count.  */
                             mutex_ptr -> tx_mutex_suspended_count--;
 
@@ -0,0 +1,156 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Mutex                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_mutex.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_mutex_spin                                      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function polls the specified mutex while it is owned by a      */
+/*    thread that executes on another core, so a short critical section   */
+/*    of the owner does not cost the caller a suspension and a            */
+/*    resumption. The spin ends when the mutex is released, when the      */
+/*    owner no longer executes on another core or when the spin limit of  */
+/*    the mutex is reached. The mutex is only read here, the caller       */
+/*    obtains it or suspends with interrupts disabled afterwards.         */
+/*                                                                        */
+/*    This function must be called with interrupts enabled.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mutex_ptr                         Pointer to mutex control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           The mutex was polled at least     */
+/*                                        once                            */
+/*    TX_FALSE                          The owner does not execute on     */
+/*                                        another core                    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_mutex_get                     Get mutex                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_MUTEX_ENABLE_ADAPTIVE_SPIN
+UINT  _tx_mutex_spin(TX_MUTEX *mutex_ptr)
+{
+
+UINT            status;
+UINT            core;
+ULONG           spin_count;
+TX_THREAD       *mutex_owner;
+UINT            owner_core;
+
+
+    /* Default to no spin.  */
+    status =  TX_FALSE;
+
+    /* Pickup the core of the caller and the spin limit of the mutex.  */
+    core =        TX_SMP_CORE_ID;
+    spin_count =  mutex_ptr -> tx_mutex_spin_limit;
+
+    /* Poll the mutex until the spin limit is reached.  */
+    while (spin_count != ((ULONG) 0))
+    {
+
+        /* Determine if the mutex has been released.  The mutex is changed by
+           other cores, so it is read through a volatile pointer.  */
+        if (*((volatile UINT *) &(mutex_ptr -> tx_mutex_ownership_count)) == ((UINT) 0))
+        {
+
+            /* Yes, stop spinning.  */
+            break;
+        }
+
+        /* Pickup the owner of the mutex.  */
+        mutex_owner =  *((TX_THREAD * volatile *) &(mutex_ptr -> tx_mutex_owner));
+
+        /* Determine if the mutex is owned by initialization.  */
+        if (mutex_owner == TX_NULL)
+        {
+
+            /* Yes, the owner does not execute on a core.  */
+            break;
+        }
+
+        /* Pickup the core the owner is mapped to.  */
+        owner_core =  mutex_owner -> tx_thread_smp_core_mapped;
+
+        /* Determine if the owner is mapped to the core of the caller.  */
+        if (owner_core == core)
+        {
+
+            /* Yes, the owner cannot release the mutex while the caller spins.  */
+            break;
+        }
+
+        /* Determine if the owner is still executing on its core.  */
+        if (*((TX_THREAD * volatile *) &(_tx_thread_execute_ptr[owner_core])) != mutex_owner)
+        {
+
+            /* No, the owner is preempted or suspended, stop spinning.  */
+            break;
+        }
+
+        /* Remember that the mutex was polled.  */
+        status =  TX_TRUE;
+
+        /* Give the port a chance to relax the core while spinning.  */
+        TX_MUTEX_SPIN_PAUSE
+
+        /* Decrement the spin count.  */
+        spin_count--;
+    }
+
+    /* Return spin status.  */
+    return(status);
+}
+#endif
+
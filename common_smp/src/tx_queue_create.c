@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_queue_create                                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -43,7 +43,10 @@
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function creates a message queue.  The message size and depth  */
-/*    of the queue is specified by the caller.                            */
+/*    of the queue is specified by the caller.  A message size given in   */
+/*    bytes with TX_QUEUE_MESSAGE_BYTES is rounded up to whole ULONGs     */
+/*    for the message slots of the queue.  Only the bytes of the message  */
+/*    are copied to and from the buffers of the caller.                   */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -72,6 +75,11 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added message sizes in bytes, */
+/*                                            added exact copy of         */
+/*                                            messages with sizes in      */
+/*                                            bytes, resulting in version */
+/*                                            6.x                         */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
@@ -92,6 +100,23 @@ TX_QUEUE        *previous_queue;
     /* Setup the basic queue fields.  */
     queue_ptr -> tx_queue_name =             name_ptr;
 
+    /* Determine if the message size is specified in bytes.  */
+    if (message_size > TX_QUEUE_MESSAGE_BYTES_BASE)
+    {
+
+        /* Yes, save the number of bytes, which are copied exactly.  */
+        queue_ptr -> tx_queue_message_bytes =  message_size - TX_QUEUE_MESSAGE_BYTES_BASE;
+
+        /* Round the number of bytes up to the number of ULONGs of each message slot.  */
+        message_size =  ((message_size - TX_QUEUE_MESSAGE_BYTES_BASE) + ((UINT) (sizeof(ULONG))) - ((UINT) 1)) / ((UINT) (sizeof(ULONG)));
+    }
+    else
+    {
+
+        /* No, the message is a whole number of ULONGs.  */
+        queue_ptr -> tx_queue_message_bytes =  message_size * ((UINT) (sizeof(ULONG)));
+    }
+
     /* Save the message size in the control block.  */
     queue_ptr -> tx_queue_message_size =  message_size;
 
@@ -29,6 +29,7 @@
 #include "tx_trace.h"
 #include "tx_thread.h"
 #include "tx_queue.h"
+#include "tx_wait_set.h"
 
 
 /**************************************************************************/
@@ -36,7 +37,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_queue_delete                                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -59,6 +60,7 @@
 /*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_wait_set_member_remove        Remove member from wait set       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -71,6 +73,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added wait sets, resulting in */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_delete(TX_QUEUE *queue_ptr)
@@ -103,6 +107,17 @@ TX_QUEUE        *previous_queue;
     /* Clear the queue ID to make it invalid.  */
     queue_ptr -> tx_queue_id =  TX_CLEAR_ID;
 
+#ifdef TX_ENABLE_WAIT_SET
+
+    /* Determine if the queue is a member of a wait set.  */
+    if (queue_ptr -> tx_queue_wait_set_member.tx_wait_set_member_set != TX_NULL)
+    {
+
+        /* Yes, remove the queue from the wait set.  */
+        _tx_wait_set_member_remove(&(queue_ptr -> tx_queue_wait_set_member));
+    }
+#endif
+
     /* Decrement the number of created queues.  */
     _tx_queue_created_count--;
 
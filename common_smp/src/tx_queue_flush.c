@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_queue_flush                                     PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -57,6 +57,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_queue_priority_reset          Reset priority message lists      */
 /*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
@@ -72,6 +73,11 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added zero-copy reserve,      */
+/*                                            commit, acquire and release */
+/*                                            services, added priority    */
+/*                                            queues, resulting in        */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_flush(TX_QUEUE *queue_ptr)
@@ -82,11 +88,19 @@ TX_INTERRUPT_SAVE_AREA
 TX_THREAD       *suspension_list;
 UINT            suspended_count;
 TX_THREAD       *thread_ptr;
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+TX_THREAD       *resume_list;
+ULONG           offset;
+ULONG           area_size;
+#endif
 
 
     /* Initialize the suspended count and list.  */
     suspended_count =  TX_NO_SUSPENSIONS;
     suspension_list =  TX_NULL;
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+    resume_list =      TX_NULL;
+#endif
 
     /* Disable interrupts to reset various queue parameters.  */
     TX_DISABLE
@@ -103,12 +117,72 @@ TX_THREAD       *thread_ptr;
 
         /* Yes, there is something in the queue.  */
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+        /* Erase all of the queued messages by moving the read pointer past them. The
+           slots of reserved and acquired messages stay in place.  */
+        offset =     TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_read, queue_ptr -> tx_queue_start);
+        offset =     offset + (((ULONG) queue_ptr -> tx_queue_enqueued) * ((ULONG) queue_ptr -> tx_queue_message_size));
+        area_size =  TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_end, queue_ptr -> tx_queue_start);
+
+        /* Determine if we are past the end.  */
+        if (offset >= area_size)
+        {
+
+            /* Yes, wrap around to the beginning.  */
+            offset =  offset - area_size;
+        }
+
+        /* Setup the queue read pointer.  */
+        queue_ptr -> tx_queue_read =  TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_start, offset);
+
+        /* Determine if the slots are behind acquired messages.  */
+        if (queue_ptr -> tx_queue_acquired != ((UINT) 0))
+        {
+
+            /* Yes, the slots are held until the acquired messages are released.  */
+            queue_ptr -> tx_queue_consumed =  queue_ptr -> tx_queue_consumed + queue_ptr -> tx_queue_enqueued;
+        }
+        else
+        {
+
+            /* Increase the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage =  queue_ptr -> tx_queue_available_storage + queue_ptr -> tx_queue_enqueued;
+        }
+
+        /* No more messages are enqueued.  */
+        queue_ptr -> tx_queue_enqueued =  TX_NO_MESSAGES;
+
+        /* Give the room to the threads suspended on the queue, if any. Since they may be
+           reserving slots, their messages are placed in the queue rather than discarded.  */
+        resume_list =  _tx_queue_zero_copy_settle(queue_ptr);
+
+        /* Determine if any suspended threads were served.  */
+        if (resume_list != TX_NULL)
+        {
+
+            /* Disable preemption until all of the threads are resumed.  */
+            _tx_thread_preempt_disable++;
+        }
+#else
+
         /* Reset the queue parameters to erase all of the queued messages.  */
         queue_ptr -> tx_queue_enqueued =           TX_NO_MESSAGES;
         queue_ptr -> tx_queue_available_storage =  queue_ptr -> tx_queue_capacity;
         queue_ptr -> tx_queue_read =               queue_ptr -> tx_queue_start;
         queue_ptr -> tx_queue_write =              queue_ptr -> tx_queue_start;
 
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+        /* Determine if the queue orders its messages by priority.  */
+        if (queue_ptr -> tx_queue_priorities != ((UINT) 0))
+        {
+
+            /* Yes, empty the message lists and free all of the message slots.  */
+            _tx_queue_priority_reset(queue_ptr);
+        }
+#endif
+
         /* Now determine if there are any threads suspended on a full queue.  */
         if (queue_ptr -> tx_queue_suspended_count != TX_NO_SUSPENSIONS)
         {
@@ -127,11 +201,23 @@ TX_THREAD       *thread_ptr;
             /* Temporarily disable preemption.  */
             _tx_thread_preempt_disable++;
         }
+#endif
     }
 
     /* Restore interrupts.  */
     TX_RESTORE
 
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+    /* Determine if there are threads to resume.  */
+    if (resume_list != TX_NULL)
+    {
+
+        /* Resume the threads.  */
+        _tx_queue_threads_resume(resume_list);
+    }
+#endif
+
     /* Walk through the queue list to resume any and all threads suspended
        on this queue.  */
     if (suspended_count != TX_NO_SUSPENSIONS)
@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_message_bytes_copy                        PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a message of a queue whose message size was    */
+/*    given in bytes and ends within a ULONG. The whole ULONGs of the     */
+/*    message are copied with the message copy macro, and the bytes of    */
+/*    the last ULONG one at a time, so no byte past the end of the        */
+/*    message is read or written. The source and destination pointers     */
+/*    are moved past the last ULONG of the message.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    source                            Pointer to the source pointer     */
+/*    destination                       Pointer to the destination        */
+/*                                        pointer                         */
+/*    message_bytes                     Number of bytes of the message    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_overwrite_send          Send message, overwriting oldest  */
+/*    _tx_queue_priority_front_insert   Insert message ahead of all       */
+/*                                        priorities                      */
+/*    _tx_queue_priority_insert         Insert message by priority        */
+/*    _tx_queue_priority_remove         Remove highest priority message   */
+/*    _tx_queue_priority_send           Send message with priority        */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_multiple        Receive messages from queue       */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_multiple           Send messages to queue            */
+/*    _tx_queue_zero_copy_settle        Settle zero-copy messages         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_queue_message_bytes_copy(ULONG **source, ULONG **destination, UINT message_bytes)
+{
+
+ULONG       *source_ptr;
+ULONG       *destination_ptr;
+UCHAR       *source_byte_ptr;
+UCHAR       *destination_byte_ptr;
+UINT        size;
+UINT        bytes;
+
+
+    /* Pickup the source and destination pointers.  */
+    source_ptr =       *source;
+    destination_ptr =  *destination;
+
+    /* Calculate the number of whole ULONGs of the message.  */
+    size =  message_bytes / ((UINT) (sizeof(ULONG)));
+
+    /* Determine if the message has any whole ULONGs.  */
+    if (size != ((UINT) 0))
+    {
+
+        /* Yes, copy them. Note that the source and destination pointers are
+           incremented by the macro.  */
+        TX_QUEUE_MESSAGE_COPY(source_ptr, destination_ptr, size)
+    }
+
+    /* Copy the bytes of the last ULONG one at a time.  */
+    source_byte_ptr =       TX_VOID_TO_UCHAR_POINTER_CONVERT(source_ptr);
+    destination_byte_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(destination_ptr);
+    bytes =  message_bytes % ((UINT) (sizeof(ULONG)));
+    while (bytes != ((UINT) 0))
+    {
+
+        /* Copy a byte.  */
+        *destination_byte_ptr =  *source_byte_ptr;
+        destination_byte_ptr++;
+        source_byte_ptr++;
+        bytes--;
+    }
+
+    /* Move the source and destination pointers past the last ULONG.  */
+    *source =       TX_ULONG_POINTER_ADD(source_ptr, 1);
+    *destination =  TX_ULONG_POINTER_ADD(destination_ptr, 1);
+}
+
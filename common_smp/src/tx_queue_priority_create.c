@@ -0,0 +1,254 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_priority_create                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a message queue that orders its messages by   */
+/*    priority. Messages of the same priority are received in the order   */
+/*    in which they were sent. The first and last message slot of each    */
+/*    priority are kept at the start of the queue area, ahead of the      */
+/*    message slots, and the priorities that have messages are kept in a  */
+/*    bit map, so that both sending and receiving take constant time.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    name_ptr                          Pointer to queue name             */
+/*    message_size                      Size of each queue message        */
+/*    queue_start                       Starting address of the queue     */
+/*                                        area                            */
+/*    queue_size                        Number of bytes in the queue      */
+/*    priorities                        Number of message priorities      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_FEATURE_NOT_ENABLED            Priority queues are not enabled   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_priority_reset          Reset priority message lists      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_priority_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *queue_start, ULONG queue_size, UINT priorities)
+{
+
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            capacity;
+ULONG           list_words;
+TX_QUEUE        *next_queue;
+TX_QUEUE        *previous_queue;
+
+
+    /* Initialize queue control block to all zeros.  */
+    TX_MEMSET(queue_ptr, 0, (sizeof(TX_QUEUE)));
+
+    /* Setup the basic queue fields.  */
+    queue_ptr -> tx_queue_name =             name_ptr;
+
+    /* Determine if the message size is specified in bytes.  */
+    if (message_size > TX_QUEUE_MESSAGE_BYTES_BASE)
+    {
+
+        /* Yes, save the number of bytes, which are copied exactly.  */
+        queue_ptr -> tx_queue_message_bytes =  message_size - TX_QUEUE_MESSAGE_BYTES_BASE;
+
+        /* Round the number of bytes up to the number of ULONGs of each message slot.  */
+        message_size =  ((message_size - TX_QUEUE_MESSAGE_BYTES_BASE) + ((UINT) (sizeof(ULONG))) - ((UINT) 1)) / ((UINT) (sizeof(ULONG)));
+    }
+    else
+    {
+
+        /* No, the message is a whole number of ULONGs.  */
+        queue_ptr -> tx_queue_message_bytes =  message_size * ((UINT) (sizeof(ULONG)));
+    }
+
+    /* Save the message size and the number of priorities in the control block.  */
+    queue_ptr -> tx_queue_message_size =  message_size;
+    queue_ptr -> tx_queue_priorities =    priorities;
+
+    /* The first and last message slot of each priority are at the start of the
+       queue area.  */
+    list_words =  ((ULONG) priorities) * ((ULONG) 2);
+    queue_ptr -> tx_queue_priority_lists =  TX_VOID_TO_ULONG_POINTER_CONVERT(queue_start);
+
+    /* Determine how many message slots will fit in the rest of the queue area. Each
+       slot has a link to the next slot ahead of the message.  */
+    capacity =  (UINT) (((queue_size / (sizeof(ULONG))) - list_words) / (((ULONG) message_size) + ((ULONG) 1)));
+
+    /* Save the starting address and calculate the ending address of
+       the message slots.  Note that the ending address is really one past the
+       end!  */
+    queue_ptr -> tx_queue_start =  TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_priority_lists, list_words);
+    queue_ptr -> tx_queue_end =    TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_start, (((ULONG) capacity) * (((ULONG) message_size) + ((ULONG) 1))));
+
+    /* The read and write pointers are not used by a priority queue.  */
+    queue_ptr -> tx_queue_read =   queue_ptr -> tx_queue_start;
+    queue_ptr -> tx_queue_write =  queue_ptr -> tx_queue_start;
+
+    /* Setup the number of enqueued messages and the number of message
+       slots available in the queue.  */
+    queue_ptr -> tx_queue_available_storage =  (UINT) capacity;
+    queue_ptr -> tx_queue_capacity =           (UINT) capacity;
+
+    /* Empty the message lists and link all of the message slots on the free list.  */
+    _tx_queue_priority_reset(queue_ptr);
+
+    /* Disable interrupts to put the queue on the created list.  */
+    TX_DISABLE
+
+    /* Setup the queue ID to make it valid.  */
+    queue_ptr -> tx_queue_id =  TX_QUEUE_ID;
+
+    /* Place the queue on the list of created queues.  First,
+       check for an empty list.  */
+    if (_tx_queue_created_count == TX_EMPTY)
+    {
+
+        /* The created queue list is empty.  Add queue to empty list.  */
+        _tx_queue_created_ptr =                   queue_ptr;
+        queue_ptr -> tx_queue_created_next =      queue_ptr;
+        queue_ptr -> tx_queue_created_previous =  queue_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_queue =      _tx_queue_created_ptr;
+        previous_queue =  next_queue -> tx_queue_created_previous;
+
+        /* Place the new queue in the list.  */
+        next_queue -> tx_queue_created_previous =  queue_ptr;
+        previous_queue -> tx_queue_created_next =  queue_ptr;
+
+        /* Setup this queues's created links.  */
+        queue_ptr -> tx_queue_created_previous =  previous_queue;
+        queue_ptr -> tx_queue_created_next =      next_queue;
+    }
+
+    /* Increment the created queue count.  */
+    _tx_queue_created_count++;
+
+    /* Optional queue create extended processing.  */
+    TX_QUEUE_CREATE_EXTENSION(queue_ptr)
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_QUEUE, queue_ptr, name_ptr, queue_size, message_size)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_PRIORITY_CREATE, queue_ptr, message_size, TX_POINTER_TO_ULONG_CONVERT(queue_start), priorities, TX_TRACE_QUEUE_EVENTS)
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT    status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (queue_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (name_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (message_size != ((UINT) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (queue_start != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (queue_size != ((ULONG) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (priorities != ((UINT) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
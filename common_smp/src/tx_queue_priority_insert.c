@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_priority_insert                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a message into a free slot of a priority       */
+/*    queue and appends the slot to the list of the specified priority,   */
+/*    which sets the priority in the bit map of the queue. It is called   */
+/*    with interrupts disabled and with a free slot in the queue, the     */
+/*    caller updates the enqueued and available counts.                   */
+/*                                                                        */
+/*    Each message slot starts with the number of the next slot on the    */
+/*    same list, slots are numbered from one and zero ends a list.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    source                            Pointer to message source         */
+/*    priority                          Priority of the message           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_priority_send           Send message by priority          */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_multiple        Receive messages from queue       */
+/*    _tx_queue_send_multiple           Send messages to queue            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+VOID  _tx_queue_priority_insert(TX_QUEUE *queue_ptr, ULONG *source, UINT priority)
+{
+
+ULONG           *lists;
+ULONG           *slot;
+ULONG           *destination;
+ULONG           slot_index;
+ULONG           last_index;
+ULONG           priority_bit;
+UINT            size;
+
+
+    /* Pickup the first free message slot.  */
+    slot_index =  queue_ptr -> tx_queue_priority_free;
+    slot =        TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_start, ((slot_index - ((ULONG) 1)) * (((ULONG) queue_ptr -> tx_queue_message_size) + ((ULONG) 1))));
+
+    /* Remove the message slot from the free list, it ends the list of the priority.  */
+    queue_ptr -> tx_queue_priority_free =  *slot;
+    *slot =  ((ULONG) 0);
+
+    /* Copy message. Note that the source and destination pointers are
+       incremented by the macro.  */
+    destination =  TX_ULONG_POINTER_ADD(slot, 1);
+    size =         queue_ptr -> tx_queue_message_size;
+    TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+    /* Pickup the lists and the bit of the priority.  */
+    lists =         queue_ptr -> tx_queue_priority_lists;
+    priority_bit =  (((ULONG) 1) << priority);
+
+    /* Determine if the priority has messages.  */
+    if ((queue_ptr -> tx_queue_priority_map & priority_bit) != ((ULONG) 0))
+    {
+
+        /* Yes, link the message slot after the last one of the priority.  */
+        last_index =  lists[(priority * ((UINT) 2)) + ((UINT) 1)];
+        slot =        TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_start, ((last_index - ((ULONG) 1)) * (((ULONG) queue_ptr -> tx_queue_message_size) + ((ULONG) 1))));
+        *slot =       slot_index;
+    }
+    else
+    {
+
+        /* No, the message slot starts the list of the priority.  */
+        lists[priority * ((UINT) 2)] =  slot_index;
+
+        /* Set the priority in the bit map.  */
+        queue_ptr -> tx_queue_priority_map =  queue_ptr -> tx_queue_priority_map | priority_bit;
+    }
+
+    /* The message slot is the last one of the priority.  */
+    lists[(priority * ((UINT) 2)) + ((UINT) 1)] =  slot_index;
+}
+#endif
+
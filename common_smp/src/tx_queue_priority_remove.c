@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+#define TX_THREAD_SMP_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_priority_remove                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies the oldest message of the highest priority     */
+/*    out of a priority queue and places its slot on the free list. The   */
+/*    highest priority with messages is the lowest bit set in the bit     */
+/*    map of the queue. It is called with interrupts disabled and with    */
+/*    messages in the queue, the caller updates the enqueued and          */
+/*    available counts.                                                   */
+/*                                                                        */
+/*    Each message slot starts with the number of the next slot on the    */
+/*    same list, slots are numbered from one and zero ends a list.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    destination                       Pointer to message destination    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_message_bytes_copy      Copy message with size in bytes   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_multiple        Receive messages from queue       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_QUEUE_ENABLE_MESSAGE_PRIORITY
+VOID  _tx_queue_priority_remove(TX_QUEUE *queue_ptr, ULONG *destination)
+{
+
+ULONG           *lists;
+ULONG           *slot;
+ULONG           *source;
+ULONG           slot_index;
+ULONG           priority_map;
+ULONG           priority;
+UINT            size;
+
+
+    /* Find the highest priority with messages.  */
+    priority_map =  queue_ptr -> tx_queue_priority_map;
+    TX_LOWEST_SET_BIT_CALCULATE(priority_map, priority)
+
+    /* Pickup the first message slot of the priority.  */
+    lists =       queue_ptr -> tx_queue_priority_lists;
+    slot_index =  lists[priority * ((ULONG) 2)];
+    slot =        TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_start, ((slot_index - ((ULONG) 1)) * (((ULONG) queue_ptr -> tx_queue_message_size) + ((ULONG) 1))));
+
+    /* Copy message. Note that the source and destination pointers are
+       incremented by the macro.  */
+    source =  TX_ULONG_POINTER_ADD(slot, 1);
+    size =    queue_ptr -> tx_queue_message_size;
+    TX_QUEUE_MESSAGE_EXACT_COPY(queue_ptr, source, destination, size)
+
+    /* Remove the message slot from the list of the priority.  */
+    lists[priority * ((ULONG) 2)] =  *slot;
+
+    /* Determine if the priority has no more messages.  */
+    if (*slot == ((ULONG) 0))
+    {
+
+        /* Clear the priority in the bit map.  */
+        queue_ptr -> tx_queue_priority_map =  queue_ptr -> tx_queue_priority_map & (~(((ULONG) 1) << priority));
+    }
+
+    /* Place the message slot on the free list.  */
+    *slot =  queue_ptr -> tx_queue_priority_free;
+    queue_ptr -> tx_queue_priority_free =  slot_index;
+}
+#endif
+
@@ -0,0 +1,304 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_send_reserve                              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reserves the slot of the next message in the          */
+/*    specified queue and returns a pointer to it, so the caller can      */
+/*    build the message in place instead of having it copied by           */
+/*    tx_queue_send. The message, and any message sent after it, is held  */
+/*    back from receivers until the reservation is committed with         */
+/*    tx_queue_send_commit. If there is no room in the queue, this        */
+/*    function waits according to the option specified.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    message_ptr                       Destination for pointer to the    */
+/*                                        message slot                    */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_send_reserve(TX_QUEUE *queue_ptr, VOID **message_ptr, ULONG wait_option)
+{
+
+#ifdef TX_QUEUE_ENABLE_ZERO_COPY
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+ULONG           *destination;
+UINT            suspended_count;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts to reserve a message slot in the queue.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_SEND_RESERVE, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(message_ptr), wait_option, queue_ptr -> tx_queue_available_storage, TX_TRACE_QUEUE_EVENTS)
+
+    /* Pickup the thread suspension count.  */
+    suspended_count =  queue_ptr -> tx_queue_suspended_count;
+
+    /* Determine if there is room in the queue.  */
+    if (queue_ptr -> tx_queue_available_storage != TX_NO_MESSAGES)
+    {
+
+        /* Yes, give the slot at the write pointer to the caller. The slot, and any
+           message sent after it, is held back until the reservation is committed.  */
+        *message_ptr =  (VOID *) queue_ptr -> tx_queue_write;
+
+        /* Move the write pointer past the slot.  */
+        destination =  TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_write, queue_ptr -> tx_queue_message_size);
+
+        /* Determine if we are at the end.  */
+        if (destination == queue_ptr -> tx_queue_end)
+        {
+
+            /* Yes, wrap around to the beginning.  */
+            destination =  queue_ptr -> tx_queue_start;
+        }
+
+        /* Adjust the write pointer.  */
+        queue_ptr -> tx_queue_write =  destination;
+
+        /* Reduce the amount of available storage.  */
+        queue_ptr -> tx_queue_available_storage--;
+
+        /* Increase the reserved and pending counts.  */
+        queue_ptr -> tx_queue_reserved++;
+        queue_ptr -> tx_queue_pending++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero, or if the threads suspended on
+           the queue are receiving from the queue. The latter only happens while all of the
+           queue is held by reservations and acquisitions.  */
+        if ((_tx_thread_preempt_disable != ((UINT) 0)) ||
+            ((suspended_count != TX_NO_SUSPENSIONS) && (queue_ptr -> tx_queue_suspension_list -> tx_thread_suspend_info < TX_QUEUE_SEND_SUSPEND)))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed at this point - return error completion.  */
+            status =  TX_QUEUE_FULL;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total number of queue full suspensions.  */
+            _tx_queue_performance_full_suspension_count++;
+
+            /* Increment the number of full suspensions on this queue.  */
+            queue_ptr -> tx_queue_performance_full_suspension_count++;
+#endif
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_queue_cleanup);
+
+            /* Setup cleanup information, i.e. this queue control block, where to
+               return the message slot and the kind of suspension.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) queue_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) message_ptr;
+            thread_ptr -> tx_thread_suspend_info =             TX_QUEUE_RESERVE_SUSPEND;
+            thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                queue_ptr -> tx_queue_suspension_list =         thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   queue_ptr -> tx_queue_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            queue_ptr -> tx_queue_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Otherwise, just return a queue full error message to the caller.  */
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the number of full non-suspensions on this queue.  */
+        queue_ptr -> tx_queue_performance_full_error_count++;
+
+        /* Increment the total number of full non-suspensions.  */
+        _tx_queue_performance_full_error_count++;
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return error completion.  */
+        status =  TX_QUEUE_FULL;
+    }
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (queue_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (message_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
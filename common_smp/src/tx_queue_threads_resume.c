@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_threads_resume                            PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resumes a list of threads that were removed from the  */
+/*    suspension list of a queue, linked through their suspended next     */
+/*    pointers. The caller disables preemption before restoring           */
+/*    interrupts and calls this function with interrupts enabled, the     */
+/*    preemption is enabled again once all of the threads are resumed.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    resume_list                       List of threads to resume         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_flush                   Flush queue messages              */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_multiple        Receive messages from queue       */
+/*    _tx_queue_receive_release         Release acquired message          */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_multiple           Send messages to queue            */
+/*    _tx_queue_send_commit             Commit reserved message           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_queue_threads_resume(TX_THREAD *resume_list)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+
+
+    /* Walk through the list of threads to resume.  */
+    thread_ptr =  resume_list;
+    while (thread_ptr != TX_NULL)
+    {
+
+        /* Get next pointer first.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Disable preemption again.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+
+        /* Move next thread to current.  */
+        thread_ptr =  next_thread;
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Release thread preemption disable.  */
+    _tx_thread_preempt_disable--;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Check for preemption.  */
+    _tx_thread_system_preempt_check();
+}
+
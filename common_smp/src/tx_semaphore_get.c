@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _tx_semaphore_get                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -71,6 +71,11 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Supported threads waiting for */
+/*                                            more than one instance,     */
+/*                                            added priority-ordered      */
+/*                                            suspension lists, resulting */
+/*                                            in version 6.x              */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_semaphore_get(TX_SEMAPHORE *semaphore_ptr, ULONG wait_option)
@@ -154,6 +159,9 @@ UINT            status;
                block.  */
             thread_ptr -> tx_thread_suspend_control_block =  (VOID *) semaphore_ptr;
 
+            /* Save the number of instances requested.  */
+            thread_ptr -> tx_thread_suspend_info =  ((ULONG) 1);
+
 #ifndef TX_NOT_INTERRUPTABLE
 
             /* Increment the suspension sequence number, which is used to identify
@@ -161,8 +169,23 @@ UINT            status;
             thread_ptr -> tx_thread_suspension_sequence++;
 #endif
 
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+            /* Determine if the suspension list is kept in priority order.  */
+            if (semaphore_ptr -> tx_semaphore_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+            {
+
+                /* Place the thread in priority order.  */
+                _tx_thread_priority_suspension_insert(&(semaphore_ptr -> tx_semaphore_suspension_list), &(semaphore_ptr -> tx_semaphore_priority_suspension), thread_ptr);
+            }
+
+            /* Setup suspension list.  */
+            else if (semaphore_ptr -> tx_semaphore_suspended_count == TX_NO_SUSPENSIONS)
+#else
+
             /* Setup suspension list.  */
             if (semaphore_ptr -> tx_semaphore_suspended_count == TX_NO_SUSPENSIONS)
+#endif
             {
 
                 /* No other threads are suspended.  Setup the head pointer and
@@ -0,0 +1,253 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Semaphore                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_semaphore.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_semaphore_get_count                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function gets the specified number of instances from the       */
+/*    semaphore in one operation. If they are not available, the calling  */
+/*    thread may suspend until a put makes them available. Suspended      */
+/*    threads are served in suspension order whenever their request can   */
+/*    be satisfied, so a request for fewer instances may complete before  */
+/*    an earlier, larger one.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    semaphore_ptr                     Pointer to semaphore control      */
+/*                                        block                           */
+/*    count                             Number of instances to get        */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_suspend         Suspend thread service            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_semaphore_get_count(TX_SEMAPHORE *semaphore_ptr, ULONG count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts to get instances from the semaphore.  */
+    TX_DISABLE
+
+#ifdef TX_SEMAPHORE_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total semaphore get counter.  */
+    _tx_semaphore_performance_get_count++;
+
+    /* Increment the number of attempts to get this semaphore.  */
+    semaphore_ptr -> tx_semaphore_performance_get_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_SEMAPHORE_GET_COUNT, semaphore_ptr, count, wait_option, semaphore_ptr -> tx_semaphore_count, TX_TRACE_SEMAPHORE_EVENTS)
+
+    /* Determine if the requested instances of the semaphore are available.  */
+    if (semaphore_ptr -> tx_semaphore_count >= count)
+    {
+
+        /* Subtract the instances from the semaphore count.  */
+        semaphore_ptr -> tx_semaphore_count =  semaphore_ptr -> tx_semaphore_count - count;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_NO_INSTANCE;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+#ifdef TX_SEMAPHORE_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total semaphore suspensions counter.  */
+            _tx_semaphore_performance_suspension_count++;
+
+            /* Increment the number of suspensions on this semaphore.  */
+            semaphore_ptr -> tx_semaphore_performance_suspension_count++;
+#endif
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_semaphore_cleanup);
+
+            /* Setup cleanup information, i.e. this semaphore control
+               block.  */
+            thread_ptr -> tx_thread_suspend_control_block =  (VOID *) semaphore_ptr;
+
+            /* Save the number of instances requested.  */
+            thread_ptr -> tx_thread_suspend_info =  count;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+            /* Determine if the suspension list is kept in priority order.  */
+            if (semaphore_ptr -> tx_semaphore_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+            {
+
+                /* Place the thread in priority order.  */
+                _tx_thread_priority_suspension_insert(&(semaphore_ptr -> tx_semaphore_suspension_list), &(semaphore_ptr -> tx_semaphore_priority_suspension), thread_ptr);
+            }
+
+            /* Setup suspension list.  */
+            else if (semaphore_ptr -> tx_semaphore_suspended_count == TX_NO_SUSPENSIONS)
+#else
+
+            /* Setup suspension list.  */
+            if (semaphore_ptr -> tx_semaphore_suspended_count == TX_NO_SUSPENSIONS)
+#endif
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                semaphore_ptr -> tx_semaphore_suspension_list =         thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =                thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =            thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   semaphore_ptr -> tx_semaphore_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the number of suspensions.  */
+            semaphore_ptr -> tx_semaphore_suspended_count++;
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_SEMAPHORE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Immediate return, return error completion.  */
+        status =  TX_NO_INSTANCE;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
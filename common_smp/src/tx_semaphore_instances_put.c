@@ -0,0 +1,283 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Semaphore                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_semaphore.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_semaphore_instances_put                         PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds the specified number of instances to the         */
+/*    semaphore and resumes, in suspension order, every suspended thread  */
+/*    whose requested number of instances is available. All satisfied     */
+/*    threads are removed from the suspension list in one critical        */
+/*    section and resumed with preemption disabled, followed by a single  */
+/*    check for preemption.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    semaphore_ptr                     Pointer to semaphore control      */
+/*                                        block                           */
+/*    count                             Number of instances to put        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_wait_set_signal               Signal wait set member            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_semaphore_put                 Put semaphore                     */
+/*    _tx_semaphore_ceiling_put         Put semaphore with ceiling        */
+/*    _tx_semaphore_put_count           Put semaphore instances           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_semaphore_instances_put(TX_SEMAPHORE *semaphore_ptr, ULONG count)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_suspended_thread;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+TX_THREAD       *resumed_list;
+TX_THREAD       *last_resumed;
+UINT            suspended_count;
+ULONG           available;
+ULONG           requested;
+
+
+    /* Setup the resumed thread pointers.  */
+    resumed_list =  TX_NULL;
+    last_resumed =  TX_NULL;
+
+    /* Disable interrupts to put the instances back to the semaphore.  */
+    TX_DISABLE
+
+    /* Calculate the available instances.  */
+    available =  semaphore_ptr -> tx_semaphore_count + count;
+
+    /* Pickup the first suspended thread and the number of suspended threads.  */
+    thread_ptr =       semaphore_ptr -> tx_semaphore_suspension_list;
+    suspended_count =  semaphore_ptr -> tx_semaphore_suspended_count;
+
+    /* Loop to examine the suspended threads in suspension order, as long as
+       instances are available.  */
+    while ((suspended_count != TX_NO_SUSPENSIONS) && (available != ((ULONG) 0)))
+    {
+
+        /* Save next thread pointer.  */
+        next_suspended_thread =  thread_ptr -> tx_thread_suspended_next;
+
+        /* Pickup the number of instances requested by this thread.  */
+        requested =  thread_ptr -> tx_thread_suspend_info;
+
+        /* Determine if the request is satisfied.  */
+        if (requested <= available)
+        {
+
+            /* Yes, give the requested instances to this thread.  */
+            available =  available - requested;
+
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+
+            /* Determine if the suspension list is kept in priority order.  */
+            if (semaphore_ptr -> tx_semaphore_priority_suspension.tx_priority_suspension_enabled == TX_TRUE)
+            {
+
+                /* Update the priority order for the removal of the thread.  */
+                _tx_thread_priority_suspension_remove(semaphore_ptr -> tx_semaphore_suspension_list, &(semaphore_ptr -> tx_semaphore_priority_suspension), thread_ptr);
+            }
+#endif
+
+            /* Decrement the suspension count.  */
+            semaphore_ptr -> tx_semaphore_suspended_count--;
+
+            /* Remove the thread from the suspension list.  */
+
+            /* See if this is the only suspended thread on the list.  */
+            if (semaphore_ptr -> tx_semaphore_suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                semaphore_ptr -> tx_semaphore_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the links of the adjacent threads.  */
+                next_thread =                                   thread_ptr -> tx_thread_suspended_next;
+                previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =   previous_thread;
+                previous_thread -> tx_thread_suspended_next =   next_thread;
+
+                /* Determine if we need to update the head pointer.  */
+                if (semaphore_ptr -> tx_semaphore_suspension_list == thread_ptr)
+                {
+
+                    /* Update the list head pointer.  */
+                    semaphore_ptr -> tx_semaphore_suspension_list =   next_thread;
+                }
+            }
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Place this thread on the resumed list.  */
+            thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+            if (resumed_list == TX_NULL)
+            {
+
+                /* First thread on the resumed list.  */
+                resumed_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link it up at the end.  */
+                last_resumed -> tx_thread_suspended_next =  thread_ptr;
+            }
+            last_resumed =  thread_ptr;
+        }
+
+        /* Move to the next suspended thread.  */
+        thread_ptr =  next_suspended_thread;
+
+        /* Decrement the number of threads to examine.  */
+        suspended_count--;
+    }
+
+    /* Update the semaphore count with the remaining instances.  */
+    semaphore_ptr -> tx_semaphore_count =  available;
+
+    /* Determine if any threads are resumed.  */
+    if (resumed_list == TX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* Disable preemption while the resumed threads are processed.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Walk through the resumed list.  */
+        thread_ptr =  resumed_list;
+        while (thread_ptr != TX_NULL)
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupt posture.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+
+            /* Move next thread to current.  */
+            thread_ptr =  next_thread;
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Release thread preemption disable.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* One or more threads were resumed, check for preemption.  */
+        _tx_thread_system_preempt_check();
+    }
+
+#ifdef TX_ENABLE_WAIT_SET
+
+    /* Determine if instances remain and the semaphore is a member of a wait set.  */
+    if ((available != ((ULONG) 0)) && (semaphore_ptr -> tx_semaphore_wait_set_member.tx_wait_set_member_set != TX_NULL))
+    {
+
+        /* Yes, resume a thread waiting on the wait set if the semaphore is still ready.  */
+        _tx_wait_set_signal(&(semaphore_ptr -> tx_semaphore_wait_set_member));
+    }
+#endif
+}
+
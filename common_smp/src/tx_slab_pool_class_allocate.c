@@ -0,0 +1,225 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_slab_pool_class_allocate                        PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a block for the specified request size      */
+/*    from the smallest size class of the slab pool that fits the         */
+/*    request. The class is found with a single lookup in the routing     */
+/*    table of the pool. If all pages of the class are full, a free page  */
+/*    of the pool is given to the class. If the pool was created with     */
+/*    TX_SLAB_POOL_BORROW_PAGES and the class cannot get a page, the      */
+/*    larger classes are tried in order. This function must be called     */
+/*    with interrupts disabled.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to slab pool control block*/
+/*    memory_size                       Number of bytes requested         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    block_ptr                         Pointer to the allocated block, or*/
+/*                                        TX_NULL if no block is available*/
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_slab_allocate                 Allocate memory from a slab pool  */
+/*    _tx_slab_release                  Release memory to a slab pool     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_slab_pool_class_allocate(TX_SLAB_POOL *pool_ptr, ULONG memory_size)
+{
+
+UINT                class_index;
+UINT                last_class;
+TX_SLAB_POOL_CLASS  *class_ptr;
+TX_SLAB_POOL_PAGE   *page_ptr;
+TX_SLAB_POOL_PAGE   *next_page;
+TX_SLAB_POOL_PAGE   *previous_page;
+UCHAR               *page_memory;
+UCHAR               *work_ptr;
+UCHAR               *block_ptr;
+UCHAR               **next_block_ptr;
+
+
+    /* Route the request to the smallest size class that fits it.  */
+    class_index =  (UINT) pool_ptr -> tx_slab_pool_route[(memory_size - ((ULONG) 1))/(TX_SLAB_POOL_ROUTE_GRANULE)];
+
+    /* Determine if the request may borrow from the larger size classes.  */
+    if ((pool_ptr -> tx_slab_pool_options & TX_SLAB_POOL_BORROW_PAGES) != ((UINT) 0))
+    {
+
+        /* Yes, all of the larger size classes may be tried.  */
+        last_class =  pool_ptr -> tx_slab_pool_class_count;
+    }
+    else
+    {
+
+        /* No, only the routed size class is tried.  */
+        last_class =  class_index + ((UINT) 1);
+    }
+
+    /* Default the block pointer to NULL.  */
+    block_ptr =  TX_NULL;
+
+    /* Loop through the size classes until a block is found.  */
+    while (class_index < last_class)
+    {
+
+        /* Pickup the size class.  */
+        class_ptr =  &(pool_ptr -> tx_slab_pool_class[class_index]);
+
+        /* Determine if all of the pages of the class are full.  */
+        if (class_ptr -> tx_slab_pool_class_page_list == TX_NULL)
+        {
+
+            /* Determine if the pool has a free page.  */
+            page_ptr =  pool_ptr -> tx_slab_pool_page_list;
+            if (page_ptr != TX_NULL)
+            {
+
+                /* Yes, remove the page from the free page list.  */
+                pool_ptr -> tx_slab_pool_page_list =  page_ptr -> tx_slab_pool_page_next;
+                pool_ptr -> tx_slab_pool_pages_available--;
+
+                /* Setup the page for the size class.  The blocks of the page are
+                   carved as they are needed.  */
+                page_memory =                                   TX_SLAB_POOL_PAGE_TO_UCHAR_POINTER_CONVERT(page_ptr);
+                page_ptr -> tx_slab_pool_page_class =           class_ptr;
+                page_ptr -> tx_slab_pool_page_free_list =       TX_NULL;
+                page_ptr -> tx_slab_pool_page_carve =           TX_UCHAR_POINTER_ADD(page_memory, TX_SLAB_POOL_PAGE_HEADER_SIZE);
+                page_ptr -> tx_slab_pool_page_uncarved =        class_ptr -> tx_slab_pool_class_page_blocks;
+                page_ptr -> tx_slab_pool_page_used =            ((UINT) 0);
+
+                /* Place the page on the empty page list of the class.  */
+                page_ptr -> tx_slab_pool_page_next =            page_ptr;
+                page_ptr -> tx_slab_pool_page_previous =        page_ptr;
+                class_ptr -> tx_slab_pool_class_page_list =     page_ptr;
+
+                /* Update the page and block counts of the class.  */
+                class_ptr -> tx_slab_pool_class_pages++;
+                class_ptr -> tx_slab_pool_class_available =     class_ptr -> tx_slab_pool_class_available + class_ptr -> tx_slab_pool_class_page_blocks;
+            }
+        }
+
+        /* Pickup the first page of the class with a free block.  */
+        page_ptr =  class_ptr -> tx_slab_pool_class_page_list;
+        if (page_ptr != TX_NULL)
+        {
+
+            /* Determine if the page has a released block.  */
+            work_ptr =  page_ptr -> tx_slab_pool_page_free_list;
+            if (work_ptr != TX_NULL)
+            {
+
+                /* Yes, remove the block from the free list of the page.  */
+                next_block_ptr =                            TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                page_ptr -> tx_slab_pool_page_free_list =   *next_block_ptr;
+            }
+            else
+            {
+
+                /* No, carve the next block from the page.  */
+                work_ptr =                                  page_ptr -> tx_slab_pool_page_carve;
+                page_ptr -> tx_slab_pool_page_carve =       TX_UCHAR_POINTER_ADD(work_ptr, (class_ptr -> tx_slab_pool_class_block_size + (sizeof(UCHAR *))));
+                page_ptr -> tx_slab_pool_page_uncarved--;
+                next_block_ptr =                            TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            }
+
+            /* Save the page's address in the block for when it is released!  */
+            *next_block_ptr =  TX_SLAB_POOL_PAGE_TO_UCHAR_POINTER_CONVERT(page_ptr);
+
+            /* Return the block after the page pointer to the caller.  */
+            block_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+
+            /* Update the block counts.  */
+            page_ptr -> tx_slab_pool_page_used++;
+            class_ptr -> tx_slab_pool_class_available--;
+
+            /* Determine if all of the blocks of the page are now allocated.  */
+            if (page_ptr -> tx_slab_pool_page_used == class_ptr -> tx_slab_pool_class_page_blocks)
+            {
+
+                /* Yes, remove the page from the list of the class.  */
+                next_page =  page_ptr -> tx_slab_pool_page_next;
+                if (next_page == page_ptr)
+                {
+
+                    /* The only page on the list.  */
+                    class_ptr -> tx_slab_pool_class_page_list =  TX_NULL;
+                }
+                else
+                {
+
+                    /* Link-up the neighbors and move the list head to the next page.  */
+                    previous_page =                                 page_ptr -> tx_slab_pool_page_previous;
+                    next_page -> tx_slab_pool_page_previous =       previous_page;
+                    previous_page -> tx_slab_pool_page_next =       next_page;
+                    class_ptr -> tx_slab_pool_class_page_list =     next_page;
+                }
+            }
+
+            /* A block was found, end the search.  */
+            class_index =  last_class;
+        }
+        else
+        {
+
+            /* Move to the next larger size class.  */
+            class_index++;
+        }
+    }
+
+    /* Return the block pointer.  */
+    return(block_ptr);
+}
+
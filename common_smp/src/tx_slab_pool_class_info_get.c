@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_slab_pool_class_info_get                        PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information about a size class of the       */
+/*    specified slab pool.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to slab pool control block*/
+/*    class_index                       Index of the size class           */
+/*    block_size                        Destination for the block size of */
+/*                                        the class                       */
+/*    pages                             Destination for the number of     */
+/*                                        pages of the class              */
+/*    available_blocks                  Destination for the number of free*/
+/*                                        blocks of the class             */
+/*    allocated_blocks                  Destination for the number of     */
+/*                                        allocated blocks of the class   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_slab_pool_class_info_get(TX_SLAB_POOL *pool_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *pages, ULONG *available_blocks, ULONG *allocated_blocks)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_SLAB_POOL_CLASS  *class_ptr;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_SLAB_POOL_CLASS_INFO_GET, pool_ptr, class_index, 0, 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Pickup the size class.  */
+    class_ptr =  &(pool_ptr -> tx_slab_pool_class[class_index]);
+
+    /* Retrieve the block size of the class.  */
+    if (block_size != TX_NULL)
+    {
+
+        *block_size =  class_ptr -> tx_slab_pool_class_block_size;
+    }
+
+    /* Retrieve the number of pages given to the class.  */
+    if (pages != TX_NULL)
+    {
+
+        *pages =  (ULONG) class_ptr -> tx_slab_pool_class_pages;
+    }
+
+    /* Retrieve the number of free blocks in the pages of the class.  */
+    if (available_blocks != TX_NULL)
+    {
+
+        *available_blocks =  (ULONG) class_ptr -> tx_slab_pool_class_available;
+    }
+
+    /* Retrieve the number of allocated blocks of the class.  */
+    if (allocated_blocks != TX_NULL)
+    {
+
+        *allocated_blocks =  ((ULONG) class_ptr -> tx_slab_pool_class_pages) * ((ULONG) class_ptr -> tx_slab_pool_class_page_blocks);
+        *allocated_blocks =  *allocated_blocks - ((ULONG) class_ptr -> tx_slab_pool_class_available);
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
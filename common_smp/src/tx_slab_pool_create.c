@@ -0,0 +1,304 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_slab_pool_create                                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a slab memory pool in the area specified by   */
+/*    the caller. The start of the area holds a routing table that maps   */
+/*    each request size to the smallest fitting size class. The rest of   */
+/*    the area is divided into pages of the specified size, which are     */
+/*    given to the size classes as they are needed.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    name_ptr                          Pointer to slab pool name         */
+/*    class_sizes                       Pointer to the block sizes of the */
+/*                                        size classes, in ascending order*/
+/*    class_count                       Number of size classes            */
+/*    page_size                         Number of bytes in each page      */
+/*    pool_start                        Address of beginning of pool area */
+/*    pool_size                         Number of bytes in the slab pool  */
+/*    options                           Pool options,                     */
+/*                                        TX_SLAB_POOL_NO_BORROW or       */
+/*                                        TX_SLAB_POOL_BORROW_PAGES       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_SIZE_ERROR                     Invalid size class or not enough  */
+/*                                        memory for one page             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_slab_pool_create(TX_SLAB_POOL *pool_ptr, CHAR *name_ptr, ULONG *class_sizes, UINT class_count,
+                    ULONG page_size, VOID *pool_start, ULONG pool_size, UINT options)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+UINT                class_index;
+UINT                pages;
+ULONG               block_size;
+ULONG               route_limit;
+ULONG               route_entries;
+ULONG               route_size;
+ULONG               route_index;
+UCHAR               *page_memory;
+TX_SLAB_POOL_CLASS  *class_ptr;
+TX_SLAB_POOL_PAGE   *page_ptr;
+TX_SLAB_POOL_PAGE   *previous_page;
+TX_SLAB_POOL        *next_pool;
+TX_SLAB_POOL        *previous_pool;
+
+
+    /* Initialize slab pool control block to all zeros.  */
+    TX_MEMSET(pool_ptr, 0, (sizeof(TX_SLAB_POOL)));
+
+    /* Round the page size and the pool size down to something that is evenly
+       divisible by an ALIGN_TYPE (typically this is a 32-bit ULONG).  */
+    page_size =  (page_size/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+    pool_size =  (pool_size/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+    /* Setup the basic slab pool fields.  */
+    pool_ptr -> tx_slab_pool_name =             name_ptr;
+    pool_ptr -> tx_slab_pool_options =          options;
+    pool_ptr -> tx_slab_pool_start =            TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+    pool_ptr -> tx_slab_pool_size =             pool_size;
+    pool_ptr -> tx_slab_pool_page_size =        page_size;
+    pool_ptr -> tx_slab_pool_class_count =      class_count;
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Setup the size classes.  */
+    route_limit =  ((ULONG) 0);
+    for (class_index =  ((UINT) 0); class_index < class_count; class_index++)
+    {
+
+        /* Round the block size up to something that is evenly divisible by
+           an ALIGN_TYPE (typically this is a 32-bit ULONG). This helps guarantee proper alignment.  */
+        block_size =  (((class_sizes[class_index] + (sizeof(ALIGN_TYPE))) - ((ALIGN_TYPE) 1))/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+        /* Setup the size class.  */
+        class_ptr =                                     &(pool_ptr -> tx_slab_pool_class[class_index]);
+        class_ptr -> tx_slab_pool_class_pool =          pool_ptr;
+        class_ptr -> tx_slab_pool_class_block_size =    block_size;
+
+        /* Calculate the number of blocks in a page of this class, each block is
+           preceded by a pointer.  */
+        if (page_size > (TX_SLAB_POOL_PAGE_HEADER_SIZE))
+        {
+
+            class_ptr -> tx_slab_pool_class_page_blocks =  (UINT) ((page_size - (TX_SLAB_POOL_PAGE_HEADER_SIZE))/(block_size + (sizeof(UCHAR *))));
+        }
+
+        /* Determine if a page holds at least one block of this class.  */
+        if (class_ptr -> tx_slab_pool_class_page_blocks == ((UINT) 0))
+        {
+
+            /* No, the page size is too small.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* The largest class determines the largest request size.  */
+        if (block_size > route_limit)
+        {
+
+            route_limit =  block_size;
+        }
+    }
+
+    /* Determine if there is at least one size class.  */
+    if (route_limit == ((ULONG) 0))
+    {
+
+        /* No size classes, return appropriate error.  */
+        status =  TX_SIZE_ERROR;
+    }
+
+    /* Calculate the number of pages after the routing table, which has an entry
+       for each granule of request size.  */
+    pages =  ((UINT) 0);
+    route_entries =  ((ULONG) 0);
+    route_size =  ((ULONG) 0);
+    if (status == TX_SUCCESS)
+    {
+
+        /* Calculate the size of the routing table, rounded up for alignment.  */
+        route_entries =  ((route_limit - ((ULONG) 1))/(TX_SLAB_POOL_ROUTE_GRANULE)) + ((ULONG) 1);
+        route_size =     (((route_entries + (sizeof(ALIGN_TYPE))) - ((ALIGN_TYPE) 1))/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+        /* Calculate the number of pages that fit in the remaining area.  */
+        if (pool_size > route_size)
+        {
+
+            pages =  (UINT) ((pool_size - route_size)/page_size);
+        }
+    }
+
+    /* Quickly check to make sure at least one page is in the pool.  */
+    if (pages != ((UINT) 0))
+    {
+
+        /* Setup the routing table at the start of the pool area.  Each entry selects the
+           smallest size class that holds a request of up to (entry + 1) granules.  */
+        pool_ptr -> tx_slab_pool_route =        TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+        pool_ptr -> tx_slab_pool_route_limit =  route_limit;
+        class_index =  ((UINT) 0);
+        for (route_index =  ((ULONG) 0); route_index < route_entries; route_index++)
+        {
+
+            /* Move to the next size class until the class fits this entry.  */
+            while (pool_ptr -> tx_slab_pool_class[class_index].tx_slab_pool_class_block_size < ((route_index + ((ULONG) 1)) * (TX_SLAB_POOL_ROUTE_GRANULE)))
+            {
+
+                class_index++;
+            }
+
+            /* Save the size class for this entry.  */
+            pool_ptr -> tx_slab_pool_route[route_index] =  (UCHAR) class_index;
+        }
+
+        /* Walk through the rest of the pool area, setting up the free page list.  */
+        page_memory =    TX_UCHAR_POINTER_ADD(pool_start, route_size);
+        previous_page =  TX_NULL;
+        for (class_index =  ((UINT) 0); class_index < pages; class_index++)
+        {
+
+            /* Setup the page as a free page.  */
+            page_ptr =                                  TX_UCHAR_TO_SLAB_POOL_PAGE_POINTER_CONVERT(page_memory);
+            page_ptr -> tx_slab_pool_page_class =       TX_NULL;
+            page_ptr -> tx_slab_pool_page_next =        TX_NULL;
+
+            /* Link the page after the previous one.  */
+            if (previous_page == TX_NULL)
+            {
+
+                /* First page of the pool.  */
+                pool_ptr -> tx_slab_pool_page_list =  page_ptr;
+            }
+            else
+            {
+
+                /* Link the page to the previous page.  */
+                previous_page -> tx_slab_pool_page_next =  page_ptr;
+            }
+            previous_page =  page_ptr;
+
+            /* Advance to the next page.  */
+            page_memory =  TX_UCHAR_POINTER_ADD(page_memory, page_size);
+        }
+
+        /* Save the remaining information in the pool control block.  */
+        pool_ptr -> tx_slab_pool_pages_available =  pages;
+        pool_ptr -> tx_slab_pool_pages_total =      pages;
+
+        /* Disable interrupts to place the slab pool on the created list.  */
+        TX_DISABLE
+
+        /* Setup the slab pool ID to make it valid.  */
+        pool_ptr -> tx_slab_pool_id =  TX_SLAB_POOL_ID;
+
+        /* Place the slab pool on the list of created slab pools.  First,
+           check for an empty list.  */
+        if (_tx_slab_pool_created_count == TX_EMPTY)
+        {
+
+            /* The created slab pool list is empty.  Add slab pool to empty list.  */
+            _tx_slab_pool_created_ptr =                  pool_ptr;
+            pool_ptr -> tx_slab_pool_created_next =      pool_ptr;
+            pool_ptr -> tx_slab_pool_created_previous =  pool_ptr;
+        }
+        else
+        {
+
+            /* This list is not NULL, add to the end of the list.  */
+            next_pool =      _tx_slab_pool_created_ptr;
+            previous_pool =  next_pool -> tx_slab_pool_created_previous;
+
+            /* Place the new slab pool in the list.  */
+            next_pool -> tx_slab_pool_created_previous =  pool_ptr;
+            previous_pool -> tx_slab_pool_created_next =  pool_ptr;
+
+            /* Setup this slab pool's created links.  */
+            pool_ptr -> tx_slab_pool_created_previous =  previous_pool;
+            pool_ptr -> tx_slab_pool_created_next =      next_pool;
+        }
+
+        /* Increment the created count.  */
+        _tx_slab_pool_created_count++;
+
+        /* If trace is enabled, register this object.  */
+        TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_SLAB_POOL, pool_ptr, name_ptr, pages, page_size)
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_SLAB_POOL_CREATE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(pool_start), pages, page_size, TX_TRACE_BLOCK_POOL_EVENTS)
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* Not enough memory for one page, return appropriate error.  */
+        status =  TX_SIZE_ERROR;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_slab_pool_info_get                              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information from the specified slab pool.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to slab pool control block*/
+/*    name                              Destination for the pool name     */
+/*    available_pages                   Number of free pages in pool      */
+/*    total_pages                       Total number of pages in pool     */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on slab pool   */
+/*    suspended_count                   Destination for suspended count   */
+/*    next_pool                         Destination for pointer to next   */
+/*                                        slab pool on the created list   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_slab_pool_info_get(TX_SLAB_POOL *pool_ptr, CHAR **name, ULONG *available_pages,
+                    ULONG *total_pages, TX_THREAD **first_suspended,
+                    ULONG *suspended_count, TX_SLAB_POOL **next_pool)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_SLAB_POOL_INFO_GET, pool_ptr, 0, 0, 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the name of the slab pool.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  pool_ptr -> tx_slab_pool_name;
+    }
+
+    /* Retrieve the number of free pages in the slab pool.  */
+    if (available_pages != TX_NULL)
+    {
+
+        *available_pages =  (ULONG) pool_ptr -> tx_slab_pool_pages_available;
+    }
+
+    /* Retrieve the total number of pages in the slab pool.  */
+    if (total_pages != TX_NULL)
+    {
+
+        *total_pages =  (ULONG) pool_ptr -> tx_slab_pool_pages_total;
+    }
+
+    /* Retrieve the first thread suspended on this slab pool.  */
+    if (first_suspended != TX_NULL)
+    {
+
+        *first_suspended =  pool_ptr -> tx_slab_pool_suspension_list;
+    }
+
+    /* Retrieve the number of threads suspended on this slab pool.  */
+    if (suspended_count != TX_NULL)
+    {
+
+        *suspended_count =  (ULONG) pool_ptr -> tx_slab_pool_suspended_count;
+    }
+
+    /* Retrieve the pointer to the next slab pool created.  */
+    if (next_pool != TX_NULL)
+    {
+
+        *next_pool =  pool_ptr -> tx_slab_pool_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
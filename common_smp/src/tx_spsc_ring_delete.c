@@ -0,0 +1,198 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_spsc_ring_delete                                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified ring. A producer or consumer    */
+/*    suspended on the ring is resumed with the TX_DELETED status.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ring_ptr                          Pointer to ring control block     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_spsc_ring_delete(TX_SPSC_RING *ring_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *suspended_threads[2];
+UINT            i;
+TX_SPSC_RING    *next_ring;
+TX_SPSC_RING    *previous_ring;
+
+
+    /* Disable interrupts to remove the ring from the created list.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_SPSC_RING_DELETE, ring_ptr, TX_POINTER_TO_ULONG_CONVERT(&thread_ptr), 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* If trace is enabled, unregister this object.  */
+    TX_TRACE_OBJECT_UNREGISTER(ring_ptr)
+
+    /* Clear the ring ID to make it invalid.  */
+    ring_ptr -> tx_spsc_ring_id =  TX_CLEAR_ID;
+
+    /* Decrement the number of created rings.  */
+    _tx_spsc_ring_created_count--;
+
+    /* See if the ring is the only one on the list.  */
+    if (_tx_spsc_ring_created_count == TX_EMPTY)
+    {
+
+        /* Only created ring, just set the created list to NULL.  */
+        _tx_spsc_ring_created_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        next_ring =                                   ring_ptr -> tx_spsc_ring_created_next;
+        previous_ring =                               ring_ptr -> tx_spsc_ring_created_previous;
+        next_ring -> tx_spsc_ring_created_previous =  previous_ring;
+        previous_ring -> tx_spsc_ring_created_next =  next_ring;
+
+        /* See if we have to update the created list head pointer.  */
+        if (_tx_spsc_ring_created_ptr == ring_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            _tx_spsc_ring_created_ptr =  next_ring;
+        }
+    }
+
+    /* Temporarily disable preemption.  */
+    _tx_thread_preempt_disable++;
+
+    /* Pickup the suspended producer and consumer, if any.  */
+    suspended_threads[0] =                      ring_ptr -> tx_spsc_ring_producer_thread;
+    suspended_threads[1] =                      ring_ptr -> tx_spsc_ring_consumer_thread;
+    ring_ptr -> tx_spsc_ring_producer_thread =  TX_NULL;
+    ring_ptr -> tx_spsc_ring_consumer_thread =  TX_NULL;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Resume the suspended producer and consumer.  */
+    for (i = ((UINT) 0); i < ((UINT) 2); i++)
+    {
+
+        /* Pickup the thread.  */
+        thread_ptr =  suspended_threads[i];
+
+        /* Determine if a thread is suspended.  */
+        if (thread_ptr != TX_NULL)
+        {
+
+            /* Lockout interrupts.  */
+            TX_DISABLE
+
+            /* Clear the cleanup pointer, this prevents the timeout from doing
+               anything.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Set the return status in the thread to TX_DELETED.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_DELETED;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+        }
+    }
+
+    /* Execute Port-Specific completion processing. If needed, it is typically defined in tx_port.h.  */
+    TX_SPSC_RING_DELETE_PORT_COMPLETION(ring_ptr)
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Release previous preempt disable.  */
+    _tx_thread_preempt_disable--;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Check for preemption.  */
+    _tx_thread_system_preempt_check();
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
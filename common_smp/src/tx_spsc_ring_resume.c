@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_spsc_ring_resume                                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resumes the producer or the consumer suspended on     */
+/*    the ring, if the ring is no longer full or empty. The check is      */
+/*    needed because a waiting flag may have been seen after the          */
+/*    suspending side found that it did not need to suspend after all.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ring_ptr                          Pointer to ring control block     */
+/*    producer                          TX_TRUE to resume the producer    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_spsc_ring_load                Default ring index load           */
+/*    _tx_spsc_ring_store               Default ring index store          */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_spsc_ring_receive             Receive message from ring         */
+/*    _tx_spsc_ring_send                Send message to ring              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_spsc_ring_resume(TX_SPSC_RING *ring_ptr, UINT producer)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+
+
+    /* Disable interrupts to remove the suspended thread from the ring.  */
+    TX_DISABLE
+
+    /* Determine which side to resume.  */
+    if (producer == TX_TRUE)
+    {
+
+        /* Pickup the suspended producer.  */
+        thread_ptr =  ring_ptr -> tx_spsc_ring_producer_thread;
+
+        /* Determine if the producer is suspended on a ring that is no longer full.  */
+        if (thread_ptr != TX_NULL)
+        {
+
+            /* Check the room in the ring.  */
+            if ((ring_ptr -> tx_spsc_ring_head - TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_tail))) < ring_ptr -> tx_spsc_ring_capacity)
+            {
+
+                /* Remove the producer from the ring.  */
+                ring_ptr -> tx_spsc_ring_producer_thread =  TX_NULL;
+                TX_SPSC_RING_STORE(&(ring_ptr -> tx_spsc_ring_producer_waiting), ((ULONG) 0));
+            }
+            else
+            {
+
+                /* Still full, leave the producer suspended.  */
+                thread_ptr =  TX_NULL;
+            }
+        }
+    }
+    else
+    {
+
+        /* Pickup the suspended consumer.  */
+        thread_ptr =  ring_ptr -> tx_spsc_ring_consumer_thread;
+
+        /* Determine if the consumer is suspended on a ring that is no longer empty.  */
+        if (thread_ptr != TX_NULL)
+        {
+
+            /* Check for a message in the ring.  */
+            if (TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_head)) != ring_ptr -> tx_spsc_ring_tail)
+            {
+
+                /* Remove the consumer from the ring.  */
+                ring_ptr -> tx_spsc_ring_consumer_thread =  TX_NULL;
+                TX_SPSC_RING_STORE(&(ring_ptr -> tx_spsc_ring_consumer_waiting), ((ULONG) 0));
+            }
+            else
+            {
+
+                /* Still empty, leave the consumer suspended.  */
+                thread_ptr =  TX_NULL;
+            }
+        }
+    }
+
+    /* Determine if there is a thread to resume.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Clear the cleanup pointer, this prevents the timeout from doing
+           anything.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Put return status into the thread control block.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+}
+
@@ -0,0 +1,226 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Single-Producer Single-Consumer Ring                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_spsc_ring.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_spsc_ring_suspend                               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function suspends the producer of a full ring or the consumer  */
+/*    of an empty ring. The waiting flag is set before the other index    */
+/*    is read again, and the other side reads the flag after it changes   */
+/*    its index, so either the other side's progress is seen here or the  */
+/*    other side resumes this thread.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ring_ptr                          Pointer to ring control block     */
+/*    producer                          TX_TRUE for the producer          */
+/*    index                             Own index of the caller           */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Ring is no longer full or empty   */
+/*    TX_QUEUE_FULL                     Ring is still full                */
+/*    TX_QUEUE_EMPTY                    Ring is still empty               */
+/*    TX_DELETED                        Ring was deleted                  */
+/*    TX_WAIT_ABORTED                   Suspension was aborted            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_spsc_ring_load                Default ring index load           */
+/*    _tx_spsc_ring_store               Default ring index store          */
+/*    _tx_thread_system_suspend         Suspend thread service            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_spsc_ring_receive             Receive message from ring         */
+/*    _tx_spsc_ring_send                Send message to ring              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_spsc_ring_suspend(TX_SPSC_RING *ring_ptr, UINT producer, ULONG index, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+ULONG           *waiting_ptr;
+UINT            status;
+
+
+    /* Disable interrupts to prepare for suspension.  */
+    TX_DISABLE
+
+    /* Tell the other side about the suspension, then determine if it has made
+       progress since the ring was found full or empty.  */
+    if (producer == TX_TRUE)
+    {
+
+        /* Set the producer waiting flag.  */
+        waiting_ptr =  &(ring_ptr -> tx_spsc_ring_producer_waiting);
+        TX_SPSC_RING_STORE(waiting_ptr, ((ULONG) 1));
+
+        /* Determine if the ring is still full.  */
+        if ((index - TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_tail))) >= ring_ptr -> tx_spsc_ring_capacity)
+        {
+
+            /* Yes, the ring is still full.  */
+            status =  TX_QUEUE_FULL;
+        }
+        else
+        {
+
+            /* The consumer made room.  */
+            status =  TX_SUCCESS;
+        }
+    }
+    else
+    {
+
+        /* Set the consumer waiting flag.  */
+        waiting_ptr =  &(ring_ptr -> tx_spsc_ring_consumer_waiting);
+        TX_SPSC_RING_STORE(waiting_ptr, ((ULONG) 1));
+
+        /* Determine if the ring is still empty.  */
+        if (TX_SPSC_RING_LOAD(&(ring_ptr -> tx_spsc_ring_head)) == index)
+        {
+
+            /* Yes, the ring is still empty.  */
+            status =  TX_QUEUE_EMPTY;
+        }
+        else
+        {
+
+            /* The producer sent a message.  */
+            status =  TX_SUCCESS;
+        }
+    }
+
+    /* Determine if the thread must suspend and is allowed to.  Suspension is not
+       allowed if the preempt disable flag is non-zero at this point.  */
+    if ((status != TX_SUCCESS) && (_tx_thread_preempt_disable == ((UINT) 0)))
+    {
+
+        /* Prepare for suspension of this thread.  */
+
+        /* Pickup thread pointer.  */
+        TX_THREAD_GET_CURRENT(thread_ptr)
+
+        /* Setup cleanup routine pointer.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_spsc_ring_cleanup);
+
+        /* Setup cleanup information, i.e. this ring control block and the
+           side of the ring the thread is on.  */
+        thread_ptr -> tx_thread_suspend_control_block =  (VOID *) ring_ptr;
+        thread_ptr -> tx_thread_suspend_info =           (ULONG) producer;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+        /* Increment the suspension sequence number, which is used to identify
+           this suspension event.  */
+        thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+        /* Remember the suspended thread in the ring.  */
+        if (producer == TX_TRUE)
+        {
+
+            /* Setup the suspended producer.  */
+            ring_ptr -> tx_spsc_ring_producer_thread =  thread_ptr;
+        }
+        else
+        {
+
+            /* Setup the suspended consumer.  */
+            ring_ptr -> tx_spsc_ring_consumer_thread =  thread_ptr;
+        }
+
+        /* Set the state to suspended.  */
+        thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Call actual non-interruptable thread suspension routine.  */
+        _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Set the suspending flag.  */
+        thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+        /* Setup the timeout period.  */
+        thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Call actual thread suspension routine.  */
+        _tx_thread_system_suspend(thread_ptr);
+#endif
+
+        /* Return the completion status.  */
+        status =  thread_ptr -> tx_thread_suspend_status;
+    }
+    else
+    {
+
+        /* No suspension, clear the waiting flag.  */
+        TX_SPSC_RING_STORE(waiting_ptr, ((ULONG) 0));
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_notify                                   PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function updates the notification value of the specified       */
+/*    thread and marks the notification pending. If the thread is         */
+/*    waiting for a notification, it is resumed directly, without an      */
+/*    intermediate semaphore or event flags group and without a           */
+/*    suspension list.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread to notify       */
+/*    value                             Value for the notification        */
+/*    action                            Update of the notification value, */
+/*                                        either                          */
+/*                                        TX_THREAD_NOTIFY_SET_BITS,      */
+/*                                        TX_THREAD_NOTIFY_INCREMENT, or  */
+/*                                        TX_THREAD_NOTIFY_OVERWRITE      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_FEATURE_NOT_ENABLED            Thread notifications are not      */
+/*                                        enabled                         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_notify(TX_THREAD *thread_ptr, ULONG value, UINT action)
+{
+
+#ifdef TX_THREAD_ENABLE_NOTIFICATION
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+
+
+    /* Disable interrupts to notify the thread.  */
+    TX_DISABLE
+
+    /* Update the notification value as requested.  */
+    if (action == TX_THREAD_NOTIFY_SET_BITS)
+    {
+
+        /* Set the bits of the value in the notification value.  */
+        thread_ptr -> tx_thread_notify_value =  thread_ptr -> tx_thread_notify_value | value;
+    }
+    else if (action == TX_THREAD_NOTIFY_INCREMENT)
+    {
+
+        /* Count the notification.  */
+        thread_ptr -> tx_thread_notify_value++;
+    }
+    else
+    {
+
+        /* Replace the notification value.  */
+        thread_ptr -> tx_thread_notify_value =  value;
+    }
+
+    /* Mark the notification pending.  */
+    thread_ptr -> tx_thread_notify_pending =  TX_TRUE;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_THREAD_NOTIFY, thread_ptr, value, action, thread_ptr -> tx_thread_notify_value, TX_TRACE_THREAD_EVENTS)
+
+    /* Determine if the thread is waiting for a notification.  */
+    if (thread_ptr -> tx_thread_suspend_cleanup == &(_tx_thread_notify_cleanup))
+    {
+
+        /* Clear cleanup routine to avoid timeout.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Put return status into the thread control block.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return success.  */
+    status =  TX_SUCCESS;
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (value != ((ULONG) 0))
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (action != TX_THREAD_NOTIFY_SET_BITS)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,256 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_notify_wait                              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits for a notification of the calling thread, and   */
+/*    returns the notification value. On return, the notification value   */
+/*    is kept, cleared, or decremented according to the exit option. A    */
+/*    decremented value that is not zero leaves the notification          */
+/*    pending, so the notification value can be used as a counting        */
+/*    semaphore.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    exit_option                       Update of the notification value  */
+/*                                        on return, either               */
+/*                                        TX_THREAD_NOTIFY_KEEP,          */
+/*                                        TX_THREAD_NOTIFY_CLEAR, or      */
+/*                                        TX_THREAD_NOTIFY_DECREMENT      */
+/*    value_ptr                         Destination for the notification  */
+/*                                        value                           */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_NO_EVENTS                      No notification is pending        */
+/*    TX_WAIT_ABORTED                   Suspension was aborted            */
+/*    TX_FEATURE_NOT_ENABLED            Thread notifications are not      */
+/*                                        enabled                         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_suspend         Suspend thread service            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_notify_wait(UINT exit_option, ULONG *value_ptr, ULONG wait_option)
+{
+
+#ifdef TX_THREAD_ENABLE_NOTIFICATION
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts to check for a notification.  */
+    TX_DISABLE
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_THREAD_NOTIFY_WAIT, thread_ptr, exit_option, wait_option, thread_ptr -> tx_thread_notify_value, TX_TRACE_THREAD_EVENTS)
+
+    /* Determine if a notification is pending.  */
+    if (thread_ptr -> tx_thread_notify_pending == TX_FALSE)
+    {
+
+        /* Determine if the request specifies suspension, which is not allowed
+           if the preempt disable flag is non-zero at this point.  */
+        if ((wait_option != TX_NO_WAIT) && (_tx_thread_preempt_disable == ((UINT) 0)))
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_thread_notify_cleanup);
+
+            /* Setup cleanup information, i.e. the thread itself.  */
+            thread_ptr -> tx_thread_suspend_control_block =  (VOID *) thread_ptr;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_NOTIFY_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Pickup the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+
+            /* Disable interrupts to receive the notification.  */
+            TX_DISABLE
+        }
+        else
+        {
+
+            /* No notification is pending.  */
+            status =  TX_NO_EVENTS;
+        }
+    }
+
+    /* Determine if the notification is received.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Return the notification value.  */
+        *value_ptr =  thread_ptr -> tx_thread_notify_value;
+
+        /* Update the notification value as requested.  */
+        if (exit_option == TX_THREAD_NOTIFY_DECREMENT)
+        {
+
+            /* Consume one count of the notification value.  */
+            if (thread_ptr -> tx_thread_notify_value != ((ULONG) 0))
+            {
+
+                /* Decrement the notification value.  */
+                thread_ptr -> tx_thread_notify_value--;
+            }
+
+            /* Determine if counts remain.  */
+            if (thread_ptr -> tx_thread_notify_value == ((ULONG) 0))
+            {
+
+                /* No, the notification is received.  */
+                thread_ptr -> tx_thread_notify_pending =  TX_FALSE;
+            }
+        }
+        else
+        {
+
+            /* Determine if the notification value is cleared.  */
+            if (exit_option == TX_THREAD_NOTIFY_CLEAR)
+            {
+
+                /* Clear the notification value.  */
+                thread_ptr -> tx_thread_notify_value =  ((ULONG) 0);
+            }
+
+            /* The notification is received.  */
+            thread_ptr -> tx_thread_notify_pending =  TX_FALSE;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (exit_option != TX_THREAD_NOTIFY_KEEP)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (value_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
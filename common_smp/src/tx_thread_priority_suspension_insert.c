@@ -0,0 +1,197 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+#define TX_THREAD_SMP_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_priority_suspension_insert               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a thread in a priority-ordered suspension      */
+/*    list, behind all suspended threads of the same or higher priority.  */
+/*    The nearest lower priority with suspended threads is found in the   */
+/*    priority bit map, and the thread is placed in front of the first    */
+/*    suspended thread of that priority, so the insertion takes constant  */
+/*    time. The head of the list is always the highest priority thread    */
+/*    that has been suspended the longest.                                */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    suspension_list                   Pointer to suspension list head   */
+/*    priority_suspension               Pointer to priority order of the  */
+/*                                        suspension list                 */
+/*    thread_ptr                        Pointer to thread to suspend      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_mutex_get                     Get mutex                         */
+/*    _tx_semaphore_get                 Get semaphore                     */
+/*    _tx_semaphore_get_count           Get semaphore instances           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+VOID  _tx_thread_priority_suspension_insert(TX_THREAD **suspension_list, TX_PRIORITY_SUSPENSION *priority_suspension, TX_THREAD *thread_ptr)
+{
+
+UINT            priority;
+UINT            base_priority;
+ULONG           priority_map;
+ULONG           priority_bit;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+#if TX_MAX_PRIORITIES > 32
+UINT            map_index;
+#endif
+
+
+    /* Pickup the priority of the thread and remember it for the removal.  */
+    priority =  thread_ptr -> tx_thread_priority;
+    thread_ptr -> tx_thread_suspension_priority =  priority;
+
+    /* Determine if the suspension list is empty.  */
+    if (*suspension_list == TX_NULL)
+    {
+
+        /* No other threads are suspended.  Setup the head pointer and
+           just setup this threads pointers to itself.  */
+        *suspension_list =                              thread_ptr;
+        thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+        thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+    }
+    else
+    {
+
+#if TX_MAX_PRIORITIES > 32
+
+        /* Calculate the index into the bit map array.  */
+        map_index =  priority/((UINT) 32);
+#endif
+
+        /* Isolate the lower priorities with suspended threads in the priority
+           group of the thread.  */
+        TX_MOD32_BIT_SET(priority, priority_bit)
+        priority_map =  priority_suspension -> tx_priority_suspension_maps[MAP_INDEX] & (~(priority_bit | (priority_bit - ((ULONG) 1))));
+
+#if TX_MAX_PRIORITIES > 32
+
+        /* Move to the next priority groups until one has suspended threads.  */
+        while ((priority_map == ((ULONG) 0)) && (map_index < ((UINT) ((TX_MAX_PRIORITIES/32) - 1))))
+        {
+
+            /* Move to the next priority group.  */
+            map_index++;
+            priority_map =  priority_suspension -> tx_priority_suspension_maps[map_index];
+        }
+
+        /* Calculate the base priority of the priority group.  */
+        base_priority =  map_index * ((UINT) 32);
+#else
+
+        /* Setup the base priority to zero.  */
+        base_priority =  ((UINT) 0);
+#endif
+
+        /* Determine if a lower priority has suspended threads.  */
+        if (priority_map == ((ULONG) 0))
+        {
+
+            /* No, place the thread at the end of the list.  */
+            next_thread =  *suspension_list;
+        }
+        else
+        {
+
+            /* Find the nearest lower priority with suspended threads.  */
+            TX_LOWEST_SET_BIT_CALCULATE(priority_map, priority_bit)
+
+            /* Place the thread in front of the first suspended thread of that priority.  */
+            next_thread =  priority_suspension -> tx_priority_suspension_first[base_priority + ((UINT) priority_bit)];
+
+            /* Determine if the thread is placed in front of the head of the list.  */
+            if (next_thread == *suspension_list)
+            {
+
+                /* Yes, the thread is the new head of the list.  */
+                *suspension_list =  thread_ptr;
+            }
+        }
+
+        /* Link the thread in front of the next thread.  */
+        previous_thread =                               next_thread -> tx_thread_suspended_previous;
+        thread_ptr -> tx_thread_suspended_next =        next_thread;
+        thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+        previous_thread -> tx_thread_suspended_next =   thread_ptr;
+        next_thread -> tx_thread_suspended_previous =   thread_ptr;
+    }
+
+    /* Determine if the thread is the only suspended thread of its priority.  */
+    if (priority_suspension -> tx_priority_suspension_first[priority] == TX_NULL)
+    {
+
+        /* Yes, remember it as the first suspended thread of its priority.  */
+        priority_suspension -> tx_priority_suspension_first[priority] =  thread_ptr;
+
+#if TX_MAX_PRIORITIES > 32
+
+        /* Calculate the index into the bit map array.  */
+        map_index =  priority/((UINT) 32);
+#endif
+
+        /* Set the bit of the priority in the bit map.  */
+        TX_MOD32_BIT_SET(priority, priority_bit)
+        priority_suspension -> tx_priority_suspension_maps[MAP_INDEX] =  priority_suspension -> tx_priority_suspension_maps[MAP_INDEX] | priority_bit;
+    }
+}
+#endif
+
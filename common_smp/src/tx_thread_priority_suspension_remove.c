@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_priority_suspension_remove               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function updates the priority order of a suspension list for   */
+/*    a thread that is about to be removed from the list. The caller      */
+/*    still unlinks the thread from the list afterwards, so the list      */
+/*    head must be the head before the removal.                           */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    suspension_list                   Suspension list head              */
+/*    priority_suspension               Pointer to priority order of the  */
+/*                                        suspension list                 */
+/*    thread_ptr                        Pointer to thread to remove       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_mutex_cleanup                 Mutex cleanup                     */
+/*    _tx_mutex_put                     Put mutex                         */
+/*    _tx_semaphore_cleanup             Semaphore cleanup                 */
+/*    _tx_semaphore_ceiling_put         Put semaphore with ceiling        */
+/*    _tx_semaphore_instances_put       Put semaphore instances and       */
+/*                                        resume threads                  */
+/*    _tx_semaphore_put                 Put semaphore                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_ENABLE_PRIORITY_SUSPENSION
+VOID  _tx_thread_priority_suspension_remove(TX_THREAD *suspension_list, TX_PRIORITY_SUSPENSION *priority_suspension, TX_THREAD *thread_ptr)
+{
+
+UINT            priority;
+ULONG           priority_bit;
+TX_THREAD       *next_thread;
+#if TX_MAX_PRIORITIES > 32
+UINT            map_index;
+#endif
+
+
+    /* Pickup the priority the thread was placed in the list with.  */
+    priority =  thread_ptr -> tx_thread_suspension_priority;
+
+    /* Determine if the thread is the first suspended thread of its priority.  */
+    if (priority_suspension -> tx_priority_suspension_first[priority] == thread_ptr)
+    {
+
+        /* Pickup the next thread in the list.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+        /* Determine if the next thread has the same priority.  The list wraps
+           around to the head after the last thread.  */
+        if ((next_thread != suspension_list) && (next_thread -> tx_thread_suspension_priority == priority))
+        {
+
+            /* Yes, the next thread is now the first of this priority.  */
+            priority_suspension -> tx_priority_suspension_first[priority] =  next_thread;
+        }
+        else
+        {
+
+            /* No other threads of this priority are suspended.  */
+            priority_suspension -> tx_priority_suspension_first[priority] =  TX_NULL;
+
+#if TX_MAX_PRIORITIES > 32
+
+            /* Calculate the index into the bit map array.  */
+            map_index =  priority/((UINT) 32);
+#endif
+
+            /* Clear the bit of the priority in the bit map.  */
+            TX_MOD32_BIT_SET(priority, priority_bit)
+            priority_suspension -> tx_priority_suspension_maps[MAP_INDEX] =  priority_suspension -> tx_priority_suspension_maps[MAP_INDEX] & (~(priority_bit));
+        }
+    }
+}
+#endif
+
@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread - High Level SMP Support                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+#define TX_THREAD_SMP_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_smp_pointer_compare_swap                 PORTABLE SMP    */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function replaces the pointer at the destination with the new  */
+/*    value if it holds the expected value, as one atomic operation. It   */
+/*    is used for TX_SMP_POINTER_COMPARE_AND_SWAP by ports that do not    */
+/*    provide an atomic instruction, in which case the swap is performed  */
+/*    under the SMP protection.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    destination                       Pointer to the pointer to swap    */
+/*    expected                          Expected value of the pointer     */
+/*    new_value                         New value of the pointer          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Pointer was replaced              */
+/*    TX_FALSE                          Pointer did not hold the expected */
+/*                                        value                           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_arena_allocate      Allocate from byte pool arena     */
+/*    _tx_byte_pool_arena_release       Release to byte pool arena        */
+/*    _tx_byte_pool_arena_steal         Steal block from byte pool arena  */
+/*    _tx_byte_pool_arena_flush         Return arena blocks to pool       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_smp_pointer_compare_swap(UCHAR **destination, UCHAR *expected, UCHAR *new_value)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT    status;
+
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the pointer holds the expected value.  */
+    if ((*destination) == expected)
+    {
+
+        /* Yes, replace the pointer.  */
+        *destination =  new_value;
+
+        /* The swap was performed.  */
+        status =  TX_TRUE;
+    }
+    else
+    {
+
+        /* No, the pointer was changed by another core.  */
+        status =  TX_FALSE;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the swap status.  */
+    return(status);
+}
+
@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_create                                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a wait set. Queues, semaphores, and event     */
+/*    flags groups can then be added to the wait set, and threads can     */
+/*    wait until any of them is ready.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set control block */
+/*    name_ptr                          Pointer to wait set name          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_FEATURE_NOT_ENABLED            Wait sets are not enabled         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_wait_set_create(TX_WAIT_SET *wait_set_ptr, CHAR *name_ptr)
+{
+
+#ifdef TX_ENABLE_WAIT_SET
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_WAIT_SET         *next_wait_set;
+TX_WAIT_SET         *previous_wait_set;
+
+
+    /* Initialize wait set control block to all zeros.  */
+    TX_MEMSET(wait_set_ptr, 0, (sizeof(TX_WAIT_SET)));
+
+    /* Setup the basic wait set fields.  */
+    wait_set_ptr -> tx_wait_set_name =  name_ptr;
+
+    /* Disable interrupts to put the wait set on the created list.  */
+    TX_DISABLE
+
+    /* Setup the wait set ID to make it valid.  */
+    wait_set_ptr -> tx_wait_set_id =  TX_WAIT_SET_ID;
+
+    /* Place the wait set on the list of created wait sets.  First,
+       check for an empty list.  */
+    if (_tx_wait_set_created_count == TX_EMPTY)
+    {
+
+        /* The created wait set list is empty.  Add wait set to empty list.  */
+        _tx_wait_set_created_ptr =                     wait_set_ptr;
+        wait_set_ptr -> tx_wait_set_created_next =      wait_set_ptr;
+        wait_set_ptr -> tx_wait_set_created_previous =  wait_set_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_wait_set =      _tx_wait_set_created_ptr;
+        previous_wait_set =  next_wait_set -> tx_wait_set_created_previous;
+
+        /* Place the new wait set in the list.  */
+        next_wait_set -> tx_wait_set_created_previous =  wait_set_ptr;
+        previous_wait_set -> tx_wait_set_created_next =  wait_set_ptr;
+
+        /* Setup this wait set's created links.  */
+        wait_set_ptr -> tx_wait_set_created_previous =  previous_wait_set;
+        wait_set_ptr -> tx_wait_set_created_next =      next_wait_set;
+    }
+
+    /* Increment the created wait set count.  */
+    _tx_wait_set_created_count++;
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_WAIT_SET, wait_set_ptr, name_ptr, 0, 0)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_WAIT_SET_CREATE, wait_set_ptr, TX_POINTER_TO_ULONG_CONVERT(&next_wait_set), 0, 0, TX_TRACE_EVENT_FLAGS_EVENTS)
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (wait_set_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (name_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_member_add                             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a queue, semaphore, or event flags group to a    */
+/*    wait set. Members are checked by tx_wait_set_wait starting with     */
+/*    the member added last. If the object is already ready and threads   */
+/*    are waiting on the wait set, one of them is resumed.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set               */
+/*    member_ptr                        Pointer to wait set member of the */
+/*                                        object                          */
+/*    object_ptr                        Pointer to object                 */
+/*    object_type                       ID of the object type             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_NOT_AVAILABLE                  Object is already a member of a   */
+/*                                        wait set                        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_wait_set_signal               Signal wait set member            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_wait_set_event_flags_add      Add event flags group to wait set */
+/*    _tx_wait_set_queue_add            Add queue to wait set             */
+/*    _tx_wait_set_semaphore_add        Add semaphore to wait set         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_ENABLE_WAIT_SET
+UINT  _tx_wait_set_member_add(TX_WAIT_SET *wait_set_ptr, TX_WAIT_SET_MEMBER *member_ptr, VOID *object_ptr, ULONG object_type)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                suspended_count;
+UINT                status;
+
+
+    /* Disable interrupts to add the object to the wait set.  */
+    TX_DISABLE
+
+    /* Determine if the object is already a member of a wait set.  */
+    if (member_ptr -> tx_wait_set_member_set != TX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* An object can only be a member of one wait set.  */
+        status =  TX_NOT_AVAILABLE;
+    }
+    else
+    {
+
+        /* Setup the member.  */
+        member_ptr -> tx_wait_set_member_set =     wait_set_ptr;
+        member_ptr -> tx_wait_set_member_object =  object_ptr;
+        member_ptr -> tx_wait_set_member_type =    object_type;
+
+        /* Place the member at the head of the member list.  */
+        member_ptr -> tx_wait_set_member_next =    wait_set_ptr -> tx_wait_set_member_list;
+        wait_set_ptr -> tx_wait_set_member_list =  member_ptr;
+
+        /* Increment the number of members.  */
+        wait_set_ptr -> tx_wait_set_member_count++;
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_WAIT_SET_ADD, wait_set_ptr, TX_POINTER_TO_ULONG_CONVERT(object_ptr), object_type, wait_set_ptr -> tx_wait_set_member_count, TX_TRACE_EVENT_FLAGS_EVENTS)
+
+        /* Pickup the number of threads waiting on the wait set.  */
+        suspended_count =  wait_set_ptr -> tx_wait_set_suspended_count;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if threads are waiting on the wait set.  */
+        if (suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            /* Yes, resume one of them if the object is already ready.  */
+            _tx_wait_set_signal(member_ptr);
+        }
+
+        /* Return successful status.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
+
@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+#include "tx_semaphore.h"
+#include "tx_event_flags.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_member_ready                           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function determines if the object of a wait set member is      */
+/*    ready, that is a queue has a message, a semaphore has an instance,  */
+/*    or an event flags group has one or more event flags set. It is      */
+/*    called with interrupts disabled.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    member_ptr                        Pointer to wait set member        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Object is ready                   */
+/*    TX_FALSE                          Object is not ready               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_wait_set_signal               Signal wait set member            */
+/*    _tx_wait_set_wait                 Wait on wait set                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_ENABLE_WAIT_SET
+UINT  _tx_wait_set_member_ready(TX_WAIT_SET_MEMBER *member_ptr)
+{
+
+TX_QUEUE                *queue_ptr;
+TX_SEMAPHORE            *semaphore_ptr;
+TX_EVENT_FLAGS_GROUP    *group_ptr;
+UINT                    status;
+
+
+    /* Default the object to not ready.  */
+    status =  TX_FALSE;
+
+    /* Determine the type of the object.  */
+    if (member_ptr -> tx_wait_set_member_type == TX_QUEUE_ID)
+    {
+
+        /* A queue is ready when it has a message.  */
+        queue_ptr =  TX_VOID_TO_QUEUE_POINTER_CONVERT(member_ptr -> tx_wait_set_member_object);
+        if (queue_ptr -> tx_queue_enqueued != TX_NO_MESSAGES)
+        {
+
+            /* The queue is ready.  */
+            status =  TX_TRUE;
+        }
+    }
+    else if (member_ptr -> tx_wait_set_member_type == TX_SEMAPHORE_ID)
+    {
+
+        /* A semaphore is ready when it has an instance.  */
+        semaphore_ptr =  TX_VOID_TO_SEMAPHORE_POINTER_CONVERT(member_ptr -> tx_wait_set_member_object);
+        if (semaphore_ptr -> tx_semaphore_count != ((ULONG) 0))
+        {
+
+            /* The semaphore is ready.  */
+            status =  TX_TRUE;
+        }
+    }
+    else
+    {
+
+        /* An event flags group is ready when one of its event flags is set. Flags that are
+           pending a delayed clear are not set.  */
+        group_ptr =  TX_VOID_TO_EVENT_FLAGS_POINTER_CONVERT(member_ptr -> tx_wait_set_member_object);
+        if ((group_ptr -> tx_event_flags_group_current & (~group_ptr -> tx_event_flags_group_delayed_clear)) != ((ULONG) 0))
+        {
+
+            /* The event flags group is ready.  */
+            status =  TX_TRUE;
+        }
+    }
+
+    /* Return the readiness of the object.  */
+    return(status);
+}
+#endif
+
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_member_remove                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a queue, semaphore, or event flags group      */
+/*    from the wait set it is a member of. It is called with interrupts   */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    member_ptr                        Pointer to wait set member        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_event_flags_delete            Delete event flags group          */
+/*    _tx_queue_delete                  Delete queue                      */
+/*    _tx_semaphore_delete              Delete semaphore                  */
+/*    _tx_wait_set_remove               Remove object from wait set       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_ENABLE_WAIT_SET
+VOID  _tx_wait_set_member_remove(TX_WAIT_SET_MEMBER *member_ptr)
+{
+
+TX_WAIT_SET             *wait_set_ptr;
+TX_WAIT_SET_MEMBER      *previous_member;
+
+
+    /* Pickup the wait set of the member.  */
+    wait_set_ptr =  member_ptr -> tx_wait_set_member_set;
+
+    /* Determine if the member is at the head of the member list.  */
+    if (wait_set_ptr -> tx_wait_set_member_list == member_ptr)
+    {
+
+        /* Yes, move the head of the list to the next member.  */
+        wait_set_ptr -> tx_wait_set_member_list =  member_ptr -> tx_wait_set_member_next;
+    }
+    else
+    {
+
+        /* Find the member in front of this member.  */
+        previous_member =  wait_set_ptr -> tx_wait_set_member_list;
+        while (previous_member -> tx_wait_set_member_next != member_ptr)
+        {
+
+            /* Move to the next member.  */
+            previous_member =  previous_member -> tx_wait_set_member_next;
+        }
+
+        /* Link the previous member to the next member.  */
+        previous_member -> tx_wait_set_member_next =  member_ptr -> tx_wait_set_member_next;
+    }
+
+    /* Decrement the number of members.  */
+    wait_set_ptr -> tx_wait_set_member_count--;
+
+    /* The object is no longer a member of a wait set.  */
+    member_ptr -> tx_wait_set_member_set =   TX_NULL;
+    member_ptr -> tx_wait_set_member_next =  TX_NULL;
+}
+#endif
+
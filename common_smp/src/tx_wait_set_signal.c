@@ -0,0 +1,199 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_signal                                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called after a message is sent to a queue, a       */
+/*    semaphore is put, or event flags are set, when the object is a      */
+/*    member of a wait set. If the object is still ready and threads are  */
+/*    waiting on the wait set, the first waiting thread is resumed with   */
+/*    the object as its ready object. The object itself is not changed,   */
+/*    the resumed thread receives from it.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    member_ptr                        Pointer to wait set member        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_wait_set_member_ready         Check readiness of member         */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_event_flags_set               Set event flags                   */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_priority_send           Send message with priority        */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_commit             Commit reserved message           */
+/*    _tx_queue_send_multiple           Send messages to queue            */
+/*    _tx_semaphore_ceiling_put         Put semaphore with ceiling        */
+/*    _tx_semaphore_put                 Put semaphore                     */
+/*    _tx_wait_set_member_add           Add object to wait set            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_ENABLE_WAIT_SET
+VOID  _tx_wait_set_signal(TX_WAIT_SET_MEMBER *member_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_WAIT_SET         *wait_set_ptr;
+TX_THREAD           *thread_ptr;
+TX_THREAD           *next_thread;
+TX_THREAD           *previous_thread;
+UINT                suspended_count;
+
+
+    /* Default to no thread to resume.  */
+    thread_ptr =  TX_NULL;
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the wait set of the member, the object may have been removed from it.  */
+    wait_set_ptr =  member_ptr -> tx_wait_set_member_set;
+
+    /* Determine if the object is still a member of a wait set.  */
+    if (wait_set_ptr != TX_NULL)
+    {
+
+        /* Pickup the suspended count.  */
+        suspended_count =  wait_set_ptr -> tx_wait_set_suspended_count;
+
+        /* Determine if any threads are waiting on the wait set.  */
+        if (suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            /* Determine if the object is still ready, another thread may have received
+               from it already.  */
+            if (_tx_wait_set_member_ready(member_ptr) == TX_TRUE)
+            {
+
+                /* Pickup the head of the suspension list.  */
+                thread_ptr =  wait_set_ptr -> tx_wait_set_suspension_list;
+
+                /* See if this is the only suspended thread on the list.  */
+                suspended_count--;
+                if (suspended_count == TX_NO_SUSPENSIONS)
+                {
+
+                    /* Yes, the only suspended thread.  */
+
+                    /* Update the head pointer.  */
+                    wait_set_ptr -> tx_wait_set_suspension_list =  TX_NULL;
+                }
+                else
+                {
+
+                    /* At least one more thread is on the same suspension list.  */
+
+                    /* Update the list head pointer.  */
+                    next_thread =                                   thread_ptr -> tx_thread_suspended_next;
+                    wait_set_ptr -> tx_wait_set_suspension_list =   next_thread;
+
+                    /* Update the links of the adjacent threads.  */
+                    previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                    next_thread -> tx_thread_suspended_previous =   previous_thread;
+                    previous_thread -> tx_thread_suspended_next =   next_thread;
+                }
+
+                /* Decrement the suspension count.  */
+                wait_set_ptr -> tx_wait_set_suspended_count =  suspended_count;
+
+                /* Prepare for resumption of the thread.  */
+
+                /* Clear cleanup routine to avoid timeout.  */
+                thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                /* Report the ready object to the thread.  */
+                thread_ptr -> tx_thread_additional_suspend_info =  member_ptr -> tx_wait_set_member_object;
+
+                /* Put return status into the thread control block.  */
+                thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+            }
+        }
+    }
+
+    /* Determine if a thread is to be resumed.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+}
+#endif
+
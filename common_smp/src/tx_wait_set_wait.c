@@ -0,0 +1,292 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Wait Set                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_wait_set.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_wait_set_wait                                   PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits until a member of the wait set is ready, that   */
+/*    is a queue has a message, a semaphore has an instance, or an event  */
+/*    flags group has one or more event flags set. The ready object is    */
+/*    returned, members are checked starting with the member added last.  */
+/*    If no member is ready, this service suspends the calling thread,    */
+/*    as specified by the wait option.                                    */
+/*                                                                        */
+/*    The ready object is not changed, the caller then receives from it,  */
+/*    typically with TX_NO_WAIT. Since other threads may receive from     */
+/*    the object first, the caller must handle an empty object.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_set_ptr                      Pointer to wait set control block */
+/*    ready_object_ptr                  Destination for pointer to the    */
+/*                                        ready object                    */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*    TX_FEATURE_NOT_ENABLED            Wait sets are not enabled         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_wait_set_member_ready         Check readiness of member         */
+/*    _tx_thread_system_suspend         Suspend thread service            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_wait_set_wait(TX_WAIT_SET *wait_set_ptr, VOID **ready_object_ptr, ULONG wait_option)
+{
+
+#ifdef TX_ENABLE_WAIT_SET
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_WAIT_SET_MEMBER  *member_ptr;
+VOID                *ready_object;
+TX_THREAD           *thread_ptr;
+TX_THREAD           *next_thread;
+TX_THREAD           *previous_thread;
+UINT                suspended_count;
+UINT                status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts to check the members of the wait set.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_WAIT_SET_WAIT, wait_set_ptr, TX_POINTER_TO_ULONG_CONVERT(ready_object_ptr), wait_option, 0, TX_TRACE_EVENT_FLAGS_EVENTS)
+
+    /* Find the first member that is ready.  */
+    ready_object =  TX_NULL;
+    member_ptr =    wait_set_ptr -> tx_wait_set_member_list;
+    while (member_ptr != TX_NULL)
+    {
+
+        /* Determine if this member is ready.  */
+        if (_tx_wait_set_member_ready(member_ptr) == TX_TRUE)
+        {
+
+            /* Yes, pickup the ready object.  */
+            ready_object =  member_ptr -> tx_wait_set_member_object;
+
+            /* End the search.  */
+            member_ptr =  TX_NULL;
+        }
+        else
+        {
+
+            /* Move to the next member.  */
+            member_ptr =  member_ptr -> tx_wait_set_member_next;
+        }
+    }
+
+    /* Determine if a member is ready.  */
+    if (ready_object != TX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return the ready object.  */
+        *ready_object_ptr =  ready_object;
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point.  */
+            *ready_object_ptr =  TX_NULL;
+            status =  TX_NO_EVENTS;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_wait_set_cleanup);
+
+            /* Setup cleanup information, i.e. this wait set control block. The
+               ready object is placed in the additional suspend information.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) wait_set_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  TX_NULL;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Pickup the suspended count.  */
+            suspended_count =  wait_set_ptr -> tx_wait_set_suspended_count;
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                wait_set_ptr -> tx_wait_set_suspension_list =  thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =       thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =   thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   wait_set_ptr -> tx_wait_set_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            wait_set_ptr -> tx_wait_set_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_WAIT_SET_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the ready object, which is only set when a member became ready.  */
+            *ready_object_ptr =  thread_ptr -> tx_thread_additional_suspend_info;
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* No member is ready.  */
+        *ready_object_ptr =  TX_NULL;
+        status =  TX_NO_EVENTS;
+    }
+#else
+
+UINT            status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (wait_set_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (ready_object_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+#endif
+
+    /* Return completion status.  */
+    return(status);
+}
+
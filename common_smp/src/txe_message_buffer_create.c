@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Message Buffer                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+#include "tx_message_buffer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_message_buffer_create                          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the message buffer create        */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    message_buffer_ptr                Pointer to message buffer         */
+/*    name_ptr                          Pointer to message buffer name    */
+/*    message_buffer_start              Starting address of message       */
+/*                                        buffer area                     */
+/*    message_buffer_size               Number of bytes in message buffer */
+/*                                        area                            */
+/*    message_buffer_control_block_size Size of message buffer control    */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_QUEUE_ERROR                    Invalid message buffer pointer    */
+/*    TX_PTR_ERROR                      Invalid starting address          */
+/*    TX_SIZE_ERROR                     Invalid message buffer size       */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_message_buffer_create         Actual create function            */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_message_buffer_create(TX_MESSAGE_BUFFER *message_buffer_ptr, CHAR *name_ptr,
+                    VOID *message_buffer_start, ULONG message_buffer_size, UINT message_buffer_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+ULONG               i;
+TX_MESSAGE_BUFFER   *next_message_buffer;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD       *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid message buffer pointer.  */
+    if (message_buffer_ptr == TX_NULL)
+    {
+
+        /* Message buffer pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+
+    /* Now check for a valid control block size.  */
+    else if (message_buffer_control_block_size != (sizeof(TX_MESSAGE_BUFFER)))
+    {
+
+        /* Message buffer pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_message_buffer =   _tx_message_buffer_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_message_buffer_created_count; i++)
+        {
+
+            /* Determine if this message buffer matches the message buffer in the list.  */
+            if (message_buffer_ptr == next_message_buffer)
+            {
+
+                break;
+            }
+            else
+            {
+
+                /* Move to the next message buffer.  */
+                next_message_buffer =  next_message_buffer -> tx_message_buffer_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+
+        /* At this point, check to see if there is a duplicate message buffer.  */
+        if (message_buffer_ptr == next_message_buffer)
+        {
+
+            /* Message buffer is already created, return appropriate error code.  */
+            status =  TX_QUEUE_ERROR;
+        }
+
+        /* Check the starting address of the message buffer.  */
+        else if (message_buffer_start == TX_NULL)
+        {
+
+            /* Invalid starting address of message buffer.  */
+            status =  TX_PTR_ERROR;
+        }
+
+        /* Check that the message buffer can hold the length and the data of at least a
+           one byte message.  */
+        else if ((message_buffer_size/(sizeof(ULONG))) < ((ULONG) 2))
+        {
+
+            /* Invalid message buffer size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+        else
+        {
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Check for invalid caller of this function.  First check for a calling thread.  */
+            if (thread_ptr == &_tx_timer_thread)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+#endif
+
+            /* Check for interrupt call.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+            {
+
+                /* Now, make sure the call is from an interrupt and not initialization.  */
+                if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+                {
+
+                    /* Invalid caller of this function, return appropriate error code.  */
+                    status =  TX_CALLER_ERROR;
+                }
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual message buffer create function.  */
+        status =  _tx_message_buffer_create(message_buffer_ptr, name_ptr, message_buffer_start, message_buffer_size);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -37,7 +37,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _txe_queue_create                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    William E. Lamie, Microsoft Corporation                             */
@@ -78,6 +78,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Microsoft Corporation    Added message sizes in bytes, */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _txe_queue_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
@@ -179,16 +181,33 @@ TX_THREAD       *thread_ptr;
             status =  TX_SIZE_ERROR;
         }
 
-        /* Check for an invalid message size - greater than 16.  */
-        else if (message_size > TX_16_ULONG)
+        /* Check for an invalid message size - greater than 16 and not given in bytes.  */
+        else if ((message_size > TX_16_ULONG) && (message_size <= TX_QUEUE_MESSAGE_BYTES_BASE))
         {
 
             /* Invalid message size specified.  */
             status =  TX_SIZE_ERROR;
         }
 
+        /* Check for an invalid message size in bytes - greater than the maximum.  */
+        else if (message_size > TX_QUEUE_MESSAGE_BYTES(TX_QUEUE_MAXIMUM_MESSAGE_BYTES))
+        {
+
+            /* Invalid message size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check on the queue size in bytes.  */
+        else if ((message_size > TX_QUEUE_MESSAGE_BYTES_BASE) &&
+                 ((queue_size/(sizeof(ULONG))) < (((((ULONG) message_size) - ((ULONG) TX_QUEUE_MESSAGE_BYTES_BASE)) + (sizeof(ULONG)) - ((ULONG) 1))/(sizeof(ULONG)))))
+        {
+
+            /* Invalid queue size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
         /* Check on the queue size.  */
-        else if ((queue_size/(sizeof(ULONG))) < message_size)
+        else if ((message_size <= TX_16_ULONG) && ((queue_size/(sizeof(ULONG))) < message_size))
         {
 
             /* Invalid queue size specified.  */
@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Slab Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_slab_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_slab_release                                   PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Microsoft Corporation                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the slab release function call.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_ptr                         Pointer to memory block           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_PTR_ERROR                      Invalid memory block pointer      */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_slab_release                  Actual slab release function      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Microsoft Corporation    Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_slab_release(VOID *block_ptr)
+{
+
+UINT                status;
+TX_SLAB_POOL_PAGE   *page_ptr;
+TX_SLAB_POOL_CLASS  *class_ptr;
+UCHAR               **indirect_ptr;
+UCHAR               *work_ptr;
+
+
+    /* First check the supplied pointer.  */
+    if (block_ptr == TX_NULL)
+    {
+
+        /* The block pointer is invalid, return appropriate status.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Pickup the page pointer which is just previous to the starting
+           address of block that the caller sees.  */
+        work_ptr =      TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+        work_ptr =      TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+        indirect_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        work_ptr =      *indirect_ptr;
+        page_ptr =      TX_UCHAR_TO_SLAB_POOL_PAGE_POINTER_CONVERT(work_ptr);
+
+        /* Check for an invalid page pointer.  */
+        if (page_ptr == TX_NULL)
+        {
+
+            /* Page pointer is invalid, return appropriate error code.  */
+            status =  TX_PTR_ERROR;
+        }
+        else
+        {
+
+            /* Pickup the size class of the page.  */
+            class_ptr =  page_ptr -> tx_slab_pool_page_class;
+
+            /* Check for a page that is not given to a size class.  */
+            if (class_ptr == TX_NULL)
+            {
+
+                /* Page is not in use, return appropriate error code.  */
+                status =  TX_PTR_ERROR;
+            }
+
+            /* Now check for invalid pool ID.  */
+            else if (class_ptr -> tx_slab_pool_class_pool -> tx_slab_pool_id != TX_SLAB_POOL_ID)
+            {
+
+                /* Pool pointer is invalid, return appropriate error code.  */
+                status =  TX_PTR_ERROR;
+            }
+            else
+            {
+
+                /* Call actual slab release function.  */
+                status =  _tx_slab_release(block_ptr);
+            }
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,235 @@
+/* This is a small benchmark of the ThreadX SMP block pool.  One worker thread is bound to each
+   core and repeatedly allocates and releases a few blocks of a shared pool.  The benchmark is
+   run with 1 to TX_THREAD_SMP_MAX_CORES active workers and, when the kernel is built with
+   TX_BLOCK_POOL_ENABLE_CORE_CACHE defined, both without and with the per-core block caches.  */
+
+#include   "tx_api.h"
+#include   <stdio.h>
+#include   <stdlib.h>
+
+#define     BENCHMARK_STACK_SIZE        4096
+#define     BENCHMARK_BLOCK_SIZE        64
+#define     BENCHMARK_BLOCK_COUNT       256
+#define     BENCHMARK_BLOCKS_PER_LOOP   4
+#define     BENCHMARK_CACHE_DEPTH       16
+#define     BENCHMARK_INTERVAL          (TX_TIMER_TICKS_PER_SECOND * 2)
+
+
+/* Define the ThreadX object control blocks...  */
+
+TX_THREAD               control_thread;
+TX_THREAD               worker_thread[TX_THREAD_SMP_MAX_CORES];
+TX_SEMAPHORE            start_semaphore[TX_THREAD_SMP_MAX_CORES];
+TX_SEMAPHORE            done_semaphore;
+TX_BLOCK_POOL           block_pool_0;
+
+
+/* Define the stacks and the block pool memory.  */
+
+UCHAR                   control_stack[BENCHMARK_STACK_SIZE];
+UCHAR                   worker_stack[TX_THREAD_SMP_MAX_CORES][BENCHMARK_STACK_SIZE];
+UCHAR                   block_pool_memory[BENCHMARK_BLOCK_COUNT * (BENCHMARK_BLOCK_SIZE + sizeof(UCHAR *))];
+
+
+/* Define the counters used in the benchmark...  */
+
+volatile ULONG          worker_counter[TX_THREAD_SMP_MAX_CORES];
+volatile ULONG          worker_errors;
+volatile ULONG          benchmark_end_time;
+
+
+/* Define thread prototypes.  */
+
+void    control_thread_entry(ULONG thread_input);
+void    worker_thread_entry(ULONG thread_input);
+void    benchmark_run(UINT cache_depth);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+UINT    i;
+
+
+    /* Create the block pool shared by all workers.  */
+    tx_block_pool_create(&block_pool_0, "block pool 0", BENCHMARK_BLOCK_SIZE, block_pool_memory, sizeof(block_pool_memory));
+
+    /* Create the control thread at the highest priority.  */
+    tx_thread_create(&control_thread, "control thread", control_thread_entry, 0,
+            control_stack, BENCHMARK_STACK_SIZE,
+            1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the semaphore the workers signal at the end of each run.  */
+    tx_semaphore_create(&done_semaphore, "done semaphore", 0);
+
+    /* Create one worker thread for each core.  Each worker waits on its start semaphore.  */
+    for (i = 0; i < TX_THREAD_SMP_MAX_CORES; i++)
+    {
+
+        tx_semaphore_create(&start_semaphore[i], "start semaphore", 0);
+
+        tx_thread_create(&worker_thread[i], "worker thread", worker_thread_entry, i,
+                worker_stack[i], BENCHMARK_STACK_SIZE,
+                16, 16, TX_NO_TIME_SLICE, TX_DONT_START);
+
+        /* Bind the worker to its core and start it.  */
+        tx_thread_smp_core_exclude(&worker_thread[i], ((((ULONG) 1) << TX_THREAD_SMP_MAX_CORES) - 1) & ~(((ULONG) 1) << i));
+        tx_thread_resume(&worker_thread[i]);
+    }
+}
+
+
+/* Define the control thread, which runs the benchmark.  */
+
+void    control_thread_entry(ULONG thread_input)
+{
+
+    printf("ThreadX SMP block pool benchmark: %u cores, %u byte blocks, %u blocks per loop\n",
+            (UINT) TX_THREAD_SMP_MAX_CORES, (UINT) BENCHMARK_BLOCK_SIZE, (UINT) BENCHMARK_BLOCKS_PER_LOOP);
+
+    /* Run the benchmark without the per-core caches.  */
+    benchmark_run(0);
+
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+
+    /* Run the benchmark with the per-core caches.  */
+    benchmark_run(BENCHMARK_CACHE_DEPTH);
+#else
+
+    printf("Build with BLOCK_POOL_CORE_CACHE=1 to compare with the per-core block caches\n");
+#endif
+
+    printf("Benchmark done, %lu errors\n", worker_errors);
+    exit(0);
+}
+
+
+/* Run the benchmark with 1 to TX_THREAD_SMP_MAX_CORES workers.  */
+
+void    benchmark_run(UINT cache_depth)
+{
+
+UINT    workers;
+UINT    i;
+ULONG   total;
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+ULONG   hits;
+ULONG   refills;
+ULONG   drains;
+#endif
+
+    /* Set the depth of the per-core caches.  */
+    tx_block_pool_core_cache_enable(&block_pool_0, cache_depth);
+#endif
+
+    for (workers = 1; workers <= TX_THREAD_SMP_MAX_CORES; workers++)
+    {
+
+        /* Clear the counters and start the workers for the benchmark interval.  */
+        for (i = 0; i < workers; i++)
+        {
+            worker_counter[i] = 0;
+        }
+        benchmark_end_time = tx_time_get() + BENCHMARK_INTERVAL;
+        for (i = 0; i < workers; i++)
+        {
+            tx_semaphore_put(&start_semaphore[i]);
+        }
+
+        /* Wait for the workers to finish and sum up their loops.  */
+        for (i = 0; i < workers; i++)
+        {
+            tx_semaphore_get(&done_semaphore, TX_WAIT_FOREVER);
+        }
+        total = 0;
+        for (i = 0; i < workers; i++)
+        {
+            total = total + worker_counter[i];
+        }
+
+        printf("cache depth %2u, %u workers: %10lu allocate/release pairs per second\n", cache_depth, workers,
+                (total * BENCHMARK_BLOCKS_PER_LOOP * TX_TIMER_TICKS_PER_SECOND) / BENCHMARK_INTERVAL);
+    }
+
+#ifdef TX_BLOCK_POOL_ENABLE_CORE_CACHE
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Show how the allocations were satisfied.  */
+    tx_block_pool_core_cache_performance_info_get(&block_pool_0, &hits, &refills, &drains);
+    printf("cache depth %2u: %lu cache hits, %lu refills, %lu drains\n", cache_depth, hits, refills, drains);
+#endif
+#endif
+}
+
+
+/* Define the worker threads, which allocate and release blocks until the end of each run.  */
+
+void    worker_thread_entry(ULONG thread_input)
+{
+
+VOID    *blocks[BENCHMARK_BLOCKS_PER_LOOP];
+UINT    i;
+UINT    status;
+
+
+    while (1)
+    {
+
+        /* Wait for the start of the next run.  */
+        tx_semaphore_get(&start_semaphore[thread_input], TX_WAIT_FOREVER);
+
+        /* Allocate and release blocks until the end of the run.  */
+        while (tx_time_get() < benchmark_end_time)
+        {
+
+            /* Allocate a few blocks.  */
+            for (i = 0; i < BENCHMARK_BLOCKS_PER_LOOP; i++)
+            {
+
+                status = tx_block_allocate(&block_pool_0, &blocks[i], TX_WAIT_FOREVER);
+                if (status != TX_SUCCESS)
+                {
+                    worker_errors++;
+                    blocks[i] = TX_NULL;
+                }
+                else
+                {
+                    *((ULONG *) blocks[i]) = thread_input;
+                }
+            }
+
+            /* Release the blocks again.  */
+            for (i = 0; i < BENCHMARK_BLOCKS_PER_LOOP; i++)
+            {
+
+                if (blocks[i] != TX_NULL)
+                {
+                    if (*((ULONG *) blocks[i]) != thread_input)
+                    {
+                        worker_errors++;
+                    }
+                    tx_block_release(blocks[i]);
+                }
+            }
+
+            /* Count the loop.  */
+            worker_counter[thread_input]++;
+        }
+
+        /* Signal the end of the run.  */
+        tx_semaphore_put(&done_semaphore);
+    }
+}
@@ -22,37 +22,96 @@ LINUX_OBJS = $(LINUX_SRCS:%.c=.tmp/%.o)
 
 GENERIC_SRCS = \
 tx_block_allocate.c \
+tx_block_allocate_bulk.c \
+tx_block_pool_bulk_give.c \
 tx_block_pool_cleanup.c \
+tx_block_pool_core_cache_allocate.c \
+tx_block_pool_core_cache_drain.c \
+tx_block_pool_core_cache_enable.c \
+tx_block_pool_core_cache_flush.c \
+tx_block_pool_core_cache_performance_info_get.c \
+tx_block_pool_core_cache_release.c \
+tx_block_pool_core_cache_unlock.c \
 tx_block_pool_create.c \
 tx_block_pool_delete.c \
 tx_block_pool_info_get.c \
 tx_block_pool_initialize.c \
+tx_block_pool_lock_free_allocate.c \
+tx_block_pool_lock_free_compare_swap.c \
+tx_block_pool_lock_free_enable.c \
+tx_block_pool_lock_free_pop.c \
+tx_block_pool_lock_free_release.c \
 tx_block_pool_performance_info_get.c \
 tx_block_pool_performance_system_info_get.c \
 tx_block_pool_prioritize.c \
 tx_block_release.c \
+tx_block_release_bulk.c \
 tx_byte_allocate.c \
+tx_byte_allocate_aligned.c \
+tx_byte_pool_boundary_tag_format.c \
+tx_byte_pool_boundary_tag_split.c \
+tx_byte_pool_arena_allocate.c \
+tx_byte_pool_arena_class_get.c \
+tx_byte_pool_arena_enable.c \
+tx_byte_pool_arena_flush.c \
+tx_byte_pool_arena_performance_info_get.c \
+tx_byte_pool_arena_release.c \
+tx_byte_pool_arena_steal.c \
+tx_byte_pool_arena_unlock.c \
+tx_byte_pool_cache_enable.c \
+tx_byte_pool_cache_flush.c \
+tx_byte_pool_cache_get.c \
+tx_byte_pool_cache_performance_info_get.c \
+tx_byte_pool_cache_put.c \
 tx_byte_pool_cleanup.c \
+tx_byte_pool_coalesce_release.c \
+tx_byte_pool_coalesce_search.c \
 tx_byte_pool_create.c \
+tx_byte_pool_create_ex.c \
 tx_byte_pool_delete.c \
+tx_byte_pool_fragmentation_info_get.c \
+tx_byte_pool_fragmentation_insert.c \
+tx_byte_pool_fragmentation_remove.c \
+tx_byte_pool_free_extent.c \
 tx_byte_pool_info_get.c \
 tx_byte_pool_initialize.c \
 tx_byte_pool_performance_info_get.c \
 tx_byte_pool_performance_system_info_get.c \
 tx_byte_pool_prioritize.c \
+tx_byte_pool_reallocate_performance_info_get.c \
 tx_byte_pool_search.c \
+tx_byte_pool_search_performance_info_get.c \
+tx_byte_pool_tlsf_block_insert.c \
+tx_byte_pool_tlsf_block_remove.c \
+tx_byte_pool_tlsf_create.c \
+tx_byte_pool_tlsf_mapping.c \
+tx_byte_pool_tlsf_release.c \
+tx_byte_pool_tlsf_search.c \
+tx_byte_pool_waiter_find.c \
+tx_byte_pool_waiter_insert.c \
+tx_byte_pool_waiter_remove.c \
+tx_byte_reallocate.c \
 tx_byte_release.c \
 txe_block_allocate.c \
+txe_block_allocate_bulk.c \
+txe_block_pool_core_cache_enable.c \
 txe_block_pool_create.c \
 txe_block_pool_delete.c \
 txe_block_pool_info_get.c \
+txe_block_pool_lock_free_enable.c \
 txe_block_pool_prioritize.c \
 txe_block_release.c \
+txe_block_release_bulk.c \
 txe_byte_allocate.c \
+txe_byte_allocate_aligned.c \
+txe_byte_pool_arena_enable.c \
+txe_byte_pool_cache_enable.c \
 txe_byte_pool_create.c \
+txe_byte_pool_create_ex.c \
 txe_byte_pool_delete.c \
 txe_byte_pool_info_get.c \
 txe_byte_pool_prioritize.c \
+txe_byte_reallocate.c \
 txe_byte_release.c \
 txe_event_flags_create.c \
 txe_event_flags_delete.c \
@@ -60,33 +119,66 @@ txe_event_flags_get.c \
 txe_event_flags_info_get.c \
 txe_event_flags_set.c \
 txe_event_flags_set_notify.c \
+txe_message_buffer_create.c \
+txe_message_buffer_delete.c \
+txe_message_buffer_flush.c \
+txe_message_buffer_info_get.c \
+txe_message_buffer_receive.c \
+txe_message_buffer_send.c \
+txe_message_buffer_send_notify.c \
 txe_mutex_create.c \
 txe_mutex_delete.c \
 txe_mutex_get.c \
 txe_mutex_info_get.c \
+txe_mutex_ordered_create.c \
 txe_mutex_prioritize.c \
 txe_mutex_put.c \
+txe_mutex_spin_enable.c \
 txe_queue_create.c \
 txe_queue_delete.c \
 txe_queue_flush.c \
 txe_queue_front_send.c \
 txe_queue_info_get.c \
+txe_queue_overwrite_send.c \
 txe_queue_prioritize.c \
+txe_queue_priority_create.c \
+txe_queue_priority_send.c \
 txe_queue_receive.c \
+txe_queue_receive_acquire.c \
+txe_queue_receive_multiple.c \
+txe_queue_receive_release.c \
 txe_queue_send.c \
+txe_queue_send_commit.c \
+txe_queue_send_multiple.c \
 txe_queue_send_notify.c \
+txe_queue_send_reserve.c \
 txe_semaphore_ceiling_put.c \
 txe_semaphore_create.c \
 txe_semaphore_delete.c \
 txe_semaphore_get.c \
+txe_semaphore_get_count.c \
 txe_semaphore_info_get.c \
+txe_semaphore_ordered_create.c \
 txe_semaphore_prioritize.c \
 txe_semaphore_put.c \
+txe_semaphore_put_count.c \
 txe_semaphore_put_notify.c \
+txe_slab_allocate.c \
+txe_slab_pool_class_info_get.c \
+txe_slab_pool_create.c \
+txe_slab_pool_delete.c \
+txe_slab_pool_info_get.c \
+txe_slab_release.c \
+txe_spsc_ring_create.c \
+txe_spsc_ring_delete.c \
+txe_spsc_ring_receive.c \
+txe_spsc_ring_send.c \
 txe_thread_create.c \
 txe_thread_delete.c \
 txe_thread_entry_exit_notify.c \
 txe_thread_info_get.c \
+txe_thread_notify.c \
+txe_thread_notify_wait.c \
 txe_thread_preemption_change.c \
 txe_thread_priority_change.c \
 txe_thread_relinquish.c \
@@ -102,6 +194,13 @@ txe_timer_create.c \
 txe_timer_deactivate.c \
 txe_timer_delete.c \
 txe_timer_info_get.c \
+txe_wait_set_create.c \
+txe_wait_set_delete.c \
+txe_wait_set_event_flags_add.c \
+txe_wait_set_queue_add.c \
+txe_wait_set_remove.c \
+txe_wait_set_semaphore_add.c \
+txe_wait_set_wait.c \
 tx_event_flags_cleanup.c \
 tx_event_flags_create.c \
 tx_event_flags_delete.c \
@@ -115,6 +214,19 @@ tx_event_flags_set_notify.c \
 tx_initialize_high_level.c \
 tx_initialize_kernel_enter.c \
 tx_initialize_kernel_setup.c \
+tx_message_buffer_cleanup.c \
+tx_message_buffer_create.c \
+tx_message_buffer_delete.c \
+tx_message_buffer_flush.c \
+tx_message_buffer_info_get.c \
+tx_message_buffer_initialize.c \
+tx_message_buffer_performance_info_get.c \
+tx_message_buffer_performance_system_info_get.c \
+tx_message_buffer_receive.c \
+tx_message_buffer_record_read.c \
+tx_message_buffer_record_write.c \
+tx_message_buffer_send.c \
+tx_message_buffer_send_notify.c \
 tx_misra.c \
 tx_mutex_cleanup.c \
 tx_mutex_create.c \
@@ -122,11 +234,15 @@ tx_mutex_delete.c \
 tx_mutex_get.c \
 tx_mutex_info_get.c \
 tx_mutex_initialize.c \
+tx_mutex_ordered_create.c \
 tx_mutex_performance_info_get.c \
 tx_mutex_performance_system_info_get.c \
 tx_mutex_prioritize.c \
 tx_mutex_priority_change.c \
 tx_mutex_put.c \
+tx_mutex_spin.c \
+tx_mutex_spin_enable.c \
+tx_mutex_spin_performance_info_get.c \
 tx_queue_cleanup.c \
 tx_queue_create.c \
 tx_queue_delete.c \
@@ -134,34 +250,79 @@ tx_queue_flush.c \
 tx_queue_front_send.c \
 tx_queue_info_get.c \
 tx_queue_initialize.c \
+tx_queue_message_bytes_copy.c \
+tx_queue_overwrite_performance_info_get.c \
+tx_queue_overwrite_send.c \
 tx_queue_performance_info_get.c \
 tx_queue_performance_system_info_get.c \
 tx_queue_prioritize.c \
+tx_queue_priority_create.c \
+tx_queue_priority_front_insert.c \
+tx_queue_priority_insert.c \
+tx_queue_priority_remove.c \
+tx_queue_priority_reset.c \
+tx_queue_priority_send.c \
 tx_queue_receive.c \
+tx_queue_receive_acquire.c \
+tx_queue_receive_multiple.c \
+tx_queue_receive_release.c \
 tx_queue_send.c \
+tx_queue_send_commit.c \
+tx_queue_send_multiple.c \
 tx_queue_send_notify.c \
+tx_queue_send_reserve.c \
+tx_queue_threads_resume.c \
+tx_queue_zero_copy_settle.c \
 tx_semaphore_ceiling_put.c \
 tx_semaphore_cleanup.c \
 tx_semaphore_create.c \
 tx_semaphore_delete.c \
 tx_semaphore_get.c \
+tx_semaphore_get_count.c \
 tx_semaphore_info_get.c \
 tx_semaphore_initialize.c \
+tx_semaphore_instances_put.c \
+tx_semaphore_ordered_create.c \
 tx_semaphore_performance_info_get.c \
 tx_semaphore_performance_system_info_get.c \
 tx_semaphore_prioritize.c \
 tx_semaphore_put.c \
+tx_semaphore_put_count.c \
 tx_semaphore_put_notify.c \
+tx_slab_allocate.c \
+tx_slab_pool_class_allocate.c \
+tx_slab_pool_class_info_get.c \
+tx_slab_pool_cleanup.c \
+tx_slab_pool_create.c \
+tx_slab_pool_delete.c \
+tx_slab_pool_info_get.c \
+tx_slab_pool_initialize.c \
+tx_slab_release.c \
+tx_spsc_ring_cleanup.c \
+tx_spsc_ring_create.c \
+tx_spsc_ring_delete.c \
+tx_spsc_ring_initialize.c \
+tx_spsc_ring_load.c \
+tx_spsc_ring_receive.c \
+tx_spsc_ring_resume.c \
+tx_spsc_ring_send.c \
+tx_spsc_ring_store.c \
+tx_spsc_ring_suspend.c \
 tx_thread_create.c \
 tx_thread_delete.c \
 tx_thread_entry_exit_notify.c \
 tx_thread_identify.c \
 tx_thread_info_get.c \
 tx_thread_initialize.c \
+tx_thread_notify.c \
+tx_thread_notify_cleanup.c \
+tx_thread_notify_wait.c \
 tx_thread_performance_info_get.c \
 tx_thread_performance_system_info_get.c \
 tx_thread_preemption_change.c \
 tx_thread_priority_change.c \
+tx_thread_priority_suspension_insert.c \
+tx_thread_priority_suspension_remove.c \
 tx_thread_relinquish.c \
 tx_thread_reset.c \
 tx_thread_resume.c \
@@ -172,6 +333,7 @@ tx_thread_smp_core_exclude_get.c \
 tx_thread_smp_current_state_set.c \
 tx_thread_smp_debug_entry_insert.c \
 tx_thread_smp_high_level_initialize.c \
+tx_thread_smp_pointer_compare_swap.c \
 tx_thread_smp_rebalance_execute_list.c \
 tx_thread_smp_utilities.c \
 tx_thread_stack_analyze.c \
@@ -215,5 +377,18 @@ tx_trace_isr_exit_insert.c \
 tx_trace_object_register.c \
 tx_trace_object_unregister.c \
 tx_trace_user_event_insert.c \
+tx_wait_set_cleanup.c \
+tx_wait_set_create.c \
+tx_wait_set_delete.c \
+tx_wait_set_event_flags_add.c \
+tx_wait_set_initialize.c \
+tx_wait_set_member_add.c \
+tx_wait_set_member_ready.c \
+tx_wait_set_member_remove.c \
+tx_wait_set_queue_add.c \
+tx_wait_set_remove.c \
+tx_wait_set_semaphore_add.c \
+tx_wait_set_signal.c \
+tx_wait_set_wait.c \
 
 GENERIC_OBJS = $(GENERIC_SRCS:%.c=.tmp/generic/%.o)
@@ -0,0 +1,245 @@
+/* This is a small check of the message copy of the ThreadX SMP port.  Messages of every size
+   from 1 to 16 ULONGs, and of a few sizes given in bytes, are sent through a queue and received
+   again, and each received message is compared with the message that was sent.  Messages of
+   sizes in bytes are also checked for bytes written past their end.  Messages of
+   1 to 16 ULONGs are also sent through a single-producer single-consumer ring.  The program
+   prints the number of errors and exits with a non-zero status if any message was corrupted.  */
+
+#include   "tx_api.h"
+#include   <stdio.h>
+#include   <stdlib.h>
+
+#define     CHECK_STACK_SIZE            4096
+#define     CHECK_MAX_ULONGS            64
+#define     CHECK_MESSAGES              4
+
+
+/* Define the ThreadX object control blocks...  */
+
+TX_THREAD               check_thread;
+TX_QUEUE                check_queue;
+TX_SPSC_RING            check_ring;
+
+
+/* Define the stack, the queue memory and the ring memory.  */
+
+UCHAR                   check_stack[CHECK_STACK_SIZE];
+ULONG                   check_queue_memory[CHECK_MESSAGES * CHECK_MAX_ULONGS];
+ULONG                   check_ring_memory[CHECK_MESSAGES * TX_16_ULONG];
+
+
+/* Define the number of corrupted messages.  */
+
+ULONG                   check_errors;
+
+
+/* Define thread prototypes.  */
+
+void    check_thread_entry(ULONG thread_input);
+void    queue_check(UINT message_size, UINT message_ulongs);
+void    queue_bytes_check(UINT message_bytes);
+void    ring_check(UINT message_size);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the thread that runs the checks.  */
+    tx_thread_create(&check_thread, "check thread", check_thread_entry, 0,
+            check_stack, CHECK_STACK_SIZE,
+            1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the check thread, which runs all checks.  */
+
+void    check_thread_entry(ULONG thread_input)
+{
+
+UINT    size;
+
+
+    printf("ThreadX SMP message copy check: %u byte ULONG\n", (UINT) sizeof(ULONG));
+
+    /* Check the queue with every message size in ULONGs.  */
+    for (size = TX_1_ULONG; size <= TX_16_ULONG; size++)
+    {
+
+        queue_check(size, size);
+    }
+
+    /* Check the queue with message sizes in bytes, whose message slots are rounded up to whole ULONGs.  */
+    queue_check(TX_QUEUE_MESSAGE_BYTES(3 * sizeof(ULONG) - 1), 3);
+    queue_check(TX_QUEUE_MESSAGE_BYTES(40 * sizeof(ULONG)), 40);
+
+    /* Check that only the bytes of a message size in bytes are copied.  */
+    queue_bytes_check(1);
+    queue_bytes_check(7);
+    queue_bytes_check(10);
+    queue_bytes_check(13);
+    queue_bytes_check(8 * sizeof(ULONG) + 3);
+
+    /* Check the ring with every message size.  */
+    for (size = TX_1_ULONG; size <= TX_16_ULONG; size++)
+    {
+
+        ring_check(size);
+    }
+
+    printf("Check done, %lu errors\n", check_errors);
+    exit(check_errors != 0);
+}
+
+
+/* Send messages of the specified size through the queue and compare the received messages.  */
+
+void    queue_check(UINT message_size, UINT message_ulongs)
+{
+
+ULONG   source[CHECK_MAX_ULONGS];
+ULONG   destination[CHECK_MAX_ULONGS];
+UINT    message;
+UINT    i;
+
+
+    tx_queue_create(&check_queue, "check queue", message_size, check_queue_memory, sizeof(check_queue_memory));
+
+    for (message = 0; message < CHECK_MESSAGES; message++)
+    {
+
+        /* Build a message with a different value in each ULONG.  */
+        for (i = 0; i < message_ulongs; i++)
+        {
+
+            source[i] =       ((ULONG) message << 16) + i + 1;
+            destination[i] =  0;
+        }
+
+        tx_queue_send(&check_queue, source, TX_NO_WAIT);
+        tx_queue_receive(&check_queue, destination, TX_NO_WAIT);
+
+        /* Compare the received message with the message sent.  */
+        for (i = 0; i < message_ulongs; i++)
+        {
+
+            if (destination[i] != source[i])
+            {
+
+                printf("Queue message of %u ULONGs, word %u: sent %lx, received %lx\n",
+                        message_ulongs, i, source[i], destination[i]);
+                check_errors++;
+                break;
+            }
+        }
+    }
+
+    tx_queue_delete(&check_queue);
+}
+
+
+/* Send messages of the specified number of bytes through the queue.  The destination is filled
+   with a guard value first, and no byte past the end of the received message may change.  */
+
+void    queue_bytes_check(UINT message_bytes)
+{
+
+UCHAR   source[CHECK_MAX_ULONGS * sizeof(ULONG)];
+UCHAR   destination[CHECK_MAX_ULONGS * sizeof(ULONG)];
+UINT    message;
+UINT    i;
+
+
+    tx_queue_create(&check_queue, "check queue", TX_QUEUE_MESSAGE_BYTES(message_bytes), check_queue_memory, sizeof(check_queue_memory));
+
+    for (message = 0; message < CHECK_MESSAGES; message++)
+    {
+
+        /* Build a message with a different value in each byte, and fill the destination with the guard value.  */
+        for (i = 0; i < sizeof(source); i++)
+        {
+
+            source[i] =       (UCHAR) ((message << 4) + i + 1);
+            destination[i] =  (UCHAR) 0xA5;
+        }
+
+        tx_queue_send(&check_queue, source, TX_NO_WAIT);
+        tx_queue_receive(&check_queue, destination, TX_NO_WAIT);
+
+        /* Compare the received message with the message sent, and check the guard value after it.  */
+        for (i = 0; i < sizeof(destination); i++)
+        {
+
+            if (((i < message_bytes) && (destination[i] != source[i])) ||
+                ((i >= message_bytes) && (destination[i] != (UCHAR) 0xA5)))
+            {
+
+                printf("Queue message of %u bytes, byte %u: received %x\n",
+                        message_bytes, i, (UINT) destination[i]);
+                check_errors++;
+                break;
+            }
+        }
+    }
+
+    tx_queue_delete(&check_queue);
+}
+
+
+/* Send messages of the specified size through the ring and compare the received messages.  More
+   messages are sent than the ring holds with the largest message size, so the messages wrap
+   around the end of the ring memory.  */
+
+void    ring_check(UINT message_size)
+{
+
+ULONG   source[TX_16_ULONG];
+ULONG   destination[TX_16_ULONG];
+UINT    message;
+UINT    i;
+
+
+    tx_spsc_ring_create(&check_ring, "check ring", message_size, check_ring_memory, sizeof(check_ring_memory));
+
+    for (message = 0; message < (2 * CHECK_MESSAGES); message++)
+    {
+
+        /* Build a message with a different value in each ULONG.  */
+        for (i = 0; i < message_size; i++)
+        {
+
+            source[i] =       ((ULONG) message << 16) + i + 1;
+            destination[i] =  0;
+        }
+
+        tx_spsc_ring_send(&check_ring, source, TX_NO_WAIT);
+        tx_spsc_ring_receive(&check_ring, destination, TX_NO_WAIT);
+
+        /* Compare the received message with the message sent.  */
+        for (i = 0; i < message_size; i++)
+        {
+
+            if (destination[i] != source[i])
+            {
+
+                printf("Ring message of %u ULONGs, word %u: sent %lx, received %lx\n",
+                        message_size, i, source[i], destination[i]);
+                check_errors++;
+                break;
+            }
+        }
+    }
+
+    tx_spsc_ring_delete(&check_ring);
+}
@@ -54,6 +54,15 @@
 /*  10-15-2021     William E. Lamie         Modified comment(s), added    */
 /*                                            symbol ULONG64_DEFINED,     */
 /*                                            resulting in version 6.1.9  */
+/*  xx-xx-xxxx     Microsoft Corporation    Added pointer compare and     */
+/*                                            swap, added lock-free block */
+/*                                            pool compare and swap,      */
+/*                                            added queue message copy    */
+/*                                            with 64-bit moves, added    */
+/*                                            single-producer single-     */
+/*                                            consumer ring index         */
+/*                                            accesses, resulting in      */
+/*                                            version 6.x                 */
 /*                                                                        */
 /**************************************************************************/
 
@@ -586,6 +595,55 @@ void                        _tx_thread_smp_debug_entry_insert(ULONG id, ULONG su
 #define TX_SMP_CORE_ID                          _tx_thread_smp_core_get()
 
 
+/* Define the atomic compare and swap of a pointer using the GCC built-in.  */
+
+#define TX_SMP_POINTER_COMPARE_AND_SWAP(a, e, n)    ((UINT) __sync_bool_compare_and_swap((a), (e), (n)))
+
+
+/* Define the atomic compare and swap of the lock-free block pool list using the GCC built-in.  */
+
+#define TX_BLOCK_POOL_LOCK_FREE_COMPARE_AND_SWAP(a, e, n)   ((UINT) __sync_bool_compare_and_swap((a), (e), (n)))
+
+
+/* Define the single-producer single-consumer ring index accesses as sequentially consistent
+   atomic loads and stores using the GCC built-ins.  */
+
+#define TX_SPSC_RING_LOAD(a)                                __atomic_load_n((a), __ATOMIC_SEQ_CST)
+#define TX_SPSC_RING_STORE(a, v)                            __atomic_store_n((a), (v), __ATOMIC_SEQ_CST)
+
+
+/* Define the queue message copy to move two ULONGs at a time, and to use the vector moves
+   of the compiler's memory copy for large messages.  A ULONG is 64 bits in this port, so
+   each step copies 2 * sizeof(ULONG) bytes.  */
+
+#if __x86_64__
+#ifndef TX_MISRA_ENABLE
+#define TX_QUEUE_MESSAGE_COPY(s, d, z)          {                                                               \
+                                                    if ((z) > ((UINT) 8))                                       \
+                                                    {                                                           \
+                                                        __builtin_memcpy((d), (s), ((size_t) (z)) * sizeof(ULONG)); \
+                                                        (s) =  (s) + (z);                                       \
+                                                        (d) =  (d) + (z);                                       \
+                                                    }                                                           \
+                                                    else                                                        \
+                                                    {                                                           \
+                                                        while ((z) > ((UINT) 1))                                \
+                                                        {                                                       \
+                                                            __builtin_memcpy((d), (s), 2 * sizeof(ULONG));      \
+                                                            (s) =  (s) + 2;                                     \
+                                                            (d) =  (d) + 2;                                     \
+                                                            (z) =  (z) - ((UINT) 2);                            \
+                                                        }                                                       \
+                                                        if ((z) != ((UINT) 0))                                  \
+                                                        {                                                       \
+                                                            *(d)++ =  *(s)++;                                   \
+                                                        }                                                       \
+                                                    }                                                           \
+                                                }
+#endif
+#endif
+
+
 
 
 /* Define the ThreadX object deletion extensions for the remaining objects.  */
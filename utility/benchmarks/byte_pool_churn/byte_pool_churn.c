@@ -0,0 +1,211 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Byte Pool Churn Benchmark                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/* This benchmark performs the same pseudo-random sequence of byte allocations and
+   releases on a byte pool created with each allocation policy and reports the byte
+   pool performance counters.  It shows how many blocks are examined by the searches
+   and where the merging of free blocks takes place.  The library and this file must
+   be built with TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO defined.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "tx_api.h"
+
+#ifndef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+#error "TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO must be defined to build this benchmark"
+#endif
+
+
+/* Define the benchmark parameters.  */
+
+#define CHURN_POOL_SIZE         65536
+#define CHURN_SLOTS             256
+#define CHURN_CYCLES            200000
+#define CHURN_SMALL_SIZE        64
+#define CHURN_LARGE_SIZE        2048
+#define CHURN_STACK_SIZE        4096
+
+
+/* Define the ThreadX objects and memory used by the benchmark.  */
+
+TX_THREAD       churn_thread;
+TX_BYTE_POOL    churn_pool;
+ULONG           churn_stack[CHURN_STACK_SIZE / sizeof(ULONG)];
+ALIGN_TYPE      churn_pool_memory[CHURN_POOL_SIZE / sizeof(ALIGN_TYPE)];
+VOID            *churn_slots[CHURN_SLOTS];
+ULONG           churn_random_seed;
+
+
+/* Define the benchmark prototypes.  */
+
+void    churn_thread_entry(ULONG thread_input);
+void    churn_run(UINT policy, CHAR *policy_name);
+ULONG   churn_random(void);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&churn_thread, "churn thread", churn_thread_entry, 0,
+            churn_stack, sizeof(churn_stack), 1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    churn_thread_entry(ULONG thread_input)
+{
+
+    printf("ThreadX byte pool churn benchmark: %d cycles, %d slots, %d byte pool\n\n",
+            CHURN_CYCLES, CHURN_SLOTS, CHURN_POOL_SIZE);
+    printf("%-22s %10s %10s %10s %10s %10s %10s\n", "policy", "allocates", "failures",
+            "searches", "merges", "splits", "max frags");
+
+    /* Run the same churn sequence with each allocation policy.  */
+    churn_run(TX_BYTE_POOL_FIRST_FIT, "first-fit");
+    churn_run(TX_BYTE_POOL_FIRST_FIT_COALESCE, "first-fit coalesce");
+    churn_run(TX_BYTE_POOL_TLSF, "TLSF");
+
+    /* Done, exit the benchmark.  */
+    exit(0);
+}
+
+
+/* Define the churn sequence for one allocation policy.  */
+
+void    churn_run(UINT policy, CHAR *policy_name)
+{
+
+UINT    status;
+ULONG   i;
+ULONG   slot;
+ULONG   size;
+ULONG   failures;
+ULONG   fragments;
+ULONG   max_fragments;
+ULONG   allocates;
+ULONG   releases;
+ULONG   fragments_searched;
+ULONG   merges;
+ULONG   splits;
+ULONG   suspensions;
+ULONG   timeouts;
+
+
+    /* Create the byte pool with the requested policy.  */
+    status =  tx_byte_pool_create_ex(&churn_pool, "churn pool", churn_pool_memory, sizeof(churn_pool_memory), policy);
+    if (status != TX_SUCCESS)
+    {
+
+        printf("%-22s byte pool create failed, status %u\n", policy_name, status);
+        return;
+    }
+
+    /* Use the same sequence for every policy.  */
+    churn_random_seed =  1;
+    failures =           0;
+    max_fragments =      0;
+    for (slot = 0; slot < CHURN_SLOTS; slot++)
+    {
+        churn_slots[slot] =  TX_NULL;
+    }
+
+    for (i = 0; i < CHURN_CYCLES; i++)
+    {
+
+        /* Pickup a random slot and release or allocate its memory.  */
+        slot =  churn_random() % CHURN_SLOTS;
+        if (churn_slots[slot] != TX_NULL)
+        {
+
+            tx_byte_release(churn_slots[slot]);
+            churn_slots[slot] =  TX_NULL;
+        }
+        else
+        {
+
+            /* Mostly small blocks with an occasional large one.  */
+            if ((churn_random() % 8) != 0)
+            {
+                size =  (churn_random() % CHURN_SMALL_SIZE) + 1;
+            }
+            else
+            {
+                size =  (churn_random() % CHURN_LARGE_SIZE) + 1;
+            }
+
+            status =  tx_byte_allocate(&churn_pool, &churn_slots[slot], size, TX_NO_WAIT);
+            if (status != TX_SUCCESS)
+            {
+                churn_slots[slot] =  TX_NULL;
+                failures++;
+            }
+        }
+
+        /* Track the largest number of fragments seen.  */
+        tx_byte_pool_info_get(&churn_pool, TX_NULL, TX_NULL, &fragments, TX_NULL, TX_NULL, TX_NULL);
+        if (fragments > max_fragments)
+        {
+            max_fragments =  fragments;
+        }
+    }
+
+    /* Release the remaining memory.  */
+    for (slot = 0; slot < CHURN_SLOTS; slot++)
+    {
+        if (churn_slots[slot] != TX_NULL)
+        {
+            tx_byte_release(churn_slots[slot]);
+        }
+    }
+
+    /* Pickup and print the performance information of the pool.  */
+    tx_byte_pool_performance_info_get(&churn_pool, &allocates, &releases, &fragments_searched,
+            &merges, &splits, &suspensions, &timeouts);
+    printf("%-22s %10lu %10lu %10lu %10lu %10lu %10lu\n", policy_name, (unsigned long) allocates,
+            (unsigned long) failures, (unsigned long) fragments_searched, (unsigned long) merges,
+            (unsigned long) splits, (unsigned long) max_fragments);
+
+    tx_byte_pool_delete(&churn_pool);
+}
+
+
+/* Define a simple pseudo-random number generator, so that the sequence is the same
+   on every platform.  */
+
+ULONG   churn_random(void)
+{
+
+    churn_random_seed =  (churn_random_seed * 1103515245UL) + 12345UL;
+    return((churn_random_seed >> 16) & 0x7FFFUL);
+}
@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Queue Message Size Benchmark                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/* This benchmark follows the Thread-Metric message processing test.  A thread sends a
+   message to a queue and receives it back in a loop, while a higher priority reporting
+   thread sleeps for the test period and prints the number of messages per second.  The
+   test is repeated with queues created with message sizes of 4, 64, 256 and 1024 bytes
+   through TX_QUEUE_MESSAGE_BYTES.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "tx_api.h"
+
+
+/* Define the benchmark parameters.  */
+
+#ifndef QMS_TEST_DURATION
+#define QMS_TEST_DURATION       5
+#endif
+#define QMS_MAXIMUM_BYTES       1024
+#define QMS_QUEUE_DEPTH         4
+#define QMS_STACK_SIZE          4096
+
+
+/* Define the ThreadX objects and memory used by the benchmark.  */
+
+TX_THREAD       qms_report_thread;
+TX_THREAD       qms_message_thread;
+TX_QUEUE        qms_queue;
+ULONG           qms_report_stack[QMS_STACK_SIZE / sizeof(ULONG)];
+ULONG           qms_message_stack[QMS_STACK_SIZE / sizeof(ULONG)];
+ULONG           qms_queue_memory[(QMS_MAXIMUM_BYTES * QMS_QUEUE_DEPTH) / sizeof(ULONG)];
+ULONG           qms_message_sent[QMS_MAXIMUM_BYTES / sizeof(ULONG)];
+ULONG           qms_message_received[QMS_MAXIMUM_BYTES / sizeof(ULONG)];
+UINT            qms_message_words;
+volatile ULONG  qms_message_counter;
+volatile ULONG  qms_message_errors;
+
+
+/* Define the benchmark prototypes.  */
+
+void    qms_report_thread_entry(ULONG thread_input);
+void    qms_message_thread_entry(ULONG thread_input);
+void    qms_run(UINT message_bytes);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the reporting thread, which runs each test.  */
+    tx_thread_create(&qms_report_thread, "report thread", qms_report_thread_entry, 0,
+            qms_report_stack, sizeof(qms_report_stack), 2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the reporting thread.  */
+
+void    qms_report_thread_entry(ULONG thread_input)
+{
+
+    printf("ThreadX queue message size benchmark: %d second test period\n\n", QMS_TEST_DURATION);
+    printf("%10s %16s\n", "bytes", "messages/sec");
+
+    /* Run the test with each message size.  */
+    qms_run(4);
+    qms_run(64);
+    qms_run(256);
+    qms_run(1024);
+
+    /* Done, exit the benchmark.  */
+    exit(0);
+}
+
+
+/* Define the test for one message size.  */
+
+void    qms_run(UINT message_bytes)
+{
+
+UINT    status;
+UINT    i;
+ULONG   count;
+
+
+    /* Create the queue with the message size in bytes.  */
+    status =  tx_queue_create(&qms_queue, "message queue", TX_QUEUE_MESSAGE_BYTES(message_bytes),
+            qms_queue_memory, message_bytes * QMS_QUEUE_DEPTH);
+    if (status != TX_SUCCESS)
+    {
+
+        printf("%10u queue create failed, status %u\n", message_bytes, status);
+        return;
+    }
+
+    /* Initialize the source message.  */
+    qms_message_words =  message_bytes / sizeof(ULONG);
+    for (i = 0; i < qms_message_words; i++)
+    {
+        qms_message_sent[i] =  (ULONG) (0x11111111UL * (i + 1));
+    }
+
+    /* Start the message thread at a lower priority, so it runs while this thread sleeps.  */
+    qms_message_counter =  0;
+    qms_message_errors =   0;
+    tx_thread_create(&qms_message_thread, "message thread", qms_message_thread_entry, 0,
+            qms_message_stack, sizeof(qms_message_stack), 10, 10, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Sleep to allow the test to run.  */
+    tx_thread_sleep(QMS_TEST_DURATION * TX_TIMER_TICKS_PER_SECOND);
+
+    /* Pickup the number of messages sent and received.  */
+    count =  qms_message_counter;
+
+    /* Stop the message thread and delete the queue.  */
+    tx_thread_terminate(&qms_message_thread);
+    tx_thread_delete(&qms_message_thread);
+    tx_queue_delete(&qms_queue);
+
+    /* Print the results.  */
+    if ((qms_message_errors != 0) || (count == 0))
+    {
+
+        printf("%10u ERROR: Invalid counter value(s). Error sending/receiving messages!\n", message_bytes);
+    }
+    else
+    {
+
+        printf("%10u %16lu\n", message_bytes, (unsigned long) (count / QMS_TEST_DURATION));
+    }
+}
+
+
+/* Define the message processing thread.  */
+
+void    qms_message_thread_entry(ULONG thread_input)
+{
+
+UINT    last;
+
+
+    /* Pickup the index of the last word of the message.  */
+    last =  qms_message_words - 1;
+
+    while (1)
+    {
+
+        /* Send a message to the queue.  */
+        tx_queue_send(&qms_queue, qms_message_sent, TX_WAIT_FOREVER);
+
+        /* Receive a message from the queue.  */
+        tx_queue_receive(&qms_queue, qms_message_received, TX_WAIT_FOREVER);
+
+        /* Check for invalid message.  */
+        if ((qms_message_received[last] != qms_message_sent[last]) || (qms_message_received[0] != qms_message_sent[0]))
+        {
+            qms_message_errors++;
+            break;
+        }
+
+        /* Increment the last word of the message.  */
+        qms_message_sent[last]++;
+
+        /* Increment the number of messages sent and received.  */
+        qms_message_counter++;
+    }
+}